@@ -0,0 +1,115 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Frustum culling benchmark: Bench-Culling [entities=1000000] [iterations=50] [workers=0]
+
+#include "ZEDEngine.h"
+#include "Engine/ECS/Systems/CullingSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedNs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t entityCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const int iterations = argc > 2 ? std::atoi(argv[2]) : 50;
+    const long workers = argc > 3 ? std::atol(argv[3]) : 0;
+
+    ZED::JobSystem::Init(workers > 0 ? static_cast<uint32_t>(workers) : 0);
+
+    ZED::Registry reg;
+    ZED::TransformSystem::connect(reg);
+
+    // Camera at the origin looking down +z; cubes scattered all around it so roughly a
+    // sixth of them land inside the 60 degree frustum
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> pos(-500.0f, 500.0f);
+    for (size_t i = 0; i < entityCount; ++i)
+    {
+        auto e = reg.create();
+        reg.emplace<ZED::TransformComponent>(e, ZED::TransformComponent{
+            .position = ZED::Vec3(pos(rng), pos(rng), pos(rng)),
+            .rotation = ZED::Vec3(0.0f),
+            .scale    = ZED::Vec3(1.0f)
+        });
+    }
+    ZED::TransformSystem::UpdateWorldMatrices(reg);
+
+    const ZED::Mat4 view(1.0f);
+    const ZED::Mat4 proj = ZED::PerspectiveLH_ZO(60.0f * 3.14159265f / 180.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+
+    // Full system: gather world spheres from the ECS, test, compact
+    double bestUpdate = 1e300;
+    for (int i = 0; i < iterations; ++i)
+    {
+        const auto start = Clock::now();
+        ZED::CullingSystem::Update(reg, view, proj);
+        bestUpdate = std::min(bestUpdate, ElapsedNs(start));
+    }
+    const size_t visible = ZED::CullingSystem::GetVisible().size();
+
+    // Kernel only: pre-gathered SoA spheres, single thread
+    std::vector<float> x(entityCount), y(entityCount), z(entityCount), r(entityCount, 1.7320508f);
+    {
+        size_t i = 0;
+        for (auto [e, wm] : reg.view<ZED::WorldMatrixComponent>().each())
+        {
+            x[i] = wm.matrix[3].x;
+            y[i] = wm.matrix[3].y;
+            z[i] = wm.matrix[3].z;
+            ++i;
+        }
+    }
+
+    std::vector<uint32_t> out(entityCount);
+    const ZED::Frustum frustum = ZED::Frustum::FromViewProj(proj * view);
+    double bestKernel = 1e300;
+    size_t kernelVisible = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        const auto start = Clock::now();
+        kernelVisible = ZED::CullingSystem::CullSpheres(frustum, x.data(), y.data(), z.data(), r.data(), entityCount, out.data());
+        bestKernel = std::min(bestKernel, ElapsedNs(start));
+    }
+
+    // Reference: the same test one sphere at a time
+    double bestScalar = 1e300;
+    size_t scalarVisible = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        const auto start = Clock::now();
+        size_t n = 0;
+        for (size_t k = 0; k < entityCount; ++k)
+        {
+            out[n] = static_cast<uint32_t>(k);
+            n += frustum.IntersectsSphere(ZED::Vec3(x[k], y[k], z[k]), r[k]) ? 1 : 0;
+        }
+        scalarVisible = n;
+        bestScalar = std::min(bestScalar, ElapsedNs(start));
+    }
+
+    const double n = static_cast<double>(entityCount);
+    std::cout << "[Bench-Culling] " << entityCount << " entities, " << ZED::JobSystem::GetThreadCount() << " thread(s), best of " << iterations << "\n";
+    std::cout << "  CullingSystem::Update : " << bestUpdate / n << " ns/entity (" << bestUpdate / 1e6 << " ms), "
+              << visible << " visible\n";
+    std::cout << "  CullSpheres (SIMD)    : " << bestKernel / n << " ns/entity, " << kernelVisible << " visible\n";
+    std::cout << "  Scalar reference      : " << bestScalar / n << " ns/entity, " << scalarVisible << " visible\n";
+
+    ZED::JobSystem::Shutdown();
+    return (visible == kernelVisible && kernelVisible == scalarVisible) ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Event throughput benchmark: Bench-Events [events=2000000] [iterations=5]
+//
+// 1, 4 and 16 threads post events while the main thread dispatches them to a subscriber,
+// as the main loop does while input and gameplay modules post. Producers retry when the
+// queue is full. A mutex + std::queue version of the same exchange runs as a reference.
+
+#include "ZEDEngine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Events posted by producer t of threads; the first few threads pick up the remainder
+    uint64_t Share(uint64_t events, int threads, int t)
+    {
+        return events / threads + (static_cast<uint64_t>(t) < events % threads ? 1 : 0);
+    }
+
+    // Post through the EventSystem, dispatch on this thread; returns milliseconds
+    double RunEventSystem(uint64_t events, int threads, uint64_t& received, uint64_t& retries)
+    {
+        auto& system = ZED::EventSystem::Get();
+        received = 0;
+        const int id = system.Subscribe(ZED::EventType::MouseMove, [&received](const ZED::Event&) { ++received; });
+        const uint64_t droppedBefore = system.GetDroppedCount();
+
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> producers;
+        for (int t = 0; t < threads; ++t)
+        {
+            producers.emplace_back([&, t]
+            {
+                const uint64_t count = Share(events, threads, t);
+                while (!go.load(std::memory_order_acquire)) {}
+                for (uint64_t i = 0; i < count; ++i)
+                {
+                    const ZED::Event e{ ZED::EventType::MouseMove, t, static_cast<int>(i), 0, 0 };
+                    while (!system.Post(e))
+                        std::this_thread::yield();
+                }
+            });
+        }
+
+        const auto start = Clock::now();
+        go.store(true, std::memory_order_release);
+        while (received < events)
+        {
+            // Give the producers the core when there was nothing to deliver (matters when
+            // threads outnumber cores)
+            const uint64_t before = received;
+            system.Dispatch();
+            if (received == before)
+                std::this_thread::yield();
+        }
+        const double ms = ElapsedMs(start);
+
+        for (auto& p : producers)
+            p.join();
+        system.Unsubscribe(ZED::EventType::MouseMove, id);
+        retries = system.GetDroppedCount() - droppedBefore;
+        return ms;
+    }
+
+    // The previous design: every post and every pop takes the same lock
+    double RunMutexQueue(uint64_t events, int threads, uint64_t& received)
+    {
+        std::mutex mutex;
+        std::queue<ZED::Event> queue;
+        received = 0;
+
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> producers;
+        for (int t = 0; t < threads; ++t)
+        {
+            producers.emplace_back([&, t]
+            {
+                const uint64_t count = Share(events, threads, t);
+                while (!go.load(std::memory_order_acquire)) {}
+                for (uint64_t i = 0; i < count; ++i)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    queue.push(ZED::Event{ ZED::EventType::MouseMove, t, static_cast<int>(i), 0, 0 });
+                }
+            });
+        }
+
+        const auto start = Clock::now();
+        go.store(true, std::memory_order_release);
+        while (received < events)
+        {
+            const uint64_t before = received;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                while (!queue.empty())
+                {
+                    queue.pop();
+                    ++received;
+                }
+            }
+            if (received == before)
+                std::this_thread::yield();
+        }
+        const double ms = ElapsedMs(start);
+
+        for (auto& p : producers)
+            p.join();
+        return ms;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const uint64_t events = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    const int iterations = std::max(1, argc > 2 ? std::atoi(argv[2]) : 5);
+
+    std::cout << "[Bench-Events] " << events << " events per run, best of " << iterations
+              << ", queue capacity " << ZED::EventSystem::kQueueCapacity << "\n";
+
+    bool ok = true;
+    for (const int threads : { 1, 4, 16 })
+    {
+        double bestRing = 1e300, bestMutex = 1e300;
+        uint64_t retries = 0;
+        for (int i = 0; i < iterations; ++i)
+        {
+            uint64_t received = 0, runRetries = 0;
+            bestRing = std::min(bestRing, RunEventSystem(events, threads, received, runRetries));
+            retries += runRetries;
+            ok = ok && received == events;
+
+            bestMutex = std::min(bestMutex, RunMutexQueue(events, threads, received));
+            ok = ok && received == events;
+        }
+
+        const double n = static_cast<double>(events);
+        std::cout << "  " << threads << " posting thread(s)\n";
+        std::cout << "    EventSystem Post/Dispatch : " << n / bestRing * 1e-3 << " M events/s ("
+                  << bestRing << " ms), " << retries / iterations << " full-queue retries/run\n";
+        std::cout << "    Mutex + std::queue        : " << n / bestMutex * 1e-3 << " M events/s ("
+                  << bestMutex << " ms)\n";
+    }
+
+    return ok ? 0 : 1;
+}
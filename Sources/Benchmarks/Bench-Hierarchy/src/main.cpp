@@ -0,0 +1,182 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Hierarchy propagation benchmark: Bench-Hierarchy [depth=1000] [width=100000] [iterations=20] [workers=0]
+//
+// Two shapes, each in its own registry: a single chain depth levels deep, and one root with
+// width children. For each it times building the links, propagating after the root moves,
+// and re-parenting followed by the incremental re-sort and propagation. A recursive pointer
+// walk over the same links runs as a reference and checks the world matrices.
+
+#include "ZEDEngine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    entt::entity CreateNode(ZED::Registry& reg, float offset)
+    {
+        auto e = reg.create();
+        reg.emplace<ZED::TransformComponent>(e, ZED::TransformComponent{
+            .position = ZED::Vec3(offset, 1.0f, 0.0f),
+            .rotation = ZED::Vec3(0.0f, 0.001f, 0.0f),
+            .scale    = ZED::Vec3(1.0f)
+        });
+        return e;
+    }
+
+    // The naive way: recurse from each root through the child links
+    void ComposeRecursive(ZED::Registry& reg, entt::entity e, const ZED::Mat4& parentWorld, std::vector<ZED::Mat4>& out, std::vector<entt::entity>& order)
+    {
+        const auto& h = reg.get<ZED::HierarchyComponent>(e);
+        const ZED::Mat4 world = parentWorld * ZED::TransformComponent::Compose(reg.get<ZED::TransformComponent>(e));
+        out.push_back(world);
+        order.push_back(e);
+
+        for (entt::entity c = h.firstChild; c != entt::null; c = reg.get<ZED::HierarchyComponent>(c).nextSibling)
+            ComposeRecursive(reg, c, world, out, order);
+    }
+
+    bool Near(const ZED::Mat4& a, const ZED::Mat4& b)
+    {
+        for (int c = 0; c < 4; ++c)
+            for (int r = 0; r < 4; ++r)
+                if (std::abs(a[c][r] - b[c][r]) > 1e-2f * std::max(1.0f, std::abs(b[c][r])))
+                    return false;
+        return true;
+    }
+
+    // build links the hierarchy; reparent moves something and puts it back on alternate calls
+    bool RunCase(const std::string& name, size_t nodeCount, int iterations,
+                 const std::function<entt::entity(ZED::Registry&, std::vector<entt::entity>&)>& build,
+                 const std::function<void(ZED::Registry&, const std::vector<entt::entity>&, bool)>& reparent)
+    {
+        ZED::Registry reg;
+        ZED::TransformSystem::connect(reg);
+        ZED::HierarchySystem::connect(reg);
+
+        std::vector<entt::entity> nodes;
+        nodes.reserve(nodeCount);
+        for (size_t i = 0; i < nodeCount; ++i)
+            nodes.push_back(CreateNode(reg, static_cast<float>(i % 7)));
+
+        auto start = Clock::now();
+        const entt::entity root = build(reg, nodes);
+        const double buildMs = ElapsedMs(start);
+
+        start = Clock::now();
+        ZED::TransformSystem::UpdateWorldMatrices(reg); // includes the first full sort
+        const double firstMs = ElapsedMs(start);
+
+        // Moving the root dirties every world matrix below it
+        double bestPropagate = 1e300;
+        for (int i = 0; i < iterations; ++i)
+        {
+            ZED::TransformSystem::Translate(reg, root, ZED::Vec3(0.0f, 0.0f, 0.001f));
+            start = Clock::now();
+            ZED::TransformSystem::UpdateWorldMatrices(reg);
+            bestPropagate = std::min(bestPropagate, ElapsedMs(start));
+        }
+
+        double bestReparent = 1e300;
+        for (int i = 0; i < iterations; ++i)
+        {
+            start = Clock::now();
+            reparent(reg, nodes, i % 2 == 0);
+            ZED::TransformSystem::UpdateWorldMatrices(reg);
+            bestReparent = std::min(bestReparent, ElapsedMs(start));
+        }
+
+        // Reference, and check the linear pass against it
+        double bestRecursive = 1e300;
+        std::vector<ZED::Mat4> reference;
+        std::vector<entt::entity> order;
+        for (int i = 0; i < iterations; ++i)
+        {
+            reference.clear();
+            order.clear();
+            start = Clock::now();
+            for (auto [e, h] : reg.view<ZED::HierarchyComponent>().each())
+            {
+                if (h.parent == entt::null)
+                    ComposeRecursive(reg, e, ZED::Mat4(1.0f), reference, order);
+            }
+            bestRecursive = std::min(bestRecursive, ElapsedMs(start));
+        }
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < order.size(); ++i)
+            mismatches += Near(reg.get<ZED::WorldMatrixComponent>(order[i]).matrix, reference[i]) ? 0 : 1;
+
+        std::cout << "  " << name << " (" << nodeCount << " entities)\n";
+        std::cout << "    Build links       : " << buildMs << " ms\n";
+        std::cout << "    First update+sort : " << firstMs << " ms\n";
+        std::cout << "    Propagate all     : " << bestPropagate << " ms (" << bestPropagate * 1e6 / static_cast<double>(nodeCount) << " ns/entity)\n";
+        std::cout << "    Re-parent+update  : " << bestReparent << " ms\n";
+        std::cout << "    Recursive walk    : " << bestRecursive << " ms (reference)\n";
+        if (mismatches > 0 || order.size() != nodeCount)
+            std::cout << "    MISMATCH: " << mismatches << " world matrices differ, " << order.size() << " visited\n";
+
+        return mismatches == 0 && order.size() == nodeCount;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t depth = std::max<size_t>(2, argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000);
+    const size_t width = std::max<size_t>(2, argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100000);
+    const int iterations = std::max(1, argc > 3 ? std::atoi(argv[3]) : 20);
+    const long workers = argc > 4 ? std::atol(argv[4]) : 0;
+
+    ZED::JobSystem::Init(workers > 0 ? static_cast<uint32_t>(workers) : 0);
+    std::cout << "[Bench-Hierarchy] " << ZED::JobSystem::GetThreadCount() << " thread(s), best of " << iterations << "\n";
+
+    // Chain: nodes[i] is the parent of nodes[i + 1]. Re-parenting moves the lower half of
+    // the chain to the root and back, changing the depth of every node in it.
+    const bool deepOk = RunCase("Deep: " + std::to_string(depth) + " levels", depth, iterations,
+        [](ZED::Registry& reg, std::vector<entt::entity>& nodes)
+        {
+            for (size_t i = 1; i < nodes.size(); ++i)
+                ZED::HierarchySystem::SetParent(reg, nodes[i], nodes[i - 1]);
+            return nodes.front();
+        },
+        [](ZED::Registry& reg, const std::vector<entt::entity>& nodes, bool away)
+        {
+            const size_t mid = nodes.size() / 2;
+            ZED::HierarchySystem::SetParent(reg, nodes[mid], away ? nodes.front() : nodes[mid - 1]);
+        });
+
+    // Fan: every other node is a child of nodes[0]. Re-parenting moves 100 of them under a
+    // sibling and back, the incremental (insertion sort) case.
+    const bool wideOk = RunCase("Wide: " + std::to_string(width) + " siblings", width + 1, iterations,
+        [](ZED::Registry& reg, std::vector<entt::entity>& nodes)
+        {
+            for (size_t i = 1; i < nodes.size(); ++i)
+                ZED::HierarchySystem::SetParent(reg, nodes[i], nodes[0]);
+            return nodes.front();
+        },
+        [](ZED::Registry& reg, const std::vector<entt::entity>& nodes, bool away)
+        {
+            const size_t moved = std::min<size_t>(100, nodes.size() - 2);
+            for (size_t i = 0; i < moved; ++i)
+                ZED::HierarchySystem::SetParent(reg, nodes[nodes.size() - 1 - i], away ? nodes[1] : nodes[0]);
+        });
+
+    ZED::JobSystem::Shutdown();
+    return deepOk && wideOk ? 0 : 1;
+}
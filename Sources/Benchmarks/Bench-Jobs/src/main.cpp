@@ -0,0 +1,102 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Job system scaling benchmark: Bench-Jobs [transforms=1000000] [maxThreads=hardware] [iterations=20]
+//
+// Runs ParallelForEach over every TransformComponent at 1, 2, 4, ... maxThreads job system
+// threads: a SpinAll-style rotation pass and a world-matrix composition pass.
+
+#include "ZEDEngine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t transformCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    const uint32_t maxThreads = argc > 2 ? std::max(1, std::atoi(argv[2])) : hardware;
+    const int iterations = std::max(1, argc > 3 ? std::atoi(argv[3]) : 20);
+
+    ZED::Registry reg;
+    for (size_t i = 0; i < transformCount; ++i)
+    {
+        auto e = reg.create();
+        const float f = static_cast<float>(i % 1000);
+        reg.emplace<ZED::TransformComponent>(e, ZED::TransformComponent{
+            .position = ZED::Vec3(f, f * 0.5f, -f),
+            .rotation = ZED::Vec3(0.0f),
+            .scale    = ZED::Vec3(1.0f)
+        });
+        reg.emplace<ZED::WorldMatrixComponent>(e);
+    }
+
+    std::vector<uint32_t> threadCounts;
+    for (uint32_t t = 1; t < maxThreads; t *= 2)
+        threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    std::cout << "[Bench-Jobs] " << transformCount << " transforms, " << hardware
+              << " hardware thread(s), best of " << iterations << "\n";
+
+    const ZED::Vec3 delta(0.01f, 0.02f, 0.03f);
+    double baseSpin = 0.0, baseCompose = 0.0;
+    for (const uint32_t threads : threadCounts)
+    {
+        // One thread runs everything inline; otherwise the caller is worker 0
+        if (threads > 1)
+            ZED::JobSystem::Init(threads - 1);
+
+        double bestSpin = 1e300;
+        for (int i = 0; i < iterations; ++i)
+        {
+            const auto start = Clock::now();
+            ZED::ParallelForEach(reg.view<ZED::TransformComponent>(), [&](entt::entity, ZED::TransformComponent& tr)
+            {
+                tr.rotation += delta;
+            });
+            bestSpin = std::min(bestSpin, ElapsedMs(start));
+        }
+
+        double bestCompose = 1e300;
+        for (int i = 0; i < iterations; ++i)
+        {
+            const auto start = Clock::now();
+            ZED::ParallelForEach(reg.view<ZED::TransformComponent, ZED::WorldMatrixComponent>(),
+                [](entt::entity, const ZED::TransformComponent& tr, ZED::WorldMatrixComponent& wm)
+            {
+                wm.matrix = ZED::TransformComponent::Compose(tr);
+            }, 256);
+            bestCompose = std::min(bestCompose, ElapsedMs(start));
+        }
+
+        if (threads == 1)
+        {
+            baseSpin = bestSpin;
+            baseCompose = bestCompose;
+        }
+
+        std::cout << "  " << ZED::JobSystem::GetThreadCount() << " thread(s): spin " << bestSpin << " ms ("
+                  << baseSpin / bestSpin << "x), compose " << bestCompose << " ms ("
+                  << baseCompose / bestCompose << "x)\n";
+
+        ZED::JobSystem::Shutdown();
+    }
+
+    return 0;
+}
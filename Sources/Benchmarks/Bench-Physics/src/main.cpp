@@ -0,0 +1,310 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Physics benchmark: Bench-Physics [config=Configs/zedengine_headless.ini] [physicsLib] [scale=1]
+// Runs the same headless scenes on whichever backend is loaded (physicsLib overrides the
+// [Modules] Physics entry), so running it once per backend gives an A/B comparison:
+//   Pile      10k boxes dropped in a jittered heap
+//   Stacks    100 columns of 20 boxes; reports how many are still standing
+//   Chains    100 hanging 20-link chains joined by point joints
+//   Sleeping  10k boxes resting apart on the floor; measured after they fall asleep
+//   Raycasts  10k rays per frame into the sleeping scene
+// Every scene steps at [Time] FixedTimeStep through PhysicsSystem, so update times include
+// the transform write-back. Memory is the peak heap held by the backend library during the scene.
+// scale multiplies body and chain counts.
+//
+// The Jolt figures are unverified. Thirdparty/jolt ships without Jolt/Core/Core.h, so the Jolt
+// module has only been run against a stand-in config, and on that build Stacks columns topple
+// unless SolverIterations is raised to ~40. The transform round trip, mass override and convex
+// radius were ruled out; until a stock Jolt build confirms or fixes this, don't quote Jolt
+// numbers from this suite.
+
+#include "ZEDEngine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+typedef ZED::IPhysics* (*CreatePhysicsFunc)();
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    struct SceneResult
+    {
+        double setupMs = 0.0;
+        double stepMs = 0.0;
+        double peakStepMs = 0.0;
+        double updateMs = 0.0;
+        size_t peakMemory = 0;
+        int settledFrame = -1;
+        ZED::PhysicsStats end;
+    };
+
+    entt::entity SpawnBox(ZED::Registry& reg, const ZED::Vec3& position, const ZED::Vec3& rotation,
+                          const ZED::Vec3& scale, ZED::BodyMotion motion = ZED::BodyMotion::Dynamic)
+    {
+        auto e = reg.create();
+        reg.emplace<ZED::TransformComponent>(e, ZED::TransformComponent{
+            .position = position,
+            .rotation = rotation,
+            .scale    = scale
+        });
+        reg.emplace<ZED::ColliderComponent>(e);
+        reg.emplace<ZED::RigidBodyComponent>(e, ZED::RigidBodyComponent{ .motion = motion });
+        return e;
+    }
+
+    // Top face at y = 0
+    void SpawnFloor(ZED::Registry& reg)
+    {
+        SpawnBox(reg, ZED::Vec3(0.0f, -1.0f, 0.0f), ZED::Vec3(0.0f), ZED::Vec3(300.0f, 1.0f, 300.0f), ZED::BodyMotion::Static);
+    }
+
+    // spawn fills the registry, ready runs once the bodies exist (joints), after runs before teardown
+    SceneResult RunScene(ZED::IPhysics& physics, int frames, int measureFrom,
+                         const std::function<void(ZED::Registry&)>& spawn,
+                         const std::function<void(ZED::Registry&, ZED::IPhysics&)>& ready = {},
+                         const std::function<void(ZED::Registry&, ZED::IPhysics&)>& after = {})
+    {
+        SceneResult result;
+        physics.Init();
+        ZED::FixedTimestep::InitFromConfig();
+
+        ZED::Registry reg;
+        ZED::TransformSystem::connect(reg);
+        ZED::PhysicsSystem::connect(reg);
+        spawn(reg);
+
+        const auto setupStart = Clock::now();
+        ZED::PhysicsSystem::CreatePendingBodies(reg);
+        if (ready) ready(reg, physics);
+        result.setupMs = ElapsedMs(setupStart);
+
+        const float dt = static_cast<float>(ZED::FixedTimestep::GetStep());
+        int measured = 0;
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            const auto start = Clock::now();
+            ZED::PhysicsSystem::FixedUpdate(reg, dt);
+            const double updateMs = ElapsedMs(start);
+            ZED::TransformSystem::UpdateWorldMatrices(reg);
+
+            const ZED::PhysicsStats stats = physics.GetStats();
+            result.peakMemory = std::max(result.peakMemory, stats.memoryBytes);
+            if (result.settledFrame < 0 && stats.activeBodies == 0)
+                result.settledFrame = frame;
+
+            if (frame >= measureFrom)
+            {
+                result.stepMs += stats.lastStepMs;
+                result.peakStepMs = std::max(result.peakStepMs, stats.lastStepMs);
+                result.updateMs += updateMs;
+                ++measured;
+            }
+        }
+
+        if (measured > 0)
+        {
+            result.stepMs /= measured;
+            result.updateMs /= measured;
+        }
+        result.end = physics.GetStats();
+
+        if (after) after(reg, physics);
+
+        // Shut down first so the registry teardown doesn't remove bodies one by one
+        physics.Shutdown();
+        reg.clear();
+        return result;
+    }
+
+    void Print(const char* name, const SceneResult& r)
+    {
+        std::cout << "  " << std::left << std::setw(9) << name << std::right
+                  << r.end.bodies << " bodies, " << r.end.joints << " joints | setup " << r.setupMs
+                  << " ms | step avg " << r.stepMs << " ms, peak " << r.peakStepMs
+                  << " ms | update avg " << r.updateMs << " ms | memory "
+                  << static_cast<double>(r.peakMemory) / (1024.0 * 1024.0) << " MB | awake at end "
+                  << r.end.activeBodies;
+        if (r.settledFrame >= 0) std::cout << ", all asleep from frame " << r.settledFrame;
+        std::cout << "\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const char* configPath = argc > 1 ? argv[1] : "Configs/zedengine_headless.ini";
+    const double scale = argc > 3 ? std::max(0.01, std::atof(argv[3])) : 1.0;
+
+    ZED::Config::Load(configPath);
+    const std::string physicsLib = argc > 2 ? argv[2] : ZED::Config::Get().GetValue("Modules", "Physics", "");
+    if (physicsLib.empty() || !ZED::Module::ModuleLoader::LoadModule("Physics", physicsLib))
+    {
+        std::cerr << "[Bench-Physics] No physics module to load\n";
+        return 1;
+    }
+
+    auto createPhysics = (CreatePhysicsFunc)ZED::Module::ModuleLoader::GetFunction("Physics", "CreatePhysics");
+    if (!createPhysics)
+    {
+        std::cerr << "[Bench-Physics] CreatePhysics not found in " << physicsLib << "\n";
+        return 1;
+    }
+
+    ZED::JobSystem::InitFromConfig();
+    ZED::IPhysics* physics = createPhysics();
+
+    auto scaled = [&](int n) { return std::max(1, static_cast<int>(std::lround(n * scale))); };
+    std::vector<SceneResult> results;
+    std::vector<const char*> names;
+
+    // Pile: square layers of half-size boxes, jittered so the heap topples instead of stacking
+    {
+        const int boxes = scaled(10000);
+        const int side = std::max(1, static_cast<int>(std::ceil(std::sqrt(boxes / 16.0))));
+        names.push_back("Pile");
+        results.push_back(RunScene(*physics, 600, 0, [&](ZED::Registry& reg)
+        {
+            SpawnFloor(reg);
+            std::mt19937 rng(7);
+            std::uniform_real_distribution<float> jitter(-0.1f, 0.1f);
+            for (int i = 0; i < boxes; ++i)
+            {
+                const int layer = i / (side * side);
+                const int x = i % side;
+                const int z = (i / side) % side;
+                SpawnBox(reg, ZED::Vec3((x - side * 0.5f) * 1.2f + jitter(rng), 1.0f + layer * 1.2f, (z - side * 0.5f) * 1.2f + jitter(rng)),
+                         ZED::Vec3(jitter(rng), jitter(rng) * 5.0f, jitter(rng)), ZED::Vec3(0.5f));
+            }
+        }));
+    }
+
+    // Stacks: columns of unit boxes placed exactly on top of each other
+    {
+        constexpr int kHeight = 20;
+        const int columns = scaled(100);
+        const int side = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(columns)))));
+        std::vector<entt::entity> tops;
+        names.push_back("Stacks");
+        results.push_back(RunScene(*physics, 600, 0, [&](ZED::Registry& reg)
+        {
+            SpawnFloor(reg);
+            for (int c = 0; c < columns; ++c)
+            {
+                const float x = (c % side - side * 0.5f) * 3.0f;
+                const float z = (c / side - side * 0.5f) * 3.0f;
+                for (int level = 0; level < kHeight; ++level)
+                {
+                    const auto e = SpawnBox(reg, ZED::Vec3(x, 0.5f + level, z), ZED::Vec3(0.0f), ZED::Vec3(0.5f));
+                    if (level == kHeight - 1) tops.push_back(e);
+                }
+            }
+        }, {}, [&](ZED::Registry& reg, ZED::IPhysics&)
+        {
+            int standing = 0;
+            for (const auto e : tops)
+                standing += reg.get<ZED::TransformComponent>(e).position.y > kHeight - 1.0f ? 1 : 0;
+            std::cout << "[Bench-Physics] Stacks: " << standing << "/" << tops.size() << " columns still standing\n";
+        }));
+    }
+
+    // Chains: links start horizontal and swing down from a static anchor, like limp ragdoll limbs
+    {
+        constexpr int kLinks = 20;
+        const int chains = scaled(100);
+        std::vector<std::vector<entt::entity>> links(chains);
+        std::vector<entt::entity> anchors(chains);
+        names.push_back("Chains");
+        results.push_back(RunScene(*physics, 600, 0, [&](ZED::Registry& reg)
+        {
+            for (int c = 0; c < chains; ++c)
+            {
+                const float z = c * 1.5f;
+                anchors[c] = SpawnBox(reg, ZED::Vec3(-0.1f, 30.0f, z), ZED::Vec3(0.0f), ZED::Vec3(0.1f), ZED::BodyMotion::Static);
+                for (int i = 0; i < kLinks; ++i)
+                    links[c].push_back(SpawnBox(reg, ZED::Vec3(i + 0.5f, 30.0f, z), ZED::Vec3(0.0f), ZED::Vec3(0.45f, 0.1f, 0.1f)));
+            }
+        }, [&](ZED::Registry& reg, ZED::IPhysics& p)
+        {
+            for (int c = 0; c < chains; ++c)
+            {
+                entt::entity previous = anchors[c];
+                for (int i = 0; i < kLinks; ++i)
+                {
+                    p.CreatePointJoint(reg.get<ZED::RigidBodyComponent>(previous).handle,
+                                       reg.get<ZED::RigidBodyComponent>(links[c][i]).handle,
+                                       ZED::Vec3(static_cast<float>(i), 30.0f, c * 1.5f));
+                    previous = links[c][i];
+                }
+            }
+        }));
+    }
+
+    // Sleeping: boxes resting apart on the floor; only the second half is measured.
+    // The raycast storm runs against the same settled scene before it is torn down.
+    {
+        const int boxes = scaled(10000);
+        const int side = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(boxes)))));
+        const float half = side * 1.0f;
+        names.push_back("Sleeping");
+        results.push_back(RunScene(*physics, 600, 300, [&](ZED::Registry& reg)
+        {
+            SpawnFloor(reg);
+            for (int i = 0; i < boxes; ++i)
+                SpawnBox(reg, ZED::Vec3((i % side) * 2.0f - half, 0.5f, (i / side) * 2.0f - half), ZED::Vec3(0.0f), ZED::Vec3(0.5f));
+        }, {}, [&](ZED::Registry&, ZED::IPhysics& p)
+        {
+            constexpr int kRays = 10000;
+            constexpr int kFrames = 60;
+            std::mt19937 rng(99);
+            std::uniform_real_distribution<float> where(-half, half);
+            std::uniform_real_distribution<float> tilt(-0.2f, 0.2f);
+
+            size_t hits = 0;
+            ZED::PhysicsRayHit hit;
+            const auto start = Clock::now();
+            for (int frame = 0; frame < kFrames; ++frame)
+            {
+                for (int i = 0; i < kRays; ++i)
+                {
+                    const ZED::Vec3 origin(where(rng), 20.0f, where(rng));
+                    // Rays that miss the boxes land on the floor, so count box hits only
+                    if (p.CastRay(origin, ZED::Vec3(tilt(rng), -1.0f, tilt(rng)), 50.0f, hit) && hit.position.y > 0.01f)
+                        ++hits;
+                }
+            }
+            const double ms = ElapsedMs(start);
+            std::cout << "[Bench-Physics] Raycasts: " << kRays << " rays x " << kFrames << " frames in " << ms << " ms ("
+                      << kRays * kFrames / ms << " rays/ms, "
+                      << 100.0 * static_cast<double>(hits) / (kRays * kFrames) << "% hit a box)\n";
+        }));
+    }
+
+    std::cout << "[Bench-Physics] " << physics->GetName() << " at " << ZED::FixedTimestep::GetStep() * 1000.0
+              << " ms per step\n";
+    if (std::string(physics->GetName()) == "Jolt")
+        std::cout << "[Bench-Physics] Jolt results are unverified, see the note at the top of Bench-Physics\n";
+    for (size_t i = 0; i < results.size(); ++i)
+        Print(names[i], results[i]);
+
+    delete physics;
+
+    ZED::JobSystem::Shutdown();
+    ZED::Module::ModuleLoader::Cleanup();
+    return 0;
+}
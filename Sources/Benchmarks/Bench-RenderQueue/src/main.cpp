@@ -0,0 +1,192 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Render queue self-check: Bench-RenderQueue [packets=100000] [iterations=20] [workers=0]
+//
+// Job system threads record packets with shuffled sort keys, RenderQueue::Flush() hands them
+// to a NullRenderer, and what it recorded is checked against a std::sort of the same keys:
+// batches in ascending state order, one per pass + material run, with the right instance
+// counts. Runs once small enough for the comparison sort and once on the radix sort path.
+// The NullRenderer's instanced-batch counters have to show one DrawCubes() per batch, and a
+// Sandbox-style frame (every cube opaque, material 0) has to reach it as a single DrawCubes().
+// Exits non-zero on a mismatch.
+
+#include "ZEDEngine.h"
+#include "Renderer-Null/NullRenderer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    constexpr uint32_t kMaterials = 64;
+
+    // Every pass, kMaterials materials, depths on both sides of the camera
+    std::vector<uint64_t> MakeKeys(size_t count, std::mt19937& rng)
+    {
+        std::uniform_int_distribution<int> pass(0, 2);
+        std::uniform_int_distribution<uint32_t> material(0, kMaterials - 1);
+        std::uniform_real_distribution<float> depth(-50.0f, 500.0f);
+
+        std::vector<uint64_t> keys(count);
+        for (uint64_t& key : keys)
+            key = ZED::RenderKey::Make(static_cast<ZED::RenderPass>(pass(rng)), material(rng), depth(rng));
+        return keys;
+    }
+
+    // What the queue should submit: the sorted keys split into runs of equal state bits
+    std::vector<ZED::NullRenderer::RecordedBatch> ExpectedBatches(std::vector<uint64_t> keys)
+    {
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<ZED::NullRenderer::RecordedBatch> batches;
+        for (const uint64_t key : keys)
+        {
+            const uint64_t state = ZED::RenderKey::GetStateBits(key);
+            if (batches.empty() || batches.back().stateKey != state)
+                batches.push_back({ state, 0 });
+            ++batches.back().instances;
+        }
+        return batches;
+    }
+
+    bool SameBatches(const std::vector<ZED::NullRenderer::RecordedBatch>& a, const std::vector<ZED::NullRenderer::RecordedBatch>& b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& x, const auto& y)
+        {
+            return x.stateKey == y.stateKey && x.instances == y.instances;
+        });
+    }
+
+    // Record keys from the job system threads and flush them as one frame
+    void RecordAndFlush(ZED::NullRenderer& renderer, const std::vector<uint64_t>& keys, double& bestFlush)
+    {
+        ZED::RenderQueue::Begin();
+        ZED::JobSystem::ParallelFor(keys.size(), 1024, [&](size_t begin, size_t end)
+        {
+            for (size_t k = begin; k < end; ++k)
+                ZED::RenderQueue::GetList().DrawCube(keys[k], ZED::Mat4(1.0f));
+        });
+
+        renderer.BeginFrame(0.0f, 0.0f, 0.0f, 1.0f, ZED::Mat4(1.0f), ZED::Mat4(1.0f));
+        const auto start = Clock::now();
+        ZED::RenderQueue::Flush(renderer);
+        bestFlush = std::min(bestFlush, ElapsedMs(start));
+        renderer.EndFrame();
+    }
+
+    // Every batch of the last frame went out as one instanced DrawCubes() call
+    bool OneDrawCubesPerBatch(const ZED::NullRenderStats& before, const ZED::NullRenderStats& after, size_t batches, size_t count)
+    {
+        return after.lastFrameDrawCalls == batches && after.lastFrameInstances == count &&
+               after.instancedBatches - before.instancedBatches == batches &&
+               after.drawCalls - before.drawCalls == batches &&
+               after.instances - before.instances == count;
+    }
+
+    bool RunCase(ZED::NullRenderer& renderer, size_t count, int iterations, std::mt19937& rng)
+    {
+        std::vector<uint64_t> keys = MakeKeys(count, rng);
+        const auto expected = ExpectedBatches(keys);
+
+        double bestFlush = 1e300;
+        uint32_t sortPasses = 0;
+        int mismatches = 0;
+        for (int i = 0; i < iterations; ++i)
+        {
+            // New order every frame, recorded across however many lists the job system has
+            std::shuffle(keys.begin(), keys.end(), rng);
+            const ZED::NullRenderStats before = renderer.GetStats();
+            RecordAndFlush(renderer, keys, bestFlush);
+
+            const ZED::RenderQueueStats& stats = ZED::RenderQueue::GetLastStats();
+            sortPasses = stats.sortPasses;
+            const bool ok = SameBatches(renderer.GetLastSubmission(), expected) &&
+                            stats.packets == count && stats.batches == expected.size() &&
+                            OneDrawCubesPerBatch(before, renderer.GetStats(), expected.size(), count);
+            mismatches += ok ? 0 : 1;
+        }
+
+        std::cout << "  " << count << " packets -> " << expected.size() << " batches, "
+                  << sortPasses << " radix pass(es)\n";
+        std::cout << "    Flush : " << bestFlush << " ms (" << bestFlush * 1e6 / static_cast<double>(count) << " ns/packet)\n";
+        if (mismatches > 0)
+            std::cout << "    MISMATCH: " << mismatches << "/" << iterations << " submissions differ from std::sort or weren't one DrawCubes per batch\n";
+
+        return mismatches == 0;
+    }
+
+    // The Sandbox frame: every visible cube is opaque with material 0, so the whole frame is
+    // one batch and the backend sees exactly one DrawCubes()
+    bool RunSingleBatch(ZED::NullRenderer& renderer, size_t count, int iterations, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> depth(0.1f, 1000.0f);
+        std::vector<uint64_t> keys(count);
+        for (uint64_t& key : keys)
+            key = ZED::RenderKey::Make(ZED::RenderPass::Opaque, 0, depth(rng));
+
+        double bestFlush = 1e300;
+        int mismatches = 0;
+        for (int i = 0; i < iterations; ++i)
+        {
+            const ZED::NullRenderStats before = renderer.GetStats();
+            RecordAndFlush(renderer, keys, bestFlush);
+
+            const auto& submission = renderer.GetLastSubmission();
+            const bool ok = submission.size() == 1 && submission[0].instances == count &&
+                            OneDrawCubesPerBatch(before, renderer.GetStats(), 1, count);
+            mismatches += ok ? 0 : 1;
+        }
+
+        std::cout << "  " << count << " packets, one material -> 1 DrawCubes per frame\n";
+        std::cout << "    Flush : " << bestFlush << " ms (" << bestFlush * 1e6 / static_cast<double>(count) << " ns/packet)\n";
+        if (mismatches > 0)
+            std::cout << "    MISMATCH: " << mismatches << "/" << iterations << " frames were not a single instanced batch\n";
+
+        return mismatches == 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t packets = std::max<size_t>(1, argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000);
+    const int iterations = std::max(1, argc > 2 ? std::atoi(argv[2]) : 20);
+    const long workers = argc > 3 ? std::atol(argv[3]) : 0;
+
+    ZED::JobSystem::Init(workers > 0 ? static_cast<uint32_t>(workers) : 0);
+    std::cout << "[Bench-RenderQueue] " << ZED::JobSystem::GetThreadCount() << " thread(s), best of " << iterations << "\n";
+
+    ZED::NullRenderer renderer;
+    renderer.Init(nullptr, 800, 600);
+
+    std::mt19937 rng(1234);
+    bool ok = RunCase(renderer, 200, iterations, rng);
+    ok = RunCase(renderer, packets, iterations, rng) && ok;
+    ok = RunSingleBatch(renderer, packets, iterations, rng) && ok;
+
+    // The NullRenderer flags any batch whose state key went backwards within a submission
+    const ZED::NullRenderStats& stats = renderer.GetStats();
+    const uint64_t flushes = static_cast<uint64_t>(3 * iterations);
+    if (stats.unsortedBatches != 0 || stats.submissions != flushes || stats.frames != flushes)
+    {
+        std::cout << "  MISMATCH: " << stats.unsortedBatches << " unsorted batches, " << stats.submissions
+                  << " submissions and " << stats.frames << " frames for " << flushes << " flushes\n";
+        ok = false;
+    }
+
+    renderer.Shutdown();
+    ZED::JobSystem::Shutdown();
+    return ok ? 0 : 1;
+}
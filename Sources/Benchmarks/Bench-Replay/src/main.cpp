@@ -0,0 +1,308 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Session replay benchmark: Bench-Replay <session.zinp> [config=Configs/zedengine_headless.ini] [histogram.csv]
+// Plays back a session recorded through the Input-Replay module ([InputReplay] Mode=Record) with
+// no window and no renderer. Each recorded frame's delta time and input go through the event
+// system and the Update, FixedUpdate and PostUpdate systems Sandbox runs, scripts and physics
+// included, for exactly as many frames as were recorded. The scene comes from [Scene] LoadFile,
+// so record with [Scene] SaveFile set and replay against that file. Scripting and physics are
+// loaded from [Modules], the replay module from [InputReplay] Module.
+// Prints frame time percentiles and a histogram with 4 buckets per octave, plus the final state
+// hash: runs of two builds that end on the same hash simulated the same session, so their frame
+// times compare like for like. histogram.csv gets every bucket, for diffing or plotting.
+
+#include "ZEDEngine.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef ZED::IScripting* (*CreateScriptingFunc)();
+typedef ZED::IPhysics* (*CreatePhysicsFunc)();
+typedef int64_t (*RegisterReplayFunc)(const char* path);
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Bucket i holds frames of [2^(i/4), 2^((i+1)/4)) microseconds, 1 us to about 16 s
+    constexpr int kBucketsPerOctave = 4;
+    constexpr int kBucketCount = 24 * kBucketsPerOctave;
+
+    double BucketLowerMs(int bucket)
+    {
+        return std::exp2(static_cast<double>(bucket) / kBucketsPerOctave) / 1000.0;
+    }
+
+    int BucketOf(double ms)
+    {
+        const double us = std::max(ms * 1000.0, 1.0);
+        return std::min(static_cast<int>(std::floor(std::log2(us) * kBucketsPerOctave)), kBucketCount - 1);
+    }
+
+    // Nearest-rank percentile of sorted frame times
+    double Percentile(const std::vector<double>& sorted, double p)
+    {
+        const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(sorted.size())));
+        return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+    }
+
+    void Report(const std::vector<double>& frameMs, const std::string& csvPath)
+    {
+        if (frameMs.empty()) return;
+
+        std::vector<double> sorted = frameMs;
+        std::sort(sorted.begin(), sorted.end());
+        double total = 0.0;
+        for (const double ms : frameMs) total += ms;
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << "[Bench-Replay] " << frameMs.size() << " frames in " << total << " ms | mean "
+                  << total / static_cast<double>(frameMs.size()) << " | p50 " << Percentile(sorted, 50.0) << " | p90 "
+                  << Percentile(sorted, 90.0) << " | p99 " << Percentile(sorted, 99.0) << " | p99.9 "
+                  << Percentile(sorted, 99.9) << " | max " << sorted.back() << " ms\n";
+
+        std::array<size_t, kBucketCount> buckets{};
+        for (const double ms : frameMs) ++buckets[BucketOf(ms)];
+        const size_t peak = *std::max_element(buckets.begin(), buckets.end());
+
+        for (int b = 0; b < kBucketCount; ++b)
+        {
+            if (buckets[b] == 0) continue;
+            const size_t bar = std::max<size_t>(1, buckets[b] * 50 / peak);
+            std::cout << "  " << std::setw(9) << BucketLowerMs(b) << " - " << std::setw(9) << BucketLowerMs(b + 1) << " ms "
+                      << std::setw(7) << buckets[b] << " " << std::string(bar, '#') << "\n";
+        }
+        std::cout << std::defaultfloat;
+
+        if (csvPath.empty()) return;
+
+        std::ofstream csv(csvPath, std::ios::out | std::ios::trunc);
+        if (!csv)
+        {
+            std::cerr << "[Bench-Replay] Can't write " << csvPath << "\n";
+            return;
+        }
+        csv << "lower_ms,upper_ms,frames\n" << std::setprecision(6);
+        for (int b = 0; b < kBucketCount; ++b)
+            csv << BucketLowerMs(b) << ',' << BucketLowerMs(b + 1) << ',' << buckets[b] << '\n';
+        std::cout << "[Bench-Replay] Histogram written to " << csvPath << "\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: Bench-Replay <session.zinp> [config=Configs/zedengine_headless.ini] [histogram.csv]\n";
+        return 1;
+    }
+    const std::string sessionPath = argv[1];
+    const char* configPath = argc > 2 ? argv[2] : "Configs/zedengine_headless.ini";
+    const std::string csvPath = argc > 3 ? argv[3] : "";
+
+    ZED::Config::Load(configPath);
+    ZED::Memory::InitFromConfig();
+    const auto& ini = ZED::Config::Get();
+
+    // No window, time or renderer modules: the replay module is the clock and the input
+    const std::string replayLib = ini.GetValue("InputReplay", "Module", "");
+    if (replayLib.empty() || !ZED::Module::ModuleLoader::LoadModule("Input", replayLib))
+    {
+        std::cerr << "[Bench-Replay] No [InputReplay] Module to load\n";
+        return 1;
+    }
+    for (const char* module : { "Scripting", "Physics" })
+    {
+        const std::string lib = ini.GetValue("Modules", module, "");
+        if (!lib.empty())
+            ZED::Module::ModuleLoader::LoadModule(module, lib);
+    }
+
+    auto registerReplay = (RegisterReplayFunc)ZED::Module::ModuleLoader::GetFunction("Input", "RegisterReplay");
+    if (!registerReplay)
+    {
+        std::cerr << "[Bench-Replay] RegisterReplay not found in " << replayLib << "\n";
+        return 1;
+    }
+    const int64_t frames = registerReplay(sessionPath.c_str());
+    if (frames < 0)
+        return 1;
+
+    ZED::Profiler::InitFromConfig();
+    ZED_PROFILE_THREAD("Main");
+    ZED::JobSystem::InitFromConfig();
+
+    // Lockstep has to be known before the scripting VM installs math.random
+    ZED::FixedTimestep::InitFromConfig();
+    ZED::Determinism::InitFromConfig();
+
+    ZED::IScripting* scripting = nullptr;
+    if (auto createScripting = (CreateScriptingFunc)
+        ZED::Module::ModuleLoader::GetFunction("Scripting", "CreateScripting"))
+    {
+        scripting = createScripting();
+    }
+
+    ZED::IPhysics* physics = nullptr;
+    if (auto createPhysics = (CreatePhysicsFunc)
+        ZED::Module::ModuleLoader::GetFunction("Physics", "CreatePhysics"))
+    {
+        physics = createPhysics();
+        if (!physics->Init())
+        {
+            std::cerr << "[Bench-Replay] Failed to init physics\n";
+            ZED::Physics::SetImplementation(nullptr);
+            delete physics;
+            physics = nullptr;
+        }
+    }
+
+    auto* input = ZED::Input::GetInput();
+    ZED::Determinism::AttachInput(input);
+
+    auto& reg = ZED::ECS::ECS::Registry();
+    ZED::ScriptLifecycleSystem::connect(reg);
+    ZED::TransformSystem::connect(reg);
+    ZED::HierarchySystem::connect(reg);
+    ZED::SpatialIndex::connect(reg);
+    ZED::PhysicsSystem::connect(reg);
+    ZED::InterpolationSystem::connect(reg);
+
+    const std::string sceneFile = ini.GetValue("Scene", "LoadFile", "");
+    if (sceneFile.empty() || !ZED::Scene::Load(reg, sceneFile))
+        std::cerr << "[Bench-Replay] No scene loaded; set [Scene] LoadFile to the scene the session was recorded in\n";
+
+    // Same camera setup as Sandbox, so recorded camera input moves it the same way
+    ZED::CameraSystem::Init();
+    ZED::CameraSystem::SetAspect(static_cast<float>(800) / static_cast<float>(600));
+    ZED::CameraController::SetEnabled(true);
+    ZED::CameraController::SetMoveSpeed(5.0f);
+    ZED::CameraController::SetMouseSensitivity(0.002f);
+
+    // Sandbox's systems up to and including culling; without a renderer nothing is recorded or drawn
+    ZED::SystemScheduler::InitFromConfig();
+    {
+        using namespace ZED;
+
+        SystemScheduler::Add(SystemPhase::Update, "CameraController", [](Registry& r, double dt)
+        {
+            CameraController::Update(r, dt);
+        }).Reads<CameraComponent>().Writes<TransformComponent, TransformDirty>().WritesResource<CameraController>();
+
+        SystemScheduler::Add(SystemPhase::FixedUpdate, "InterpolationCapture", [](Registry& r, double)
+        {
+            InterpolationSystem::Capture(r);
+        }).Reads<TransformComponent>().Writes<PreviousTransformComponent>();
+
+        SystemScheduler::Add(SystemPhase::FixedUpdate, "Scripts", [](Registry& r, double dt)
+        {
+            ScriptUpdateSystem::tick(r, dt);
+        }).Exclusive();
+
+        SystemScheduler::Add(SystemPhase::FixedUpdate, "Physics", [](Registry& r, double dt)
+        {
+            PhysicsSystem::FixedUpdate(r, static_cast<float>(dt));
+        }).Reads<ColliderComponent>().Writes<RigidBodyComponent, TransformComponent, TransformDirty>().WritesResource<IPhysics>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "Transforms", [](Registry& r, double)
+        {
+            TransformSystem::UpdateWorldMatrices(r);
+        }).Reads<TransformComponent, HierarchyComponent>().Writes<WorldMatrixComponent, TransformDirty>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "SpatialIndex", [](Registry& r, double)
+        {
+            SpatialIndex::Update(r);
+        }).Reads<WorldMatrixComponent, BoundsComponent, HierarchyComponent>().WritesResource<SpatialIndex>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "Interpolation", [](Registry& r, double)
+        {
+            InterpolationSystem::Update(r, static_cast<float>(FixedTimestep::GetAlpha()));
+        }).Reads<TransformComponent, WorldMatrixComponent, HierarchyComponent>().Writes<PreviousTransformComponent>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "Camera", [](Registry& r, double)
+        {
+            CameraSystem::Update(r);
+        }).Reads<CameraComponent, TransformComponent, WorldMatrixComponent>().WritesResource<CameraSystem>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "Culling", [](Registry& r, double)
+        {
+            CullingSystem::Update(r, CameraSystem::GetView(), CameraSystem::GetProj());
+        }).Reads<WorldMatrixComponent, BoundsComponent, CameraComponent>().ReadsResource<CameraSystem>().WritesResource<CullingSystem>();
+    }
+
+    std::vector<double> frameMs;
+    frameMs.reserve(static_cast<size_t>(frames));
+    for (int64_t frame = 0; frame < frames; ++frame)
+    {
+        const auto start = Clock::now();
+        ZED::Profiler::NewFrame();
+        {
+            ZED_PROFILE_SCOPE("Frame");
+
+            // Moves the replay to this frame: the recorded delta time, then its input
+            ZED::Time::Update();
+            double deltaTime = ZED::Time::GetDeltaTime();
+            if (ZED::Determinism::IsEnabled())
+                deltaTime = ZED::FixedTimestep::GetStep();
+
+            input->PollEvents();
+            ZED::EventSystem::Get().DispatchDeferred();
+            ZED::EventSystem::Get().Dispatch();
+
+            ZED::SystemScheduler::Run(ZED::SystemPhase::Update, reg, deltaTime);
+
+            const uint32_t steps = ZED::FixedTimestep::Advance(deltaTime);
+            const uint64_t firstTick = ZED::FixedTimestep::GetTick() - steps;
+            for (uint32_t i = 0; i < steps; ++i)
+            {
+                ZED::Determinism::BeginTick(firstTick + i);
+                ZED::SystemScheduler::Run(ZED::SystemPhase::FixedUpdate, reg, ZED::FixedTimestep::GetStep());
+                ZED::Determinism::EndTick(reg);
+            }
+
+            ZED::SystemScheduler::Run(ZED::SystemPhase::PostUpdate, reg, deltaTime);
+            ZED::Memory::EndFrame();
+        }
+        frameMs.push_back(ElapsedMs(start));
+    }
+
+    Report(frameMs, csvPath);
+
+    ZED::StateHash hash;
+    std::cout << "[Bench-Replay] " << ZED::FixedTimestep::GetTick() << " fixed steps, final state hash " << std::hex
+              << std::setw(16) << std::setfill('0') << hash.Compute(reg) << std::dec << std::setfill(' ') << "\n";
+
+    ZED::Profiler::Shutdown();
+    ZED::Determinism::Shutdown();
+    ZED::SystemScheduler::DumpTimings(std::cout);
+    ZED::SystemScheduler::Clear();
+    ZED::JobSystem::Shutdown();
+
+    if (physics)
+        physics->Shutdown();
+    if (scripting)
+    {
+        ZED::Scripting::ReportTopScripts(std::cout);
+        scripting->Shutdown();
+    }
+    delete physics;
+    delete scripting;
+
+    ZED::Module::ModuleLoader::Cleanup();
+    return 0;
+}
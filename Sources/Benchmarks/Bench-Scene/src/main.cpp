@@ -0,0 +1,179 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Scene file benchmark: Bench-Scene [entities=1000000] [file=bench_scene.zscn] [mode=all|save|load]
+//   save  builds a scene entity by entity (transform + bounds on every entity, 1 in 8 interpolated,
+//         1 in 16 parented to the previous entity, 1 in 32 with a rigid body) and writes it out
+//   load  maps the file into a bare registry, then again into one with the transform, hierarchy
+//         and spatial systems connected, and reports wall times and the process' peak RSS
+//   all   runs save in a child process first, so the peak RSS reported by load is the load's own
+// Both modes print a checksum of the transforms; they match when the round trip is exact.
+
+#include "ZEDEngine.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+    #include <Windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    double PeakRssMB()
+    {
+    #if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS pmc{};
+        GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
+        return static_cast<double>(pmc.PeakWorkingSetSize) / (1024.0 * 1024.0);
+    #else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        #if defined(__APPLE__)
+            return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0); // bytes
+        #else
+            return static_cast<double>(usage.ru_maxrss) / 1024.0;            // KiB
+        #endif
+    #endif
+    }
+
+    // Order-independent, so it doesn't care how the entities were numbered
+    double TransformChecksum(const ZED::Registry& reg)
+    {
+        double sum = 0.0;
+        for (auto [e, tr] : reg.view<ZED::TransformComponent>().each())
+            sum += tr.position.x + 2.0 * tr.position.y + 3.0 * tr.position.z + tr.rotation.y + tr.scale.x;
+        return sum;
+    }
+
+    void PrintCounts(const ZED::Registry& reg)
+    {
+        std::cout << "  transforms " << reg.view<ZED::TransformComponent>().size()
+                  << ", hierarchy " << reg.view<ZED::HierarchyComponent>().size()
+                  << ", rigid bodies " << reg.view<ZED::RigidBodyComponent>().size()
+                  << ", interpolated " << reg.view<ZED::PreviousTransformComponent>().size()
+                  << " | checksum " << std::setprecision(12) << TransformChecksum(reg)
+                  << std::setprecision(6) << "\n";
+    }
+
+    int Save(size_t entityCount, const std::string& file)
+    {
+        ZED::Registry reg;
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> pos(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+
+        const auto buildStart = Clock::now();
+        entt::entity previous = entt::null;
+        for (size_t i = 0; i < entityCount; ++i)
+        {
+            const entt::entity e = reg.create();
+            reg.emplace<ZED::TransformComponent>(e, ZED::TransformComponent{
+                .position = ZED::Vec3(pos(rng), pos(rng), pos(rng)),
+                .rotation = ZED::Vec3(0.0f, angle(rng), 0.0f),
+                .scale    = ZED::Vec3(1.0f)
+            });
+            reg.emplace<ZED::BoundsComponent>(e);
+
+            if (i % 8 == 0) reg.emplace<ZED::PreviousTransformComponent>(e);
+            if (i % 16 == 1 && previous != entt::null) ZED::HierarchySystem::SetParent(reg, e, previous);
+            if (i % 32 == 2)
+            {
+                reg.emplace<ZED::ColliderComponent>(e);
+                reg.emplace<ZED::RigidBodyComponent>(e);
+            }
+            previous = e;
+        }
+
+        auto camera = reg.create();
+        reg.emplace<ZED::TransformComponent>(camera);
+        reg.emplace<ZED::CameraComponent>(camera, ZED::CameraComponent{ .primary = true });
+        const double buildMs = ElapsedMs(buildStart);
+
+        std::cout << "[Bench-Scene] Built " << entityCount + 1 << " entities one by one in " << buildMs << " ms\n";
+        PrintCounts(reg);
+
+        const auto saveStart = Clock::now();
+        if (!ZED::Scene::Save(reg, file)) return 1;
+        std::cout << "[Bench-Scene] Save " << ElapsedMs(saveStart) << " ms, "
+                  << static_cast<double>(std::filesystem::file_size(file)) / (1024.0 * 1024.0) << " MB on disk\n";
+        return 0;
+    }
+
+    int Load(const std::string& file)
+    {
+        // Mapping only, no systems listening: the cost of the format itself
+        double bareMs = 0.0;
+        {
+            ZED::Registry reg;
+            const auto start = Clock::now();
+            if (!ZED::Scene::Load(reg, file)) return 1;
+            bareMs = ElapsedMs(start);
+
+            std::cout << "[Bench-Scene] Load into a bare registry: " << bareMs << " ms\n";
+            PrintCounts(reg);
+        }
+
+        // What a game pays: construction signals plus the first world matrix and spatial index update
+        {
+            ZED::Registry reg;
+            ZED::TransformSystem::connect(reg);
+            ZED::HierarchySystem::connect(reg);
+            ZED::SpatialIndex::connect(reg);
+            ZED::InterpolationSystem::connect(reg);
+
+            const auto start = Clock::now();
+            if (!ZED::Scene::Load(reg, file)) return 1;
+            const double loadMs = ElapsedMs(start);
+
+            const auto updateStart = Clock::now();
+            ZED::TransformSystem::UpdateWorldMatrices(reg);
+            ZED::SpatialIndex::Update(reg);
+            const double updateMs = ElapsedMs(updateStart);
+
+            std::cout << "[Bench-Scene] Load with systems connected: " << loadMs << " ms, first world matrix + spatial update "
+                      << updateMs << " ms\n";
+        }
+
+        std::cout << "[Bench-Scene] Peak RSS " << PeakRssMB() << " MB\n";
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const long entities = argc > 1 ? std::atol(argv[1]) : 1000000;
+    const size_t entityCount = static_cast<size_t>(std::max(1L, entities));
+    const std::string file = argc > 2 ? argv[2] : "bench_scene.zscn";
+    const std::string mode = argc > 3 ? argv[3] : "all";
+
+    if (mode == "save") return Save(entityCount, file);
+    if (mode == "load") return Load(file);
+
+    // Separate process for the build, so its memory doesn't show up in the load's peak RSS
+    const std::string saveCommand = "\"" + std::string(argv[0]) + "\" " + std::to_string(entityCount) + " \"" + file + "\" save";
+    std::cout.flush();
+    if (std::system(saveCommand.c_str()) != 0)
+    {
+        std::cerr << "[Bench-Scene] Save step failed\n";
+        return 1;
+    }
+    return Load(file);
+}
@@ -0,0 +1,237 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Snapshot ring benchmark: Bench-Snapshot [entities=100000] [iterations=100] [changedPercent=1]
+// Every entity has a transform and bounds, 1 in 8 is interpolated, 1 in 16 is parented and 1 in
+// 32 has a rigid body. Times full and delta captures, and restores after every transform
+// changed, after changedPercent of them changed, after nothing changed, and after entities
+// were destroyed and created. Each restore is checked against the captured transforms.
+
+#include "ZEDEngine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    double TransformChecksum(const ZED::Registry& reg)
+    {
+        double sum = 0.0;
+        for (auto [e, tr] : reg.view<ZED::TransformComponent>().each())
+            sum += entt::to_integral(e) * (tr.position.x + 2.0 * tr.position.y + 3.0 * tr.position.z + tr.rotation.y);
+        return sum;
+    }
+
+    void Build(ZED::Registry& reg, size_t entityCount)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> pos(-500.0f, 500.0f);
+
+        entt::entity previous = entt::null;
+        for (size_t i = 0; i < entityCount; ++i)
+        {
+            const entt::entity e = reg.create();
+            reg.emplace<ZED::TransformComponent>(e, ZED::TransformComponent{ .position = ZED::Vec3(pos(rng), pos(rng), pos(rng)) });
+            reg.emplace<ZED::BoundsComponent>(e);
+
+            if (i % 8 == 0) reg.emplace<ZED::PreviousTransformComponent>(e);
+            if (i % 16 == 1 && previous != entt::null) ZED::HierarchySystem::SetParent(reg, e, previous);
+            if (i % 32 == 2)
+            {
+                reg.emplace<ZED::ColliderComponent>(e);
+                reg.emplace<ZED::RigidBodyComponent>(e);
+            }
+            previous = e;
+        }
+        ZED::TransformSystem::UpdateWorldMatrices(reg);
+    }
+
+    // Move a random subset of transforms the way gameplay would, through the transform system
+    void Move(ZED::Registry& reg, const std::vector<entt::entity>& entities, size_t count, std::mt19937& rng)
+    {
+        std::uniform_int_distribution<size_t> pick(0, entities.size() - 1);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t index = count == entities.size() ? i : pick(rng);
+            ZED::TransformSystem::Translate(reg, entities[index], ZED::Vec3(0.25f, 0.0f, 0.0f));
+        }
+        ZED::TransformSystem::UpdateWorldMatrices(reg);
+    }
+
+    struct Timing
+    {
+        double totalMs = 0.0;
+        double peakMs = 0.0;
+
+        void Add(double ms)
+        {
+            totalMs += ms;
+            peakMs = std::max(peakMs, ms);
+        }
+    };
+
+    void Print(const char* label, const Timing& t, int iterations)
+    {
+        std::cout << "  " << label << " avg " << t.totalMs / iterations << " ms, peak " << t.peakMs << " ms\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t entityCount = static_cast<size_t>(std::max(1L, argc > 1 ? std::atol(argv[1]) : 100000L));
+    const int iterations = std::max(1, argc > 2 ? std::atoi(argv[2]) : 100);
+    const double changedPercent = std::clamp(argc > 3 ? std::atof(argv[3]) : 1.0, 0.0, 100.0);
+
+    ZED::Registry reg;
+    ZED::TransformSystem::connect(reg);
+    ZED::HierarchySystem::connect(reg);
+    ZED::InterpolationSystem::connect(reg);
+    Build(reg, entityCount);
+
+    std::vector<entt::entity> entities;
+    for (auto e : reg.view<ZED::TransformComponent>())
+        entities.push_back(e);
+
+    const size_t changed = std::max<size_t>(1, static_cast<size_t>(entityCount * changedPercent / 100.0));
+    std::mt19937 rng(42);
+    bool ok = true;
+
+    std::cout << "[Bench-Snapshot] " << entityCount << " entities, " << iterations << " iterations, "
+              << changed << " transforms changed per delta\n";
+
+    // Full snapshots only
+    {
+        ZED::SnapshotRing ring(4, 1);
+        ring.Reserve(reg);
+
+        Timing capture, restoreAll, restoreSome, restoreNone;
+        for (int i = 0; i < iterations; ++i)
+        {
+            auto start = Clock::now();
+            ring.Capture(reg, i);
+            capture.Add(ElapsedMs(start));
+            const double expected = TransformChecksum(reg);
+
+            Move(reg, entities, entities.size(), rng);
+            start = Clock::now();
+            ring.Restore(reg, i);
+            restoreAll.Add(ElapsedMs(start));
+            ok &= TransformChecksum(reg) == expected;
+            ZED::TransformSystem::UpdateWorldMatrices(reg);
+
+            Move(reg, entities, changed, rng);
+            start = Clock::now();
+            ring.Restore(reg, i);
+            restoreSome.Add(ElapsedMs(start));
+            ok &= TransformChecksum(reg) == expected;
+            ZED::TransformSystem::UpdateWorldMatrices(reg);
+
+            start = Clock::now();
+            ring.Restore(reg, i);
+            restoreNone.Add(ElapsedMs(start));
+
+            // Drift a little so the next capture differs from this one
+            Move(reg, entities, changed, rng);
+        }
+
+        ZED::SnapshotInfo info;
+        ring.GetInfo(iterations - 1, info);
+        std::cout << "[Bench-Snapshot] Keyframes (" << info.bytes / 1024 << " KB each, ring holds "
+                  << ring.GetMemoryUsage() / 1024 << " KB)\n";
+        Print("capture                 ", capture, iterations);
+        Print("restore, all changed    ", restoreAll, iterations);
+        Print("restore, some changed   ", restoreSome, iterations);
+        Print("restore, nothing changed", restoreNone, iterations);
+    }
+
+    // A keyframe followed by deltas, as a rollback ring would capture every tick
+    {
+        constexpr size_t kInterval = 8;
+        ZED::SnapshotRing ring(kInterval, kInterval);
+        ring.Reserve(reg);
+
+        Timing keyframe, delta, restoreDelta;
+        size_t keyframeBytes = 0, deltaBytes = 0;
+        int deltas = 0;
+        for (int i = 0; i < iterations; ++i)
+        {
+            auto start = Clock::now();
+            ring.Capture(reg, i);
+            const double ms = ElapsedMs(start);
+
+            ZED::SnapshotInfo info;
+            ring.GetInfo(i, info);
+            if (info.delta)
+            {
+                delta.Add(ms);
+                deltaBytes += info.bytes;
+                ++deltas;
+            }
+            else
+            {
+                keyframe.Add(ms);
+                keyframeBytes = info.bytes;
+            }
+
+            const double expected = TransformChecksum(reg);
+            Move(reg, entities, changed, rng);
+            start = Clock::now();
+            ring.Restore(reg, i);
+            restoreDelta.Add(ElapsedMs(start));
+            ok &= TransformChecksum(reg) == expected;
+
+            Move(reg, entities, changed, rng);
+        }
+
+        std::cout << "[Bench-Snapshot] Deltas every tick, keyframe every " << kInterval << " (keyframe "
+                  << keyframeBytes / 1024 << " KB, delta avg " << (deltas ? deltaBytes / deltas / 1024 : 0) << " KB)\n";
+        Print("keyframe capture        ", keyframe, std::max(1, iterations - deltas));
+        Print("delta capture           ", delta, std::max(1, deltas));
+        Print("restore                 ", restoreDelta, iterations);
+    }
+
+    // Entities destroyed and created since the capture: the structural path
+    {
+        ZED::SnapshotRing ring(2, 1);
+        Timing restoreStructural;
+        for (int i = 0; i < iterations; ++i)
+        {
+            ring.Capture(reg, i);
+            const double expected = TransformChecksum(reg);
+            const size_t alive = reg.storage<entt::entity>().free_list();
+
+            std::uniform_int_distribution<size_t> pick(0, entities.size() - 1);
+            for (size_t k = 0; k < changed; ++k)
+            {
+                const entt::entity e = entities[pick(rng)];
+                if (reg.valid(e)) reg.destroy(e);
+            }
+            for (size_t k = 0; k < changed; ++k)
+                reg.emplace<ZED::TransformComponent>(reg.create());
+
+            const auto start = Clock::now();
+            ring.Restore(reg, i);
+            restoreStructural.Add(ElapsedMs(start));
+            ok &= TransformChecksum(reg) == expected && reg.storage<entt::entity>().free_list() == alive;
+            ZED::TransformSystem::UpdateWorldMatrices(reg);
+        }
+
+        std::cout << "[Bench-Snapshot] Structural changes (" << changed << " destroyed, " << changed << " created)\n";
+        Print("restore                 ", restoreStructural, iterations);
+    }
+
+    std::cout << "[Bench-Snapshot] Restored state " << (ok ? "matches" : "DOES NOT MATCH") << " every capture\n";
+    return ok ? 0 : 1;
+}
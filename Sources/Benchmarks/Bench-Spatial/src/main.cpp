@@ -0,0 +1,239 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+// Spatial index benchmark: Bench-Spatial [entities=100000] [frames=100] [movingPercent=10]
+// Compares keeping a DynamicAABBTree in sync by incremental re-insertion, refitting and full
+// rebuilds while a fraction of the objects moves every frame, then the ECS-driven SpatialIndex.
+
+#include "ZEDEngine.h"
+#include "Engine/Spatial/DynamicAABBTree.h"
+#include "Engine/Spatial/SpatialIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedNs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    constexpr float kWorldHalfSize = 500.0f;
+    constexpr float kRadius = 1.7320508f;
+    constexpr float kQueryRadius = 20.0f;
+    constexpr int kQueriesPerFrame = 256;
+
+    enum class Strategy { Incremental, Refit, Rebuild };
+
+    struct Result
+    {
+        double updateNs = 0.0;
+        double queryNs = 0.0;
+        size_t hits = 0;
+        int32_t height = 0;
+        float areaRatio = 0.0f;
+    };
+
+    // Every entity of r whose bounding sphere touches the probe, by brute force over the world matrices
+    std::vector<entt::entity> BruteForce(const ZED::Registry& r, const ZED::Vec3& probe, float probeRadius)
+    {
+        std::vector<entt::entity> hits;
+        for (auto [e, wm] : r.view<ZED::WorldMatrixComponent>().each())
+        {
+            const ZED::Vec3 d = ZED::Vec3(wm.matrix[3]) - probe;
+            const float reach = probeRadius + kRadius;
+            if (glm::dot(d, d) <= reach * reach)
+                hits.push_back(e);
+        }
+        std::sort(hits.begin(), hits.end());
+        return hits;
+    }
+
+    // Replays the same motion and query sequence for every strategy so the numbers compare
+    Result Run(Strategy strategy, const std::vector<ZED::Vec3>& start, int frames, size_t moving)
+    {
+        std::vector<ZED::Vec3> centers = start;
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<size_t> pick(0, centers.size() - 1);
+        std::uniform_real_distribution<float> step(-0.5f, 0.5f);
+        std::uniform_real_distribution<float> where(-kWorldHalfSize, kWorldHalfSize);
+
+        ZED::DynamicAABBTree tree(strategy == Strategy::Incremental ? 0.25f : 0.0f);
+        std::vector<int32_t> proxies(centers.size());
+        for (size_t i = 0; i < centers.size(); ++i)
+            proxies[i] = tree.CreateProxy(ZED::AABB::FromSphere(centers[i], kRadius), static_cast<uint32_t>(i));
+        tree.Rebuild();
+
+        Result result;
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            const auto updateStart = Clock::now();
+            for (size_t k = 0; k < moving; ++k)
+            {
+                const size_t i = pick(rng);
+                centers[i] += ZED::Vec3(step(rng), step(rng), step(rng));
+                const ZED::AABB box = ZED::AABB::FromSphere(centers[i], kRadius);
+
+                if (strategy == Strategy::Incremental)
+                    tree.MoveProxy(proxies[i], box);
+                else
+                    tree.SetProxyBounds(proxies[i], box);
+            }
+            if (strategy == Strategy::Refit)
+                tree.Refit();
+            else if (strategy == Strategy::Rebuild)
+                tree.Rebuild();
+            result.updateNs += ElapsedNs(updateStart);
+
+            const auto queryStart = Clock::now();
+            for (int q = 0; q < kQueriesPerFrame; ++q)
+            {
+                const ZED::Vec3 c(where(rng), where(rng), where(rng));
+                tree.Query(ZED::AABB::FromSphere(c, kQueryRadius), [&](int32_t proxy)
+                {
+                    const ZED::Vec3 d = centers[tree.GetUserData(proxy)] - c;
+                    const float reach = kQueryRadius + kRadius;
+                    result.hits += glm::dot(d, d) <= reach * reach ? 1 : 0;
+                    return true;
+                });
+            }
+            result.queryNs += ElapsedNs(queryStart);
+        }
+
+        result.updateNs /= frames;
+        result.queryNs /= frames;
+        result.height = tree.GetHeight();
+        result.areaRatio = tree.GetAreaRatio();
+        return result;
+    }
+
+    void Print(const char* name, const Result& r)
+    {
+        std::cout << "  " << name << ": update " << r.updateNs / 1e3 << " us/frame, "
+                  << kQueriesPerFrame << " queries " << r.queryNs / 1e3 << " us/frame, height "
+                  << r.height << ", area ratio " << r.areaRatio << ", hits " << r.hits << "\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t entityCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    const int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 100;
+    const double movingPercent = argc > 3 ? std::atof(argv[3]) : 10.0;
+    const size_t moving = static_cast<size_t>(static_cast<double>(entityCount) * movingPercent / 100.0);
+
+    if (entityCount == 0) return 1;
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> pos(-kWorldHalfSize, kWorldHalfSize);
+    std::vector<ZED::Vec3> centers(entityCount);
+    for (auto& c : centers)
+        c = ZED::Vec3(pos(rng), pos(rng), pos(rng));
+
+    std::cout << "[Bench-Spatial] " << entityCount << " entities, " << moving << " moving per frame, "
+              << frames << " frames\n";
+
+    const Result incremental = Run(Strategy::Incremental, centers, frames, moving);
+    const Result refit = Run(Strategy::Refit, centers, frames, moving);
+    const Result rebuild = Run(Strategy::Rebuild, centers, frames, moving);
+    Print("Incremental (fat AABB)", incremental);
+    Print("Refit                 ", refit);
+    Print("Rebuild               ", rebuild);
+
+    // End to end through the ECS: MarkDirty -> UpdateWorldMatrices -> SpatialIndex::Update
+    ZED::Registry reg;
+    ZED::TransformSystem::connect(reg);
+    ZED::SpatialIndex::connect(reg);
+
+    std::vector<entt::entity> entities(entityCount);
+    for (size_t i = 0; i < entityCount; ++i)
+    {
+        entities[i] = reg.create();
+        reg.emplace<ZED::TransformComponent>(entities[i], ZED::TransformComponent{
+            .position = centers[i],
+            .rotation = ZED::Vec3(0.0f),
+            .scale    = ZED::Vec3(1.0f)
+        });
+    }
+    ZED::TransformSystem::UpdateWorldMatrices(reg);
+    ZED::SpatialIndex::Update(reg);
+
+    std::uniform_int_distribution<size_t> pick(0, entityCount - 1);
+    std::uniform_real_distribution<float> step(-0.5f, 0.5f);
+    double ecsNs = 0.0;
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        for (size_t k = 0; k < moving; ++k)
+            ZED::TransformSystem::Translate(reg, entities[pick(rng)], ZED::Vec3(step(rng), step(rng), step(rng)));
+
+        const auto start = Clock::now();
+        ZED::TransformSystem::UpdateWorldMatrices(reg);
+        ZED::SpatialIndex::Update(reg);
+        ecsNs += ElapsedNs(start);
+    }
+
+    // A second registry with its own index, crowded around the probe. Its entity ids overlap
+    // the first registry's, so any state shared between the two indices shows up below.
+    ZED::Registry other;
+    ZED::TransformSystem::connect(other);
+    ZED::SpatialIndex::connect(other);
+    std::uniform_real_distribution<float> near(-40.0f, 40.0f);
+    const size_t otherCount = std::max<size_t>(1, entityCount / 10);
+    std::vector<entt::entity> otherEntities(otherCount);
+    for (auto& e : otherEntities)
+    {
+        e = other.create();
+        other.emplace<ZED::TransformComponent>(e, ZED::TransformComponent{
+            .position = ZED::Vec3(near(rng), near(rng), near(rng)),
+            .rotation = ZED::Vec3(0.0f),
+            .scale    = ZED::Vec3(1.0f)
+        });
+    }
+    ZED::TransformSystem::UpdateWorldMatrices(other);
+    ZED::SpatialIndex::Update(other);
+
+    // Interleave moves in both registries, then destroy some of the second one's entities
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        for (size_t k = 0; k < moving; ++k)
+        {
+            ZED::TransformSystem::Translate(reg, entities[pick(rng)], ZED::Vec3(step(rng), step(rng), step(rng)));
+            ZED::TransformSystem::Translate(other, otherEntities[k % otherCount], ZED::Vec3(step(rng), step(rng), step(rng)));
+        }
+        ZED::TransformSystem::UpdateWorldMatrices(reg);
+        ZED::SpatialIndex::Update(reg);
+        ZED::TransformSystem::UpdateWorldMatrices(other);
+        ZED::SpatialIndex::Update(other);
+    }
+    for (size_t k = 0; k < otherCount; k += 3)
+        other.destroy(otherEntities[k]);
+
+    // Cross-check one query per registry against brute force over the world matrices
+    const ZED::Vec3 probe(0.0f);
+    const float probeRadius = 50.0f;
+    std::vector<entt::entity> found, otherFound;
+    ZED::SpatialIndex::QuerySphere(reg, probe, probeRadius, found);
+    ZED::SpatialIndex::QuerySphere(other, probe, probeRadius, otherFound);
+    std::sort(found.begin(), found.end());
+    std::sort(otherFound.begin(), otherFound.end());
+
+    const std::vector<entt::entity> expected = BruteForce(reg, probe, probeRadius);
+    const std::vector<entt::entity> otherExpected = BruteForce(other, probe, probeRadius);
+
+    std::cout << "  SpatialIndex (ECS)    : world matrices + index update " << ecsNs / frames / 1e3
+              << " us/frame, probe query " << found.size() << " hits (brute force " << expected.size() << ")\n";
+    std::cout << "  Second registry       : probe query " << otherFound.size() << " hits (brute force "
+              << otherExpected.size() << ")\n";
+
+    const bool consistent = incremental.hits == refit.hits && refit.hits == rebuild.hits
+                         && found == expected && otherFound == otherExpected;
+    return consistent ? 0 : 1;
+}
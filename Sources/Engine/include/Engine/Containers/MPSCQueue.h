@@ -0,0 +1,120 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ZED
+{
+    /**
+     * Bounded multi-producer / single-consumer ring buffer.
+     *
+     * Every slot carries a sequence number so producers only contend on a
+     * single fetch-add style CAS of the enqueue cursor and never take a lock.
+     * The consumer side is wait-free. Storage is fixed at compile time so
+     * pushing and popping never allocate.
+     *
+     * Capacity must be a power of two. Push() returns false when the queue is
+     * full instead of blocking; callers decide whether to drop or retry.
+     */
+    template <typename T, size_t Capacity>
+    class MPSCQueue
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "MPSCQueue capacity must be a power of two");
+        static_assert(std::is_trivially_copyable_v<T>, "MPSCQueue only stores trivially copyable payloads");
+
+    public:
+        MPSCQueue()
+        {
+            for (size_t i = 0; i < Capacity; ++i)
+                m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        MPSCQueue(const MPSCQueue&) = delete;
+        MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+        // Safe to call from any thread
+        bool Push(const T& value)
+        {
+            size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Slot& slot = m_Slots[pos & kMask];
+                const size_t seq = slot.sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        slot.value = value;
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // Consumer hasn't freed this slot yet: queue is full
+                    return false;
+                }
+                else
+                {
+                    pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Consumer thread only
+        bool Pop(T& out)
+        {
+            Slot& slot = m_Slots[m_DequeuePos & kMask];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            if (seq != m_DequeuePos + 1)
+                return false; // empty, or a producer is still writing this slot
+
+            out = slot.value;
+            slot.sequence.store(m_DequeuePos + Capacity, std::memory_order_release);
+            ++m_DequeuePos;
+            return true;
+        }
+
+        // Consumer thread only. Ticket of the next element Pop() will return;
+        // combine with EnqueueTicket() to drain only what was queued up to a point.
+        size_t DequeueTicket() const { return m_DequeuePos; }
+
+        // Ticket that the next successful Push() will claim
+        size_t EnqueueTicket() const { return m_EnqueuePos.load(std::memory_order_acquire); }
+
+        bool Empty() const { return EnqueueTicket() == m_DequeuePos; }
+
+        static constexpr size_t GetCapacity() { return Capacity; }
+
+    private:
+        static constexpr size_t kMask = Capacity - 1;
+
+        static constexpr size_t kCacheLine = 64;
+
+        struct Slot
+        {
+            std::atomic<size_t> sequence{0};
+            T value{};
+        };
+
+        std::array<Slot, Capacity> m_Slots;
+
+        // Producers and the consumer hammer different cursors; keep them apart
+        alignas(kCacheLine) std::atomic<size_t> m_EnqueuePos{0};
+        alignas(kCacheLine) size_t m_DequeuePos = 0;
+    };
+}
+
+#endif // MPSCQUEUE_H
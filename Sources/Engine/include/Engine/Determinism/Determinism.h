@@ -0,0 +1,94 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef DETERMINISM_H
+#define DETERMINISM_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+#include "Engine/Events/Event.h"
+#include "Engine/Interfaces/Input/IInput.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ZED
+{
+    // An input event and the fixed step it takes effect on
+    struct InputRecord
+    {
+        uint64_t tick = 0;
+        uint32_t sequence = 0; // arrival order within the tick
+        InputEvent event{};
+    };
+
+    /**
+     * Deterministic (lockstep) mode: two runs fed the same input produce the same simulation,
+     * tick for tick, and a per-tick state hash shows where they part ways.
+     *
+     * When enabled:
+     *  - FixedTimestep runs exactly one step per frame and every phase is given the step as its
+     *    dt, so nothing downstream sees wall-clock time.
+     *  - Events from IInput are recorded into one ordered stream. Those that arrive during a
+     *    frame are stamped with the next tick; BeginTick() applies them to the key state that
+     *    IsKeyDown() reports for the whole tick, and scripts get them through OnEvent, in
+     *    arrival order, before their update.
+     *  - Scripts' math.random/math.randomseed draw from one seeded generator (xoshiro256**)
+     *    instead of Luau's per-VM one, which is seeded from the clock.
+     *  - EndTick() updates a StateHash of the registry and physics bodies and, if a hash file
+     *    is set, writes "tick hash" per line, so two logs can be compared with diff or cmp.
+     */
+    class ZEDENGINE_API Determinism
+    {
+    public:
+        // Read [Determinism] Enabled / Seed / HashFile / VerifyInterval from the loaded INI.
+        // Call after FixedTimestep::InitFromConfig() and before scripting is initialised.
+        static void InitFromConfig();
+
+        // Flush the hash log and print a summary
+        static void Shutdown();
+
+        static bool IsEnabled();
+
+        // Record input's events into the stream; replaces its event callback. No-op when disabled.
+        static void AttachInput(IInput* input);
+
+        // Add an event to the stream by hand (a replay, a network peer); it applies to the next tick
+        static void RecordInput(const InputEvent& e);
+
+        // Start of a fixed step: stamp the events recorded since the last one with tick, in
+        // arrival order, and apply them to the key state
+        static void BeginTick(uint64_t tick);
+
+        // End of a fixed step: hash the state and log it; returns the hash (0 when disabled)
+        static uint64_t EndTick(const Registry& reg);
+
+        // Tick passed to the last BeginTick()
+        static uint64_t GetTick();
+
+        // The current tick's events, in order
+        static std::span<const InputRecord> GetTickInput();
+
+        // Every event since InitFromConfig(), ordered by tick then sequence
+        static const std::vector<InputRecord>& GetInputStream();
+
+        // Key state as of the start of the current tick
+        static bool IsKeyDown(Key key);
+
+        // The payload scripts and the event system see for an input event
+        static Event ToEvent(const InputEvent& e);
+
+        // Seeded generator for everything the simulation randomises
+        static void Seed(uint64_t seed);
+        static uint64_t NextRandom();
+        static double RandomUnit(); // [0, 1)
+
+        // Hash written by the last EndTick()
+        static uint64_t GetLastHash();
+    };
+}
+
+#endif
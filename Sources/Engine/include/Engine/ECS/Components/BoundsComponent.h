@@ -0,0 +1,37 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef BOUNDSCOMPONENT_H
+#define BOUNDSCOMPONENT_H
+
+#pragma once
+
+#include "Engine/Math/Math.h"
+
+namespace ZED
+{
+    // Local-space bounding sphere used for culling. Entities without one are treated
+    // as the renderer's unit cube (-1..1 on every axis).
+    struct BoundsComponent
+    {
+        Vec3 center{ 0.0f };
+        float radius = 1.7320508f; // sqrt(3): encloses the unit cube
+    };
+
+    // World-space sphere (xyz = center, w = radius) for a world matrix and optional bounds.
+    // Non-uniform scale grows the radius to cover the longest scaled axis.
+    inline Vec4 ComputeWorldSphere(const Mat4& m, const BoundsComponent* bounds)
+    {
+        const BoundsComponent local = bounds ? *bounds : BoundsComponent{};
+        const Vec3 center = bounds ? Vec3(m * Vec4(local.center, 1.0f)) : Vec3(m[3]);
+
+        const float scale2 = glm::max(glm::dot(Vec3(m[0]), Vec3(m[0])),
+                             glm::max(glm::dot(Vec3(m[1]), Vec3(m[1])),
+                                      glm::dot(Vec3(m[2]), Vec3(m[2]))));
+
+        return Vec4(center, local.radius * std::sqrt(scale2));
+    }
+}
+
+#endif
@@ -0,0 +1,34 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef COLLIDERCOMPONENT_H
+#define COLLIDERCOMPONENT_H
+
+#pragma once
+
+#include "Engine/Math/Math.h"
+#include <cstdint>
+
+namespace ZED
+{
+    enum class ColliderShape : uint8_t
+    {
+        Box,
+        Sphere,
+        Capsule, // along local Y
+    };
+
+    // Collision shape in local space, scaled by the entity's TransformComponent scale when
+    // the body is created. Defaults match the renderer's unit cube (-1..1).
+    struct ColliderComponent
+    {
+        ColliderShape shape = ColliderShape::Box;
+
+        Vec3  halfExtents{ 1.0f }; // Box
+        float radius     = 1.0f;   // Sphere, Capsule
+        float halfHeight = 0.5f;   // Capsule: half length of the cylinder part
+    };
+}
+
+#endif
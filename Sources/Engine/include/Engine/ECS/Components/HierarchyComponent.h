@@ -0,0 +1,35 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef HIERARCHYCOMPONENT_H
+#define HIERARCHYCOMPONENT_H
+
+#pragma once
+
+#include "entt/entt.hpp"
+#include <cstdint>
+
+namespace ZED
+{
+    // Parent/child links stored intrusively (first child + sibling list) so the
+    // component stays trivially copyable and needs no per-entity allocation.
+    // Don't edit the links by hand; go through HierarchySystem::SetParent().
+    struct HierarchyComponent
+    {
+        entt::entity parent      = entt::null;
+        entt::entity firstChild  = entt::null;
+        entt::entity prevSibling = entt::null;
+        entt::entity nextSibling = entt::null;
+        uint32_t     childCount  = 0;
+
+        // Distance from the root; the storage is kept sorted by this so parents
+        // are always visited before their children
+        uint32_t depth = 0;
+
+        // Set during propagation when this entity's world matrix changed this frame
+        bool worldChanged = false;
+    };
+}
+
+#endif
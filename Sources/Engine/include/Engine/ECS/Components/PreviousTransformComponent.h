@@ -0,0 +1,30 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef PREVIOUSTRANSFORMCOMPONENT_H
+#define PREVIOUSTRANSFORMCOMPONENT_H
+
+#pragma once
+
+#include "Engine/Math/Math.h"
+
+namespace ZED
+{
+    // Opt-in render interpolation. The simulation moves in fixed steps, so an entity drawn at
+    // its TransformComponent pose visibly stutters whenever the frame rate and step rate differ.
+    // Entities carrying this component are drawn between their pose at the start of the last
+    // step and their current pose instead, one step behind but smooth.
+    struct PreviousTransformComponent
+    {
+        // TransformComponent as it was when the last fixed step began
+        Vec3 position{ 0.0f, 0.0f, 0.0f };
+        Vec3 rotation{ 0.0f, 0.0f, 0.0f }; // Euler XYZ in radians
+        Vec3 scale   { 1.0f, 1.0f, 1.0f };
+
+        // World matrix to draw this frame, written by InterpolationSystem::Update()
+        Mat4 renderMatrix{ 1.0f };
+    };
+}
+
+#endif
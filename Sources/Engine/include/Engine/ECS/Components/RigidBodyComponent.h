@@ -0,0 +1,51 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef RIGIDBODYCOMPONENT_H
+#define RIGIDBODYCOMPONENT_H
+
+#pragma once
+
+#include "Engine/Math/Math.h"
+#include <cstdint>
+
+namespace ZED
+{
+    // Opaque body id owned by the active physics backend
+    using PhysicsBodyHandle = uint32_t;
+    inline constexpr PhysicsBodyHandle kInvalidPhysicsBody = 0xFFFFFFFFu;
+
+    enum class BodyMotion : uint8_t
+    {
+        Static,     // never moves
+        Kinematic,  // follows TransformComponent, pushes dynamic bodies
+        Dynamic,    // simulated; the physics system owns its TransformComponent
+    };
+
+    // Simulated body for an entity that also has a ColliderComponent and TransformComponent.
+    // Settings are read when the body is created; the body is removed with the component.
+    // Bodies are world space, so only root entities get one: PhysicsSystem skips (and warns
+    // about) a rigid body whose entity has a HierarchyComponent parent, and stops syncing an
+    // existing body while its entity is parented.
+    struct RigidBodyComponent
+    {
+        BodyMotion motion = BodyMotion::Dynamic;
+
+        float mass           = 1.0f;  // kg, dynamic bodies only
+        float friction       = 0.5f;
+        float restitution    = 0.0f;
+        float linearDamping  = 0.05f;
+        float angularDamping = 0.05f;
+        bool  allowSleep     = true;
+
+        // Initial velocities, world space
+        Vec3 linearVelocity { 0.0f };
+        Vec3 angularVelocity{ 0.0f };
+
+        // Set by PhysicsSystem once the backend created the body
+        PhysicsBodyHandle handle = kInvalidPhysicsBody;
+    };
+}
+
+#endif
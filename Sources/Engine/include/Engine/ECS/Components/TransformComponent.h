@@ -21,17 +21,10 @@ namespace ZED
 
         // Compose TRS to Mat4: M = T * Rz * Ry * Rx * S
         // Order chosen for a conventional left-handed engine setup according to google.
+        // Column-major: Scale is applied first, then Rx, then Ry, then Rz, then Translate.
         static Mat4 Compose(const TransformComponent& t)
         {
-            Mat4 T = Translate(t.position);
-            Mat4 Rx = glm::rotate(Mat4(1.0f), t.rotation.x, Vec3(1.0f, 0.0f, 0.0f));
-            Mat4 Ry = glm::rotate(Mat4(1.0f), t.rotation.y, Vec3(0.0f, 1.0f, 0.0f));
-            Mat4 Rz = glm::rotate(Mat4(1.0f), t.rotation.z, Vec3(0.0f, 0.0f, 1.0f));
-            Mat4 S  = glm::scale (Mat4(1.0f), t.scale);
-
-            // Column-major: last multiplied is applied first to a column vector.
-            // Apply Scale, then Rx, then Ry, then Rz, then Translate.
-            return T * Rz * Ry * Rx * S;
+            return ComposeTRS(t.position, t.rotation, t.scale);
         }
 
         // Convenience instance method
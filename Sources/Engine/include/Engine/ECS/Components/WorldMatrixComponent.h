@@ -0,0 +1,27 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef WORLDMATRIXCOMPONENT_H
+#define WORLDMATRIXCOMPONENT_H
+
+#pragma once
+
+#include "Engine/Math/Math.h"
+
+namespace ZED
+{
+    // Cached result of TransformComponent::Compose(). Added automatically next to every
+    // TransformComponent and only recomputed by TransformSystem::UpdateWorldMatrices()
+    // for entities tagged TransformDirty, so static entities cost nothing per frame.
+    struct WorldMatrixComponent
+    {
+        Mat4 matrix{ 1.0f };
+    };
+
+    // Empty tag: "TransformComponent changed since the last world-matrix update".
+    // Set through TransformSystem::MarkDirty(), cleared by UpdateWorldMatrices().
+    struct TransformDirty {};
+}
+
+#endif
@@ -8,12 +8,16 @@
 #pragma once
 
 #include "entt/entt.hpp"
+#include "Engine/Memory/Allocators.h"
 
 namespace ZED
 {
+    // Component storages, entity pools and signal tables are all charged to MemoryTag::ECS
+    using Registry = entt::basic_registry<entt::entity, TaggedAllocator<entt::entity, MemoryTag::ECS>>;
+
     struct ECS
     {
-        ZEDENGINE_API static entt::registry& Registry();
+        ZEDENGINE_API static ZED::Registry& Registry();
     };
 }
 
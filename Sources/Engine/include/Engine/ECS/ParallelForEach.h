@@ -0,0 +1,44 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef PARALLELFOREACH_H
+#define PARALLELFOREACH_H
+
+#pragma once
+
+#include "entt/entt.hpp"
+#include "Engine/Jobs/JobSystem.h"
+#include <tuple>
+
+namespace ZED
+{
+    /**
+     * Run func(entity, Components&...) for every entity in an EnTT view, spread
+     * across the job system. The leading (smallest) storage's packed entity
+     * array is split into contiguous chunks, so each job walks dense memory.
+     *
+     * func must only touch the components it is handed (or other data it owns);
+     * adding/removing components from inside func is not allowed.
+     */
+    template <typename View, typename Func>
+    void ParallelForEach(const View& view, Func&& func, size_t minBatch = 1024)
+    {
+        const auto* leading = view.handle();
+        if (!leading) return;
+
+        const auto* entities = leading->data();
+        JobSystem::ParallelFor(leading->size(), minBatch, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const auto ent = entities[i];
+                if (!view.contains(ent)) continue;
+
+                std::apply([&](auto&... comps) { func(ent, comps...); }, view.get(ent));
+            }
+        });
+    }
+}
+
+#endif
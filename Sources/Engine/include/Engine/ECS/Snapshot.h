@@ -0,0 +1,83 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ZED
+{
+    struct SnapshotInfo
+    {
+        uint64_t tick = 0;
+        size_t bytes = 0;   // buffer space this snapshot uses
+        bool delta = false; // holds only the chunks that changed since its keyframe
+    };
+
+    /**
+     * Ring of registry save states for rollback and desync debugging.
+     *
+     * A snapshot is a raw copy of the entity list and of every trivially copyable gameplay pool
+     * (Transform, Hierarchy, Bounds, Camera, Collider, RigidBody, PreviousTransform, Script), plus
+     * the motion state of every physics body. Pools are copied page by page with memcpy into
+     * buffers that keep their size between captures, so a warmed-up ring doesn't allocate.
+     *
+     * Every keyframeInterval-th capture is a full keyframe; the ones in between are deltas that
+     * store only the 256-component chunks that differ from their keyframe. A delta needs its
+     * keyframe, so once the keyframe's slot is reused its deltas can't be restored any more.
+     *
+     * Restore() compares each chunk with the live registry and copies back only the ones that
+     * differ, so rewinding a few ticks costs little more than a compare of the pools. Restored
+     * transforms are marked dirty for the next UpdateWorldMatrices(). Entities created or
+     * destroyed since the capture are destroyed or recreated (same id and version), firing the
+     * usual registry signals. Scripting VM state and physics contact caches are not captured.
+     */
+    class ZEDENGINE_API SnapshotRing
+    {
+    public:
+        // capacity: snapshots kept. keyframeInterval: captures per full snapshot (1 = no deltas).
+        explicit SnapshotRing(size_t capacity = 8, size_t keyframeInterval = 4);
+        ~SnapshotRing();
+
+        SnapshotRing(const SnapshotRing&) = delete;
+        SnapshotRing& operator=(const SnapshotRing&) = delete;
+
+        // Size every slot for a full snapshot of reg as it is now, so capturing doesn't allocate
+        void Reserve(const Registry& reg);
+
+        // Copy reg into the oldest slot, tagged with tick (FixedTimestep::GetTick()). A tick that
+        // is already in the ring is overwritten.
+        void Capture(const Registry& reg, uint64_t tick);
+        void Capture(uint64_t tick) { Capture(ECS::Registry(), tick); }
+
+        // Put reg back to its state at tick; false if that snapshot is gone
+        bool Restore(Registry& reg, uint64_t tick);
+        bool Restore(uint64_t tick) { return Restore(ECS::Registry(), tick); }
+
+        bool Contains(uint64_t tick) const;
+        bool GetInfo(uint64_t tick, SnapshotInfo& out) const;
+
+        // Forget snapshots newer than tick, e.g. after rolling back to it
+        void DiscardAfter(uint64_t tick);
+        void Clear();
+
+        size_t GetCapacity() const;
+
+        // Buffer memory held by all slots, used or not
+        size_t GetMemoryUsage() const;
+
+    private:
+        struct State;
+        std::unique_ptr<State> m_state;
+    };
+}
+
+#endif
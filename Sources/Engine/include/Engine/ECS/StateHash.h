@@ -0,0 +1,60 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef STATEHASH_H
+#define STATEHASH_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace ZED
+{
+    /**
+     * 64-bit hash of the simulation state, for spotting the first tick at which two runs that
+     * should be identical (lockstep peers, a replay and its recording) stop agreeing.
+     *
+     * Covers the entity list, the Transform, Hierarchy, Camera, Collider, RigidBody and Script
+     * pools and the motion state of every physics body. Data derived from those (world matrices,
+     * bounds, previous transforms) and fields that belong to the live world rather than the
+     * simulation (physics handles, per-frame flags) are left out. Padded components are packed
+     * field by field first, so uninitialised padding bytes never reach the hash.
+     *
+     * Every pool keeps a Hash64 per 256-component chunk. Update() rehashes a transform chunk only
+     * when one of its entities is tagged TransformDirty or its entity ids changed, so a tick in
+     * which little moves costs the entity ids, the small pools and a handful of chunks. The
+     * result is the hash of the chunk hashes, which equals what Compute() would return as long
+     * as every transform write was tagged (see TransformSystem::MarkDirty).
+     */
+    class ZEDENGINE_API StateHash
+    {
+    public:
+        StateHash();
+        ~StateHash();
+
+        StateHash(const StateHash&) = delete;
+        StateHash& operator=(const StateHash&) = delete;
+
+        // Incremental hash. Call after every tick, before UpdateWorldMatrices() clears the tags.
+        uint64_t Update(const Registry& reg);
+
+        // Rehash every chunk, ignoring the tags; also resynchronises the chunk cache
+        uint64_t Compute(const Registry& reg);
+
+        // Result of the last Update()/Compute(), 0 before the first
+        uint64_t Get() const;
+
+        // Forget the chunk cache, e.g. after a snapshot restore or scene load
+        void Reset();
+
+    private:
+        struct State;
+        std::unique_ptr<State> m_state;
+    };
+}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef SYSTEMSCHEDULER_H
+#define SYSTEMSCHEDULER_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ZED
+{
+    // Points in the frame where the main loop runs systems, in this order.
+    // FixedUpdate runs once per fixed step, so zero or more times per frame.
+    enum class SystemPhase : uint8_t
+    {
+        Update,      // per frame, before the simulation (input-driven systems)
+        FixedUpdate, // per fixed step
+        PostUpdate,  // per frame, after the simulation (world matrices, spatial index, culling)
+        Render,      // per frame, draw recording
+        Count
+    };
+
+    using SystemFunc = std::function<void(Registry&, double dt)>;
+
+    /**
+     * A registered system and what it touches. Filled in through the chain returned by
+     * SystemScheduler::Add():
+     *
+     *   SystemScheduler::Add(SystemPhase::PostUpdate, "Culling", ...)
+     *       .Reads<WorldMatrixComponent, CameraComponent>()
+     *       .ReadsResource<CameraSystem>()
+     *       .WritesResource<CullingSystem>();
+     *
+     * Components are EnTT storages of the registry; resources are any other shared state,
+     * keyed by a type (usually the static system or interface that owns it). Two systems
+     * conflict when one writes something the other reads or writes.
+     */
+    struct SystemDesc
+    {
+        struct Access
+        {
+            entt::id_type id;
+            std::string_view name;
+            bool write;
+            // Creates the component storage up front; null for resources
+            void (*assure)(Registry&);
+        };
+
+        std::string name;
+        SystemFunc func;
+        std::vector<Access> access;
+        bool exclusive = false;
+        bool mainThread = false;
+
+        template <typename... Components>
+        SystemDesc& Reads() { (AddComponent<Components>(false), ...); return *this; }
+
+        template <typename... Components>
+        SystemDesc& Writes() { (AddComponent<Components>(true), ...); return *this; }
+
+        template <typename... Resources>
+        SystemDesc& ReadsResource() { (AddResource<Resources>(false), ...); return *this; }
+
+        template <typename... Resources>
+        SystemDesc& WritesResource() { (AddResource<Resources>(true), ...); return *this; }
+
+        // Conflicts with every other system in its phase, for systems whose access can't be
+        // listed (e.g. scripts, which may create entities and touch any component)
+        SystemDesc& Exclusive() { exclusive = true; return *this; }
+
+        // Always runs on the thread that calls SystemScheduler::Run() (e.g. graphics API calls)
+        SystemDesc& MainThread() { mainThread = true; return *this; }
+
+    private:
+        template <typename T>
+        void AddComponent(bool write)
+        {
+            Add(entt::type_hash<T>::value(), entt::type_name<T>::value(), write,
+                [](Registry& r) { r.storage<T>(); });
+        }
+
+        template <typename T>
+        void AddResource(bool write)
+        {
+            Add(entt::type_hash<T>::value(), entt::type_name<T>::value(), write, nullptr);
+        }
+
+        void Add(entt::id_type id, std::string_view typeName, bool write, void (*assure)(Registry&))
+        {
+            for (auto& a : access)
+            {
+                if (a.id == id)
+                {
+                    a.write = a.write || write;
+                    return;
+                }
+            }
+            access.push_back({ id, typeName, write, assure });
+        }
+    };
+
+    /**
+     * Runs registered systems phase by phase, in parallel where their declared access allows.
+     *
+     * Within a phase, a system depends on every earlier-registered system it conflicts with,
+     * so registration order is the fallback order and non-conflicting systems are free to
+     * overlap. The resulting DAG is levelled into stages: each stage's systems run
+     * concurrently on the job system and the stage ends when they have all finished.
+     * The schedule is rebuilt lazily when systems are added.
+     */
+    class ZEDENGINE_API SystemScheduler
+    {
+    public:
+        // Read [Systems] Parallel and DumpSchedule from the loaded INI
+        static void InitFromConfig();
+
+        // Register a system at the end of a phase. The returned reference stays valid until Clear().
+        static SystemDesc& Add(SystemPhase phase, std::string name, SystemFunc func);
+
+        // Run every system of a phase; returns once they have all finished
+        static void Run(SystemPhase phase, Registry& r, double dt);
+
+        // Drop all systems and timings
+        static void Clear();
+
+        // false runs every system on the calling thread in registration order
+        static void SetParallel(bool parallel);
+        static bool IsParallel();
+
+        // Stages of every phase with each system's access and direct dependencies
+        static void DumpSchedule(std::ostream& out);
+
+        // Per-system call counts and times, plus each phase's wall time against the sum of its systems
+        static void DumpTimings(std::ostream& out);
+    };
+}
+
+#endif
@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include "entt/entt.hpp"
+#include "Engine/ECS/ECS.h"
 #include "Engine/Math/Math.h"
 #include "Engine/ECS/Components/TransformComponent.h"
 #include "Engine/ECS/Components/CameraComponent.h"
@@ -26,7 +26,7 @@ namespace ZED
         static bool IsEnabled();
 
         // Update camera based on input (call once per frame)
-        static void Update(entt::registry& r, double dt);
+        static void Update(Registry& r, double dt);
 
         // Configuration
         static void SetMoveSpeed(float speed);        // units per second
@@ -7,10 +7,11 @@
 
 #pragma once
 
-#include "entt/entt.hpp"
+#include "Engine/ECS/ECS.h"
 #include "Engine/Math/Math.h"
 #include "Engine/ECS/Components/TransformComponent.h"
 #include "Engine/ECS/Components/CameraComponent.h"
+#include "Engine/ECS/Components/WorldMatrixComponent.h"
 
 namespace ZED
 {
@@ -24,7 +25,7 @@ namespace ZED
         static void SetAspect(float aspect);
 
         // Compute and store view/proj from the active camera (primary or first available)
-        static void Update(entt::registry& r);
+        static void Update(Registry& r);
 
         // Getters for the renderer
         static const Mat4& GetView();
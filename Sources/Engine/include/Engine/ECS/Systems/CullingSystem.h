@@ -0,0 +1,58 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef CULLINGSYSTEM_H
+#define CULLINGSYSTEM_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+#include "Engine/Math/Math.h"
+#include "Engine/ECS/Components/BoundsComponent.h"
+#include "Engine/ECS/Components/WorldMatrixComponent.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ZED
+{
+    // Six normalized planes (xyz = inward normal, w = distance), left/right/bottom/top/near/far
+    struct ZEDENGINE_API Frustum
+    {
+        Vec4 planes[6];
+
+        // Gribb/Hartmann extraction for a left-handed, depth 0..1 view*proj
+        static Frustum FromViewProj(const Mat4& viewProj);
+
+        bool IntersectsSphere(const Vec3& center, float radius) const;
+    };
+
+    // Culls every entity with a WorldMatrixComponent (cameras excluded) against the active
+    // camera frustum and keeps a compact list of the visible ones for the renderer.
+    struct ZEDENGINE_API CullingSystem
+    {
+        // Rebuild the visible list. Runs across the job system in fixed-size chunks.
+        static void Update(Registry& r, const Mat4& view, const Mat4& proj);
+
+        // Entities that passed the last Update(), in storage order
+        static const std::vector<entt::entity>& GetVisible();
+
+        // Entities considered by the last Update()
+        static size_t GetTestedCount();
+
+        // Sphere/frustum kernel over structure-of-arrays input. Writes the index of every sphere
+        // that is at least partially inside to outVisible and returns how many were written.
+        // Uses AVX (8 lanes) when compiled with it, SSE (4 lanes) on x86, scalar elsewhere.
+        static size_t CullSpheres(const Frustum& frustum,
+                                  const float* x, const float* y, const float* z, const float* radius,
+                                  size_t count, uint32_t* outVisible);
+
+    private:
+        static std::vector<entt::entity> s_visible;
+        static size_t s_tested;
+    };
+}
+
+#endif
@@ -0,0 +1,58 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef HIERARCHYSYSTEM_H
+#define HIERARCHYSYSTEM_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+#include "Engine/ECS/Components/HierarchyComponent.h"
+
+namespace ZED
+{
+    // Maintains parent/child links and propagates world matrices down the tree.
+    // HierarchyComponent storage is kept sorted by depth so propagation is a single
+    // breadth-first linear pass instead of a recursive pointer walk.
+    struct ZEDENGINE_API HierarchySystem
+    {
+        // Hook destroy signals so removed entities are unlinked and their children orphaned
+        static void connect(Registry& r);
+
+        // Attach child under parent (entt::null detaches). Returns false if that would create a cycle.
+        static bool SetParent(Registry& r, entt::entity child, entt::entity parent);
+
+        static entt::entity GetParent(const Registry& r, entt::entity e);
+
+        // Compose world = parentWorld * local for every hierarchy entity whose own transform
+        // is dirty or whose parent moved this frame. Called by TransformSystem::UpdateWorldMatrices().
+        static void Propagate(Registry& r);
+
+        // Sort the storage by depth right away if it isn't already. For code that writes
+        // HierarchyComponent links wholesale (scene loading, snapshot restore) instead of
+        // going through SetParent().
+        static void SortByDepth(Registry& r);
+
+    private:
+        static void onDestroy(Registry& r, entt::entity e);
+
+        // Unlink e from its current parent's child list (links only, no depth changes)
+        static void Unlink(Registry& r, entt::entity e);
+
+        // Recompute depth for e and all of its descendants
+        static void UpdateSubtreeDepth(Registry& r, entt::entity e);
+
+        // Re-sort lazily, once per frame, on the next Propagate(). Lives in the registry's
+        // context, so registries (scene loads, benchmarks) don't see each other's re-parents.
+        struct SortState
+        {
+            bool needsSort = false;
+            // Links changed since the last sort; picks insertion sort (few) or a full sort (many)
+            size_t pendingChanges = 0;
+        };
+        static SortState& GetSortState(Registry& r);
+    };
+}
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef INTERPOLATIONSYSTEM_H
+#define INTERPOLATIONSYSTEM_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+#include "Engine/Math/Math.h"
+#include "Engine/ECS/Components/PreviousTransformComponent.h"
+
+namespace ZED
+{
+    // Maintains PreviousTransformComponent: snapshots the pose before every fixed step and
+    // blends it with the current pose once per rendered frame.
+    struct ZEDENGINE_API InterpolationSystem
+    {
+        // Start new PreviousTransformComponents at the entity's current pose. Call once per registry.
+        static void connect(Registry& r);
+
+        // Copy TransformComponent into PreviousTransformComponent. Call at the start of every fixed step.
+        static void Capture(Registry& r);
+
+        // Fill renderMatrix for alpha in [0, 1) (FixedTimestep::GetAlpha()): position and scale are
+        // lerped, rotation slerped. Children are placed under their parent's simulated world matrix.
+        // Call after TransformSystem::UpdateWorldMatrices().
+        static void Update(Registry& r, float alpha);
+
+        // renderMatrix when the entity is interpolated, its WorldMatrixComponent otherwise
+        static const Mat4& GetRenderMatrix(const Registry& r, entt::entity e);
+
+    private:
+        static void onConstruct(Registry& r, entt::entity e);
+    };
+}
+
+#endif
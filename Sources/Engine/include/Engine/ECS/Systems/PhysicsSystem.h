@@ -0,0 +1,42 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef PHYSICSSYSTEM_H
+#define PHYSICSSYSTEM_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+#include "Engine/ECS/Components/RigidBodyComponent.h"
+#include "Engine/ECS/Components/ColliderComponent.h"
+#include "Engine/ECS/Components/TransformComponent.h"
+
+#include <cstdint>
+
+namespace ZED
+{
+    // Bridges the ECS and the loaded IPhysics backend (Physics::Get()). Does nothing when no
+    // physics module is loaded.
+    struct ZEDENGINE_API PhysicsSystem
+    {
+        // Remove backend bodies together with their RigidBodyComponent. Call once per registry.
+        static void connect(Registry& r);
+
+        // Create backend bodies for new RigidBody + Collider + Transform entities in one batch.
+        // FixedUpdate() does this first; call it directly to create bodies without stepping.
+        static void CreatePendingBodies(Registry& r);
+
+        // One fixed simulation step of dt seconds, driven by FixedTimestep: create pending bodies,
+        // move kinematic bodies to their TransformComponent pose, step, then copy the awake bodies
+        // back to their TransformComponent in one pass (and mark them dirty)
+        static void FixedUpdate(Registry& r, float dt);
+
+    private:
+        static void onDestroy(Registry& r, entt::entity e);
+
+        static void WriteBack(Registry& r);
+    };
+}
+
+#endif
@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include "entt/entt.hpp"
+#include "Engine/ECS/ECS.h"
 #include "Engine/ECS/Components/ScriptComponent.h"
 
 // Forward-declare to avoid heavy coupling
@@ -18,17 +18,18 @@ namespace ZED
     struct ZEDENGINE_API ScriptLifecycleSystem
     {
         // Connect without passing a context pointer; handlers will query Scripting::Get()
-        static void connect(entt::registry& r);
+        static void connect(Registry& r);
 
         // Must match EnTT signature: void(registry&, entity)
-        static void onAdd   (entt::registry& r, entt::entity e);
-        static void onRemove(entt::registry& r, entt::entity e);
+        static void onAdd   (Registry& r, entt::entity e);
+        static void onRemove(Registry& r, entt::entity e);
     };
 
     struct ZEDENGINE_API ScriptUpdateSystem
     {
         // No context param; will query Scripting::Get()
-        static void tick(entt::registry& r, double dt);
+        // Groups enabled entities by script and issues one IScripting::UpdateBatch per script
+        static void tick(Registry& r, double dt);
     };
 }
 
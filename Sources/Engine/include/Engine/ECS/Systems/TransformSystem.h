@@ -7,68 +7,103 @@
 
 #pragma once
 
-#include "entt/entt.hpp"
+#include "Engine/ECS/ECS.h"
 #include "Engine/Math/Math.h"
 #include "Engine/ECS/Components/TransformComponent.h"
 #include "Engine/ECS/Components/CameraComponent.h"
+#include "Engine/ECS/Components/WorldMatrixComponent.h"
+#include "Engine/ECS/ParallelForEach.h"
 
 namespace ZED
 {
     struct ZEDENGINE_API TransformSystem
     {
+        // Hook TransformComponent signals so every transform gets a WorldMatrixComponent
+        // and is marked dirty on creation/replace. Call once per registry.
+        static void connect(Registry& r);
+
+        // Flag an entity's world matrix for recomposition on the next UpdateWorldMatrices().
+        // Anything that writes TransformComponent directly must call this.
+        static void MarkDirty(Registry& r, entt::entity e)
+        {
+            auto& dirty = r.storage<TransformDirty>();
+            if (!dirty.contains(e))
+                dirty.emplace(e);
+        }
+
+        // Recompose WorldMatrixComponent for dirty entities only (in parallel), propagate through
+        // the hierarchy, then clear the tags
+        static void UpdateWorldMatrices(Registry& r);
+
         // Apply incremental rotation (radians) to an entity
-        static void Rotate(entt::registry& r, entt::entity e, const Vec3& delta)
+        static void Rotate(Registry& r, entt::entity e, const Vec3& delta)
         {
             if (!r.all_of<TransformComponent>(e)) return;
             auto& tr = r.get<TransformComponent>(e);
             tr.rotation += delta;
+            MarkDirty(r, e);
         }
 
         // Apply incremental translation to an entity
-        static void Translate(entt::registry& r, entt::entity e, const Vec3& delta)
+        static void Translate(Registry& r, entt::entity e, const Vec3& delta)
         {
             if (!r.all_of<TransformComponent>(e)) return;
             auto& tr = r.get<TransformComponent>(e);
             tr.position += delta;
+            MarkDirty(r, e);
         }
 
         // Setters (overwrite)
-        static void SetPosition(entt::registry& r, entt::entity e, const Vec3& p)
+        static void SetPosition(Registry& r, entt::entity e, const Vec3& p)
         {
             if (!r.all_of<TransformComponent>(e)) return;
             r.get<TransformComponent>(e).position = p;
+            MarkDirty(r, e);
         }
 
-        static void SetRotation(entt::registry& r, entt::entity e, const Vec3& rads)
+        static void SetRotation(Registry& r, entt::entity e, const Vec3& rads)
         {
             if (!r.all_of<TransformComponent>(e)) return;
             r.get<TransformComponent>(e).rotation = rads;
+            MarkDirty(r, e);
         }
 
-        static void SetScale(entt::registry& r, entt::entity e, const Vec3& s)
+        static void SetScale(Registry& r, entt::entity e, const Vec3& s)
         {
             if (!r.all_of<TransformComponent>(e)) return;
             r.get<TransformComponent>(e).scale = s;
+            MarkDirty(r, e);
         }
 
-        // Rotate all transforms by angularVelocity * dt, skipping primary cameras
-        static void SpinAll(entt::registry& r, double dt, const Vec3& angularVelocity)
+        // Rotate all transforms by angularVelocity * dt, skipping primary cameras.
+        // Runs across all job system threads.
+        static void SpinAll(Registry& r, double dt, const Vec3& angularVelocity)
         {
-            auto view = r.view<TransformComponent>();
-            for (auto ent : view)
+            const Vec3 delta = angularVelocity * static_cast<float>(dt);
+            auto& cameras = r.storage<CameraComponent>();
+
+            ParallelForEach(r.view<TransformComponent>(), [&](entt::entity ent, TransformComponent& tr)
             {
                 // Skip if this entity has a primary camera
-                if (r.any_of<CameraComponent>(ent))
-                {
-                    const auto& cam = r.get<CameraComponent>(ent);
-                    if (cam.primary)
-                        continue;
-                }
-
-                auto& tr = view.get<TransformComponent>(ent);
-                tr.rotation += angularVelocity * static_cast<float>(dt);
+                if (cameras.contains(ent) && cameras.get(ent).primary)
+                    return;
+
+                tr.rotation += delta;
+            });
+
+            // Tagging changes storage, so it can't happen inside the parallel pass
+            for (auto ent : r.view<TransformComponent>())
+            {
+                if (cameras.contains(ent) && cameras.get(ent).primary)
+                    continue;
+                MarkDirty(r, ent);
             }
         }
+
+    private:
+        static void onConstruct(Registry& r, entt::entity e);
+        static void onUpdate   (Registry& r, entt::entity e);
+        static void onDestroy  (Registry& r, entt::entity e);
     };
 }
 
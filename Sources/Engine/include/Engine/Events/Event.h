@@ -6,6 +6,7 @@
 #define EVENT_H
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 namespace ZED
@@ -36,9 +37,14 @@ namespace ZED
 
         // --- Device lifecycle events ---
         DeviceConnected,
-        DeviceDisconnected
+        DeviceDisconnected,
+
+        // Number of event types, keep last
+        Count
     };
 
+    inline constexpr size_t kEventTypeCount = static_cast<size_t>(EventType::Count);
+
     // Generic event payload.
     struct Event {
         EventType type{};
@@ -8,10 +8,13 @@
 #pragma once
 
 #include "Event.h"
+#include "Engine/Containers/MPSCQueue.h"
+#include "Engine/Memory/Allocators.h"
+#include <array>
+#include <atomic>
 #include <functional>
-#include <unordered_map>
+#include <memory>
 #include <vector>
-#include <queue>
 #include <mutex>
 
 namespace ZED
@@ -22,6 +25,12 @@ namespace ZED
      * knowledge of who will handle them and subscribe only to the
      * event types they care about.  Events can be dispatched
      * immediately or deferred for later processing.
+     *
+     * Posting is lock-free (bounded MPSC ring buffers) and safe from any
+     * thread. Dispatch() and DispatchDeferred() must be called from a single
+     * thread (the main loop); they take no lock and never allocate. Handler
+     * lists are copy-on-write, so Subscribe/Unsubscribe pay the copy instead
+     * of every dispatched event.
      */
     class ZEDENGINE_API EventSystem
     {
@@ -47,16 +56,18 @@ namespace ZED
 
         /**
          * Post an event for immediate dispatch.  The event will be
-         * delivered on the next call to Dispatch().
+         * delivered on the next call to Dispatch().  Returns false and
+         * drops the event if the queue is full.
          */
-        void Post(const Event& e);
+        bool Post(const Event& e);
 
         /**
          * Post an event to the deferred queue.  Deferred events are
          * transferred to the immediate queue on the next call to
          * DispatchDeferred() and then delivered during Dispatch().
+         * Returns false and drops the event if the queue is full.
          */
-        void PostDeferred(const Event& e);
+        bool PostDeferred(const Event& e);
 
         /**
          * Move deferred events into the immediate queue.  Call this
@@ -70,6 +81,22 @@ namespace ZED
          */
         void Dispatch();
 
+        /**
+         * Append every event Dispatch() delivers to sink, subscribed to or not, until called
+         * again with nullptr. The sink is plain data owned by the caller, so a module can
+         * record the stream without leaving a handler in the engine once it is unloaded.
+         * Dispatch thread only.
+         */
+        void SetDispatchSink(std::vector<Event>* sink);
+
+        /**
+         * Number of events dropped because a queue was full.
+         */
+        uint64_t GetDroppedCount() const;
+
+        // Maximum number of events each queue can hold between dispatches
+        static constexpr size_t kQueueCapacity = 8192;
+
     private:
         // Internal representation of a subscription entry
         struct Subscription
@@ -78,12 +105,28 @@ namespace ZED
             Handler handler;
         };
 
-        // Protects access to the handler maps and queues
-        std::mutex m_Mutex;
+        // Immutable once published; replaced wholesale on (un)subscribe
+        using HandlerList = std::vector<Subscription, TaggedAllocator<Subscription, MemoryTag::Events>>;
+
+        // Swap in a new handler list for a type; caller holds m_WriteMutex
+        void Publish(EventType type, std::unique_ptr<const HandlerList> list);
+        // Free lists retired since the last dispatch (dispatch thread only)
+        void ReclaimRetired();
+
+        // Serialises writers (Subscribe/Unsubscribe); never taken by Dispatch
+        std::mutex m_WriteMutex;
         int m_NextId = 1;
-        std::unordered_map<EventType, std::vector<Subscription>> m_Handlers;
-        std::queue<Event> m_EventQueue;
-        std::queue<Event> m_DeferredQueue;
+
+        // Flat table indexed by EventType, read lock-free by Dispatch
+        std::array<std::atomic<const HandlerList*>, kEventTypeCount> m_Handlers{};
+        std::array<std::unique_ptr<const HandlerList>, kEventTypeCount> m_OwnedHandlers;
+        std::vector<std::unique_ptr<const HandlerList>> m_Retired;
+        std::atomic<bool> m_HasRetired{false};
+
+        MPSCQueue<Event, kQueueCapacity> m_EventQueue;
+        MPSCQueue<Event, kQueueCapacity> m_DeferredQueue;
+        std::atomic<uint64_t> m_Dropped{0};
+        std::vector<Event>* m_DispatchSink = nullptr;
 
         // Private constructor for singleton pattern
         EventSystem() = default;
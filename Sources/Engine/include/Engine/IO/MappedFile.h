@@ -0,0 +1,48 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace ZED
+{
+    /**
+     * Read-only memory mapping of a whole file. Pages are faulted in by the OS as they are
+     * touched, so reading from the mapping costs no copy into a user buffer.
+     */
+    class ZEDENGINE_API MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Maps path, replacing any current mapping; false when the file can't be opened or mapped
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return m_Data != nullptr; }
+        const std::byte* Data() const { return m_Data; }
+        size_t Size() const { return m_Size; }
+
+    private:
+        const std::byte* m_Data = nullptr;
+        size_t m_Size = 0;
+    #if defined(_WIN32)
+        void* m_File = nullptr;
+        void* m_Mapping = nullptr;
+    #endif
+    };
+}
+
+#endif
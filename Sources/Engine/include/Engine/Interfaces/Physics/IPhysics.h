@@ -0,0 +1,121 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef IPHYSICS_H
+#define IPHYSICS_H
+
+#pragma once
+
+#include "Engine/Math/Math.h"
+#include "Engine/ECS/Components/RigidBodyComponent.h"
+#include "Engine/ECS/Components/ColliderComponent.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ZED
+{
+    using PhysicsJointHandle = uint32_t;
+    inline constexpr PhysicsJointHandle kInvalidPhysicsJoint = 0xFFFFFFFFu;
+
+    // Everything a backend needs to create one body; entity comes back in PhysicsBodyPose
+    struct PhysicsBodyDesc
+    {
+        uint32_t entity = 0;
+        Vec3 position{ 0.0f };
+        Quat rotation{ 1.0f, 0.0f, 0.0f, 0.0f };
+        Vec3 scale{ 1.0f };
+        RigidBodyComponent body;
+        ColliderComponent collider;
+    };
+
+    struct PhysicsBodyPose
+    {
+        uint32_t entity = 0;
+        Vec3 position{ 0.0f };
+        Quat rotation{ 1.0f, 0.0f, 0.0f, 0.0f };
+    };
+
+    // Everything that moves a body from one step to the next, for save states and rollback
+    struct PhysicsBodyState
+    {
+        Vec3 position{ 0.0f };
+        Quat rotation{ 1.0f, 0.0f, 0.0f, 0.0f };
+        Vec3 linearVelocity{ 0.0f };
+        Vec3 angularVelocity{ 0.0f };
+    };
+
+    struct PhysicsRayHit
+    {
+        uint32_t entity = 0;
+        float distance = 0.0f;
+        Vec3 position{ 0.0f };
+        Vec3 normal{ 0.0f };
+    };
+
+    struct PhysicsStats
+    {
+        uint32_t bodies = 0;
+        uint32_t activeBodies = 0;
+        uint32_t joints = 0;
+        uint64_t steps = 0;
+        double lastStepMs = 0.0;
+
+        // Heap currently held by the backend library (all instances), through its allocator hooks
+        size_t memoryBytes = 0;
+    };
+
+    // Rigid-body simulation backend. Driven by PhysicsSystem, which owns the fixed step and
+    // the ECS sync; backends only create/destroy bodies, step, and report what moved.
+    class ZEDENGINE_API IPhysics
+    {
+    public:
+        virtual ~IPhysics() = default;
+
+        // Reads [Physics] from the loaded INI (worker threads, body limits, gravity)
+        virtual bool Init() = 0;
+        virtual void Shutdown() = 0;
+
+        virtual const char* GetName() const = 0;
+
+        // Create and add bodies in one batch. Writes one handle per desc, kInvalidPhysicsBody on failure.
+        virtual void CreateBodies(std::span<const PhysicsBodyDesc> descs, std::span<PhysicsBodyHandle> outHandles) = 0;
+        // Joints attached to the body are destroyed with it
+        virtual void DestroyBody(PhysicsBodyHandle handle) = 0;
+
+        // Ball-and-socket joint pinning both bodies together at a world-space point; the two
+        // bodies still collide with each other
+        virtual PhysicsJointHandle CreatePointJoint(PhysicsBodyHandle a, PhysicsBodyHandle b, const Vec3& worldPivot) = 0;
+        virtual void DestroyJoint(PhysicsJointHandle handle) = 0;
+
+        // Drive a kinematic body so it reaches the pose at the end of the next dt seconds
+        virtual void MoveKinematic(PhysicsBodyHandle handle, const Vec3& position, const Quat& rotation, float dt) = 0;
+
+        virtual void SetGravity(const Vec3& gravity) = 0;
+
+        // Advance the simulation by exactly dt seconds
+        virtual void Step(float dt) = 0;
+
+        // Replace out with the pose of every awake, non-static body. Sleeping bodies are skipped,
+        // so a settled scene costs nothing here.
+        virtual void GetActivePoses(std::vector<PhysicsBodyPose>& out) = 0;
+
+        // Read the state of each body in handles into out (same length). Invalid handles leave
+        // their entry untouched. Call between steps.
+        virtual void GetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<PhysicsBodyState> out) const = 0;
+
+        // Teleport bodies to the given states, waking those that are given a velocity. Contact
+        // caches are not part of the state, so the first step after a restore may differ
+        // slightly from the original run. Call between steps.
+        virtual void SetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<const PhysicsBodyState> states) = 0;
+
+        // Closest body hit along direction within maxDistance. Call between steps, from one thread.
+        virtual bool CastRay(const Vec3& origin, const Vec3& direction, float maxDistance, PhysicsRayHit& outHit) const = 0;
+
+        virtual PhysicsStats GetStats() const = 0;
+    };
+}
+
+#endif
@@ -9,9 +9,17 @@
 
 #include "Engine/Math/Math.h"
 #include <cstdint>
+#include <span>
 
 namespace ZED
 {
+    // A run of draws sharing pass and material, in the order they should be drawn
+    struct RenderBatch
+    {
+        uint64_t stateKey = 0;          // sort key with the depth bits stripped (see RenderKey)
+        std::span<const Mat4> models;
+    };
+
     class ZEDENGINE_API IRenderer
     {
     public:
@@ -29,6 +37,26 @@ namespace ZED
         // Draw a unit cube transformed by model matrix (demo path)
         virtual void DrawCube(const Mat4& model) = 0;
 
+        // Draw one unit cube per model matrix. Backends override this to submit the whole
+        // span as a single instanced draw; the fallback issues one DrawCube per matrix.
+        virtual void DrawCubes(std::span<const Mat4> models)
+        {
+            for (const Mat4& model : models)
+            {
+                DrawCube(model);
+            }
+        }
+
+        // Consume a whole sorted frame in one call (see RenderQueue::Flush). Backends can
+        // bind state once per batch; the fallback submits each batch through DrawCubes.
+        virtual void SubmitBatches(std::span<const RenderBatch> batches)
+        {
+            for (const RenderBatch& batch : batches)
+            {
+                DrawCubes(batch.models);
+            }
+        }
+
         // Simple demo draw: spinning cube
         //virtual void DrawTestCube(float timeSeconds) = 0;
 
@@ -9,30 +9,74 @@
 
 #include <string>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace ZED
 {
     using Entity = uint32_t; // POD-friendly across DLL boundary
     struct ScriptId { uint64_t value = 0; };
 
+    // What a script (all of its instances) or a single instance has cost since profiling began
+    struct ScriptStats
+    {
+        ScriptId id;
+        std::string name;          // source the script was loaded from
+        Entity entity = 0;         // instance stats only
+        uint32_t instances = 0;    // script stats only: live instances
+
+        uint64_t updateCalls = 0;  // OnUpdate / OnUpdateBatch
+        double updateMs = 0.0;
+        uint64_t eventCalls = 0;   // OnEvent
+        double eventMs = 0.0;
+
+        uint64_t bytesAllocated = 0;
+        uint64_t heapBytes = 0;    // script stats only: heap its instances hold right now
+        uint64_t gcSteps = 0;      // incremental GC steps its allocations triggered
+        double gcMs = 0.0;
+    };
+
     class ZEDENGINE_API IScripting
     {
     public:
         virtual bool Init() = 0;
         virtual void Shutdown() = 0;
 
+        // Loading a path that is already loaded returns its existing id
         virtual ScriptId LoadBytecodeFile(const std::string& path) = 0;
 
+        // Path a script was loaded from, empty for unknown ids (scene files store scripts by path)
+        virtual std::string GetScriptPath(ScriptId id) const { (void)id; return {}; }
+
         // Entity-aware lifecycle hooks
         // TODO: Luau/C#/etc will/should implement these
         virtual void Start (ScriptId id, Entity e) = 0;
         virtual void Stop  (ScriptId id, Entity e) = 0;
         virtual void Update(ScriptId id, Entity e, double dt) = 0;
 
+        // Update every entity running script 'id' in one go. Implementations can hand the
+        // whole list to the script in a single call; the default just loops Update().
+        virtual void UpdateBatch(ScriptId id, std::span<const Entity> entities, double dt)
+        {
+            for (Entity e : entities)
+                Update(id, e, dt);
+        }
+
+        // Called once per frame before any Update/UpdateBatch (hot reloads, deferred work)
+        virtual void BeginFrame() {}
+
         // Event fan-out to scripts
         virtual void PushEvent(int type, int a=0, int b=0, int c=0, int d=0) = 0;
 
         virtual void EnableHotReload(bool enabled) = 0;
+
+        // Profiling; implementations that don't collect stats report nothing
+        virtual bool IsProfiling() const { return false; }
+        virtual uint64_t GetProfiledFrames() const { return 0; }        // BeginFrame() calls since the last reset
+        virtual void GetScriptStats(std::vector<ScriptStats>& out) const { out.clear(); }
+        virtual void GetInstanceStats(ScriptId /*id*/, std::vector<ScriptStats>& out) const { out.clear(); }
+        virtual void ResetStats() {}
+
         virtual ~IScripting() = default;
     };
 }
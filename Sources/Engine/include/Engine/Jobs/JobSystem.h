@@ -0,0 +1,86 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace ZED
+{
+    // Tracks a group of jobs; Wait() on it until every job has finished
+    struct JobCounter
+    {
+        std::atomic<uint32_t> pending{0};
+
+        bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+    };
+
+    /**
+     * Work-stealing job scheduler.
+     *
+     * Each worker owns a deque: it pushes and pops at the back (LIFO, cache
+     * warm) while idle workers steal from the front of other deques. The
+     * thread that calls Init() becomes worker 0 and takes part in execution
+     * whenever it waits, so Wait() never blocks a thread that could be doing
+     * work; it keeps running queued jobs until the counter drains.
+     */
+    class ZEDENGINE_API JobSystem
+    {
+    public:
+        // Raw job entry point; data/begin/end are passed through untouched
+        using JobFunc = void (*)(void* data, size_t begin, size_t end);
+
+        // Start the workers. workerCount = 0 picks hardware_concurrency() - 1.
+        static void Init(uint32_t workerCount = 0);
+
+        // Start the workers using [Jobs] WorkerThreads from the loaded INI
+        static void InitFromConfig();
+
+        // Drain outstanding jobs and join all worker threads
+        static void Shutdown();
+
+        // Number of threads executing jobs, including the calling thread
+        static uint32_t GetThreadCount();
+
+        static bool IsInitialized();
+
+        // Index of the calling thread in [0, GetThreadCount()); threads outside the pool report 0
+        static uint32_t GetWorkerIndex();
+
+        // Queue a raw job. Does not allocate.
+        static void Run(JobFunc func, void* data, size_t begin, size_t end, JobCounter* counter = nullptr);
+
+        // Queue a type-erased job. Convenient, but allocates once per call.
+        static void Run(std::function<void()> job, JobCounter* counter = nullptr);
+
+        // Execute queued jobs on this thread until the counter reaches zero
+        static void Wait(JobCounter& counter);
+
+        // Split [0, count) into batches of at least minBatch and run fn(begin, end) on all threads.
+        // Returns once every batch has completed. Runs inline when the job system is not started.
+        template <typename Func>
+        static void ParallelFor(size_t count, size_t minBatch, Func&& fn)
+        {
+            if (count == 0) return;
+
+            using Fn = std::remove_reference_t<Func>;
+            ParallelForImpl(count, minBatch, [](void* data, size_t begin, size_t end)
+            {
+                (*static_cast<Fn*>(data))(begin, end);
+            }, const_cast<void*>(static_cast<const void*>(&fn)));
+        }
+
+    private:
+        static void ParallelForImpl(size_t count, size_t minBatch, JobFunc func, void* data);
+    };
+}
+
+#endif
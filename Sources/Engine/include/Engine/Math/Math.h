@@ -13,7 +13,9 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <cmath>
 
 namespace ZED
 {
@@ -22,6 +24,7 @@ namespace ZED
     using Vec3 = glm::vec3;
     using Vec4 = glm::vec4;
     using Mat4 = glm::mat4;
+    using Quat = glm::quat;
 
     // Re-export common helpers to keep call sites consistent
     inline Mat4 PerspectiveLH_ZO(float fovRadians, float aspect, float znear, float zfar)
@@ -43,6 +46,57 @@ namespace ZED
     {
         return glm::value_ptr(m);
     }
+
+    // Closed-form T * Rz * Ry * Rx * S (Euler radians). Same result as chaining
+    // glm::translate/rotate/scale, but six sin/cos and no 4x4 multiplies.
+    inline Mat4 ComposeTRS(const Vec3& t, const Vec3& euler, const Vec3& s)
+    {
+        const float sx = std::sin(euler.x), cx = std::cos(euler.x);
+        const float sy = std::sin(euler.y), cy = std::cos(euler.y);
+        const float sz = std::sin(euler.z), cz = std::cos(euler.z);
+
+        Mat4 m;
+        m[0] = Vec4(cz * cy, sz * cy, -sy, 0.0f) * s.x;
+        m[1] = Vec4(cz * sy * sx - sz * cx, sz * sy * sx + cz * cx, cy * sx, 0.0f) * s.y;
+        m[2] = Vec4(cz * sy * cx + sz * sx, sz * sy * cx - cz * sx, cy * cx, 0.0f) * s.z;
+        m[3] = Vec4(t, 1.0f);
+        return m;
+    }
+
+    // Same as above with the rotation given as a quaternion: M = T * R(q) * S
+    inline Mat4 ComposeTRS(const Vec3& t, const Quat& q, const Vec3& s)
+    {
+        const glm::mat3 r = glm::mat3_cast(q);
+
+        Mat4 m;
+        m[0] = Vec4(r[0] * s.x, 0.0f);
+        m[1] = Vec4(r[1] * s.y, 0.0f);
+        m[2] = Vec4(r[2] * s.z, 0.0f);
+        m[3] = Vec4(t, 1.0f);
+        return m;
+    }
+
+    // Euler radians <-> quaternion using the same Rz * Ry * Rx order as ComposeTRS
+    inline Quat QuatFromEuler(const Vec3& euler)
+    {
+        return Quat(euler);
+    }
+
+    inline Vec3 EulerFromQuat(const Quat& q)
+    {
+        return glm::eulerAngles(q);
+    }
+
+    // Inverse of a rotation + translation matrix (no scale): [R|t]^-1 = [R^T | -R^T t]
+    inline Mat4 InverseRigid(const Mat4& m)
+    {
+        const glm::mat3 rt = glm::transpose(glm::mat3(m));
+        const Vec3 t = -(rt * Vec3(m[3]));
+
+        Mat4 inv(rt);
+        inv[3] = Vec4(t, 1.0f);
+        return inv;
+    }
 }
 
 #endif
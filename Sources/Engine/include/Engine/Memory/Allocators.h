@@ -0,0 +1,86 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef ALLOCATORS_H
+#define ALLOCATORS_H
+
+#pragma once
+
+#include "Engine/Memory/Memory.h"
+
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace ZED
+{
+    // Standard allocator that charges everything to one MemoryTag, e.g.
+    // std::vector<Foo, TaggedAllocator<Foo, MemoryTag::Physics>>
+    template <typename T, MemoryTag Tag>
+    struct TaggedAllocator
+    {
+        using value_type = T;
+
+        // Tag is a non-type parameter, so allocator_traits can't rebind this on its own
+        template <typename U>
+        struct rebind { using other = TaggedAllocator<U, Tag>; };
+
+        TaggedAllocator() noexcept = default;
+
+        template <typename U>
+        TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept {}
+
+        T* allocate(size_t n)
+        {
+            if (n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+
+            void* p = Memory::Allocate(n * sizeof(T), Tag, alignof(T));
+            if (!p) throw std::bad_alloc();
+            return static_cast<T*>(p);
+        }
+
+        void deallocate(T* p, size_t n) noexcept
+        {
+            Memory::Free(p, n * sizeof(T), Tag, alignof(T));
+        }
+
+        template <typename U>
+        bool operator==(const TaggedAllocator<U, Tag>&) const noexcept { return true; }
+    };
+
+    // Standard allocator on the frame arena. deallocate() is a no-op, so containers using it
+    // must not outlive the frame (Memory::EndFrame()). Meant for transient containers built
+    // and dropped within a frame; per-frame systems that refill the same scratch every frame
+    // keep a persistent vector instead. Lua tables are GC objects and never come from here.
+    template <typename T>
+    struct FrameAllocator
+    {
+        using value_type = T;
+
+        FrameAllocator() noexcept = default;
+
+        template <typename U>
+        FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+        T* allocate(size_t n)
+        {
+            if (n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+
+            void* p = Memory::FrameAllocate(n * sizeof(T), alignof(T));
+            if (!p) throw std::bad_alloc();
+            return static_cast<T*>(p);
+        }
+
+        void deallocate(T*, size_t) noexcept {}
+
+        template <typename U>
+        bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+    };
+
+    // Scratch vector for work done within one frame
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace ZED
+{
+    // Subsystem an allocation is charged to in the memory report
+    enum class MemoryTag : uint8_t
+    {
+        General,
+        ECS,
+        Events,
+        Scripting,
+        Physics,
+        Renderer,
+        Frame, // frame arena; everything in it is released by Memory::EndFrame()
+        Count
+    };
+
+    inline constexpr size_t kMemoryTagCount = static_cast<size_t>(MemoryTag::Count);
+
+    // Per-tag counters. The frame fields cover the last completed frame.
+    struct MemoryTagStats
+    {
+        int64_t liveBytes = 0;         // allocated and not yet freed
+        int64_t peakLiveBytes = 0;     // highest liveBytes seen at the end of a frame
+        uint64_t frameBytes = 0;       // bytes allocated during the last frame
+        uint64_t frameAllocations = 0; // allocations during the last frame
+        uint64_t peakFrameBytes = 0;   // most bytes allocated in any one frame
+        uint64_t totalBytes = 0;       // bytes allocated since startup
+        uint64_t totalAllocations = 0; // allocations since startup
+    };
+
+    /**
+     * Engine allocation entry point. Every allocation is charged to a MemoryTag.
+     *
+     * Allocate()/Free() take the size back on free, so no headers are stored. Small
+     * requests (up to kMaxPooledSize bytes, alignment up to kPoolAlignment) come from
+     * per-thread free lists carved out of shared 64 KiB chunks. A block may be freed on
+     * any thread and joins that thread's list. Pool chunks are kept until the process
+     * exits. Larger requests go to malloc, or aligned new when over-aligned.
+     *
+     * FrameAllocate() bumps a pointer in a per-frame arena, from any thread. The memory
+     * stays valid until EndFrame(), which releases the whole arena at once. When a frame
+     * outgrows the arena the rest spills to the heap, and the arena grows at the next
+     * EndFrame() so that it stops spilling.
+     *
+     * Counters are relaxed atomics, so the numbers read while other threads allocate are
+     * approximate.
+     */
+    class ZEDENGINE_API Memory
+    {
+    public:
+        static constexpr size_t kMaxPooledSize = 256;
+        static constexpr size_t kPoolAlignment = 16;
+
+        // Read [Memory] FrameArenaSize and ReportInterval from the loaded INI
+        static void InitFromConfig();
+
+        // Returns null when out of memory. Pass the same size, tag and alignment to Free().
+        static void* Allocate(size_t size, MemoryTag tag, size_t alignment = alignof(std::max_align_t));
+        static void Free(void* ptr, size_t size, MemoryTag tag, size_t alignment = alignof(std::max_align_t));
+
+        // realloc() semantics for default-aligned blocks; returns null and keeps ptr on failure
+        static void* Reallocate(void* ptr, size_t oldSize, size_t newSize, MemoryTag tag);
+
+        // Scratch memory that lives until the end of the current frame; never freed individually
+        static void* FrameAllocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        // Call once per frame, after the last user of frame memory. Releases the frame arena,
+        // closes the frame's counters and prints the report every [Memory] ReportInterval frames.
+        static void EndFrame();
+
+        static MemoryTagStats GetStats(MemoryTag tag);
+        static const char* GetTagName(MemoryTag tag);
+
+        // Live, peak and per-frame bytes for every tag, plus frame arena and pool usage
+        static void Report(std::ostream& out);
+    };
+}
+
+#endif
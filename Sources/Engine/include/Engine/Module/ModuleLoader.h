@@ -9,7 +9,7 @@
 
 #include <string>
 #include <unordered_map>
-#include <Windows.h>
+#include <vector>
 
 namespace ZED::Module
 {
@@ -17,17 +17,25 @@ namespace ZED::Module
     class ZEDENGINE_API ModuleLoader
     {
     public:
+        // HMODULE on Windows, dlopen() handle everywhere else
+        using Handle = void*;
+
         // Load modules listed under [Modules] in the ini file
         static void LoadModulesFromINI(const std::string& section = "Modules");
 
-        // Get function pointer from a loaded module
-        static FARPROC GetFunction(const std::string& moduleName, const std::string& functionName);
+        // Load one library and register it as moduleName (replacing any module of that name)
+        static bool LoadModule(const std::string& moduleName, const std::string& libPath);
+
+        // Get function pointer from a loaded module, cast it to the expected signature
+        static void* GetFunction(const std::string& moduleName, const std::string& functionName);
 
-        // Free all loaded modules
+        // Free all loaded modules, last loaded first: a module that loads another one itself
+        // (Input-Replay loading the input it records) outlives it
         static void Cleanup();
 
     private:
-        static inline std::unordered_map<std::string, HMODULE> s_modules;
+        static inline std::unordered_map<std::string, Handle> s_modules;
+        static inline std::vector<std::string> s_loadOrder;
     };
 }
 
@@ -0,0 +1,27 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef PHYSICS_H
+#define PHYSICS_H
+
+#pragma once
+
+#include "Engine/Interfaces/Physics/IPhysics.h"
+
+namespace ZED
+{
+    class ZEDENGINE_API Physics
+    {
+    public:
+        static void SetImplementation(IPhysics* impl);
+
+        // nullptr when no physics module is loaded; physics is optional
+        static IPhysics* Get();
+
+    private:
+        static IPhysics* s_Impl;
+    };
+}
+
+#endif
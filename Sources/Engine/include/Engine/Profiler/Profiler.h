@@ -0,0 +1,110 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define ZED_PROFILER_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define ZED_PROFILER_RDTSC 1
+#endif
+
+namespace ZED
+{
+    /**
+     * Frame profiler. Zones are recorded only while a capture is running, into a ring buffer
+     * owned by the recording thread (no locks; the oldest events are overwritten when a
+     * capture outgrows it). A capture is written as Chrome trace_event JSON, which opens in
+     * Perfetto (ui.perfetto.dev) or chrome://tracing.
+     *
+     * Instrument code with the ZED_PROFILE_* macros below; they compile to nothing unless
+     * the build defines ZED_PROFILE_ENABLED (CMake option ZED_ENABLE_PROFILER).
+     */
+    class ZEDENGINE_API Profiler
+    {
+    public:
+        // Read [Profiler] CaptureFrames, CaptureFirstFrame, TraceFile and EventsPerThread
+        static void InitFromConfig();
+
+        // Call at the top of every main loop iteration; starts and ends the configured capture
+        static void NewFrame();
+
+        // Write a still running capture. Call before shutting the job system down.
+        static void Shutdown();
+
+        static void BeginCapture();
+        static void EndCapture();
+        static bool IsCapturing() { return s_capturing.load(std::memory_order_relaxed); }
+
+        // Write the last capture as Chrome trace JSON; returns false when the file can't be opened
+        static bool WriteChromeTrace(const std::string& path);
+
+        // Label the calling thread in exported traces
+        static void SetThreadName(const char* name);
+
+        // Raw timestamp: TSC ticks on x86, steady_clock ticks elsewhere
+        static uint64_t Now()
+        {
+#if defined(ZED_PROFILER_RDTSC)
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        // Append a finished zone to the calling thread's buffer. name must outlive the capture.
+        static void Record(const char* name, uint64_t start, uint64_t end);
+
+    private:
+        static std::atomic<bool> s_capturing;
+    };
+
+    // Records the enclosing scope as one zone
+    class ProfileZone
+    {
+    public:
+        explicit ProfileZone(const char* name)
+            : m_name(name), m_start(Profiler::IsCapturing() ? Profiler::Now() : 0)
+        {
+        }
+
+        ~ProfileZone()
+        {
+            if (m_start != 0) Profiler::Record(m_name, m_start, Profiler::Now());
+        }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+    private:
+        const char* m_name;
+        uint64_t m_start;
+    };
+}
+
+#define ZED_PROFILE_CONCAT_INNER(a, b) a##b
+#define ZED_PROFILE_CONCAT(a, b) ZED_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(ZED_PROFILE_ENABLED) && ZED_PROFILE_ENABLED
+    // Zone covering the rest of the enclosing scope; name must be a string that outlives the capture
+    #define ZED_PROFILE_SCOPE(name) ::ZED::ProfileZone ZED_PROFILE_CONCAT(zedProfileZone, __LINE__)(name)
+    #define ZED_PROFILE_FUNCTION() ZED_PROFILE_SCOPE(__func__)
+    #define ZED_PROFILE_THREAD(name) ::ZED::Profiler::SetThreadName(name)
+#else
+    #define ZED_PROFILE_SCOPE(name) ((void)0)
+    #define ZED_PROFILE_FUNCTION() ((void)0)
+    #define ZED_PROFILE_THREAD(name) ((void)0)
+#endif
+
+#endif
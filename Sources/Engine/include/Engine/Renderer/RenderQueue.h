@@ -0,0 +1,133 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#pragma once
+
+#include "Engine/Interfaces/Renderer/IRenderer.h"
+#include "Engine/Math/Math.h"
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace ZED
+{
+    enum class RenderPass : uint8_t
+    {
+        Opaque = 0,      // front to back
+        Transparent = 1, // back to front
+        Overlay = 2,     // front to back, drawn last
+    };
+
+    /**
+     * 64-bit draw sort key, most significant bits first:
+     *
+     *   [63..56] pass   [55..32] material   [31..0] depth
+     *
+     * Sorting ascending groups draws by pass, then by material (so state
+     * changes happen once per run), then by depth within a run.
+     */
+    namespace RenderKey
+    {
+        constexpr uint32_t kMaterialMask = 0xFFFFFFu;
+
+        // Map a float onto a uint32 that sorts the same way, negatives included
+        inline uint32_t OrderedDepth(float depth)
+        {
+            const uint32_t bits = std::bit_cast<uint32_t>(depth);
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        }
+
+        // viewDepth is the view-space distance along the camera's forward axis
+        inline uint64_t Make(RenderPass pass, uint32_t material, float viewDepth)
+        {
+            uint32_t depth = OrderedDepth(viewDepth);
+            if (pass == RenderPass::Transparent)
+                depth = ~depth;
+
+            return (static_cast<uint64_t>(pass) << 56) |
+                   (static_cast<uint64_t>(material & kMaterialMask) << 32) |
+                   depth;
+        }
+
+        inline RenderPass GetPass(uint64_t key) { return static_cast<RenderPass>(key >> 56); }
+        inline uint32_t GetMaterial(uint64_t key) { return static_cast<uint32_t>(key >> 32) & kMaterialMask; }
+
+        // Pass + material: draws with equal state bits can share one instanced batch
+        inline uint64_t GetStateBits(uint64_t key) { return key & 0xFFFFFFFF00000000ull; }
+    }
+
+    struct DrawPacket
+    {
+        uint64_t key = 0;
+        Mat4 model{ 1.0f };
+    };
+
+    // Draws recorded by one thread. Only ever touched by its owner until RenderQueue::Flush().
+    class RenderCommandList
+    {
+    public:
+        void DrawCube(uint64_t key, const Mat4& model) { m_packets.push_back({ key, model }); }
+
+        void Clear() { m_packets.clear(); }
+        size_t Size() const { return m_packets.size(); }
+        const std::vector<DrawPacket>& GetPackets() const { return m_packets; }
+
+    private:
+        std::vector<DrawPacket> m_packets;
+    };
+
+    struct RenderQueueStats
+    {
+        uint32_t packets = 0;
+        uint32_t batches = 0;
+        uint32_t lists = 0;      // command lists that recorded at least one packet
+        uint32_t sortPasses = 0; // radix passes actually run (passes over constant bytes are skipped)
+    };
+
+    /**
+     * Deferred, backend-agnostic draw submission.
+     *
+     * Every job system thread records into its own RenderCommandList, so
+     * recording from ParallelForEach needs no locks. Flush() merges all lists,
+     * radix-sorts them by key, packs the models into one contiguous array and
+     * hands the active IRenderer the whole frame as a list of batches.
+     *
+     *   RenderQueue::Begin();
+     *   ParallelForEach(view, [](auto e, auto& wm) { RenderQueue::GetList().DrawCube(key, wm.matrix); });
+     *   renderer->BeginFrame(...);
+     *   RenderQueue::Flush(*renderer);
+     *   renderer->EndFrame();
+     */
+    class ZEDENGINE_API RenderQueue
+    {
+    public:
+        struct SortEntry
+        {
+            uint64_t key;
+            uint32_t list;
+            uint32_t index;
+        };
+
+        // Clear every list and size the set to the job system's thread count. Main thread only.
+        static void Begin();
+
+        // The calling thread's command list
+        static RenderCommandList& GetList();
+
+        // Sort everything recorded since Begin() and submit it as one SubmitBatches() call
+        static void Flush(IRenderer& renderer);
+
+        static const RenderQueueStats& GetLastStats();
+
+        // Stable LSD radix sort on SortEntry::key; scratch is resized as needed.
+        // Returns the number of 8-bit passes that were needed.
+        static uint32_t SortEntries(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
+    };
+}
+
+#endif
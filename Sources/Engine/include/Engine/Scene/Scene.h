@@ -0,0 +1,50 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef SCENE_H
+#define SCENE_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ZED
+{
+    /**
+     * Binary scene files (.zscn). A scene is a count of entities plus one block per saved
+     * component pool. Each pool stores the scene-local index of every entity that has the
+     * component, then one contiguous array per field (structure of arrays), each 16-byte
+     * aligned. Entity references are stored as scene indices and scripts as indices into
+     * a table of script paths.
+     *
+     * Load() maps the file and hands every pool to the registry as one insert() range that
+     * reads straight out of the mapping, so nothing is parsed per entity. Script paths are
+     * resolved to ScriptIds once per path, through the active scripting module.
+     *
+     * Saved pools: Transform, Hierarchy, Bounds, Camera, Collider, RigidBody,
+     * PreviousTransform and Script. Derived state (world matrices, physics bodies, dirty
+     * tags) is rebuilt by the systems' construction signals. Pools the loader doesn't know
+     * and pools saved with a different layout version are skipped with a warning.
+     * Files are little-endian.
+     */
+    class ZEDENGINE_API Scene
+    {
+    public:
+        static constexpr uint32_t kVersion = 1;
+
+        // Write every saved pool of reg to path; false when the file can't be written
+        static bool Save(const Registry& reg, const std::string& path);
+
+        // Create the scene's entities in reg and insert its pools. created, if given, receives
+        // the new entities in scene order. False (with reg untouched) when the file is
+        // missing, truncated or of another format version.
+        static bool Load(Registry& reg, const std::string& path, std::vector<entt::entity>* created = nullptr);
+    };
+}
+
+#endif
@@ -9,6 +9,9 @@
 
 #include "Engine/Interfaces/Scripting/IScripting.h"
 
+#include <cstddef>
+#include <ostream>
+
 namespace ZED
 {
     /**
@@ -23,6 +26,10 @@ namespace ZED
         // Get the active scripting implementation
         static IScripting* Get();
 
+        // The count most expensive scripts by time per frame, each with its heaviest instance.
+        // Prints nothing unless the implementation is profiling ([Scripting] Profile=1 for Luau).
+        static void ReportTopScripts(std::ostream& out, size_t count = 5);
+
     private:
         static IScripting* s_Impl;
     };
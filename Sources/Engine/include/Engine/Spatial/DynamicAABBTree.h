@@ -0,0 +1,311 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef DYNAMICAABBTREE_H
+#define DYNAMICAABBTREE_H
+
+#pragma once
+
+#include "Engine/Math/Math.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ZED
+{
+    struct AABB
+    {
+        Vec3 min{ 0.0f };
+        Vec3 max{ 0.0f };
+
+        static AABB FromSphere(const Vec3& center, float radius)
+        {
+            return AABB{ center - Vec3(radius), center + Vec3(radius) };
+        }
+
+        static AABB Union(const AABB& a, const AABB& b)
+        {
+            return AABB{ glm::min(a.min, b.min), glm::max(a.max, b.max) };
+        }
+
+        Vec3 Center() const { return (min + max) * 0.5f; }
+
+        float SurfaceArea() const
+        {
+            const Vec3 d = max - min;
+            return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+        }
+
+        bool Contains(const AABB& o) const
+        {
+            return min.x <= o.min.x && min.y <= o.min.y && min.z <= o.min.z &&
+                   max.x >= o.max.x && max.y >= o.max.y && max.z >= o.max.z;
+        }
+
+        bool Overlaps(const AABB& o) const
+        {
+            return min.x <= o.max.x && max.x >= o.min.x &&
+                   min.y <= o.max.y && max.y >= o.min.y &&
+                   min.z <= o.max.z && max.z >= o.min.z;
+        }
+    };
+
+    /**
+     * Incremental bounding volume hierarchy over AABBs.
+     *
+     * Leaves store a "fat" box (the tight box grown by a margin) so small motions
+     * don't touch the tree at all: MoveProxy() only re-inserts a leaf once its
+     * tight box escapes the fat one. Insertions pick the sibling with the lowest
+     * surface-area cost and AVL-style rotations keep the height logarithmic.
+     *
+     * For scenes where most proxies move every frame, SetProxyBounds() + Refit()
+     * updates boxes in place without changing the topology, and Rebuild() builds
+     * a fresh top-down tree from the current leaves.
+     *
+     * Proxy ids are node indices and stay valid across Refit() and Rebuild().
+     * Queries are const and may run concurrently; mutation needs exclusive access.
+     */
+    class ZEDENGINE_API DynamicAABBTree
+    {
+    public:
+        static constexpr int32_t kNullNode = -1;
+
+        explicit DynamicAABBTree(float margin = 0.1f);
+
+        // Insert a leaf and return its proxy id
+        int32_t CreateProxy(const AABB& box, uint32_t userData);
+
+        void DestroyProxy(int32_t proxy);
+
+        // Re-insert the leaf if box left its fat AABB. Returns true when the tree changed.
+        bool MoveProxy(int32_t proxy, const AABB& box);
+
+        // Overwrite the leaf box (no margin) without touching the topology; call Refit() afterwards
+        void SetProxyBounds(int32_t proxy, const AABB& box);
+
+        // Recompute every internal box bottom-up. Keeps the topology, so quality degrades as things drift.
+        void Refit();
+
+        // Throw away the internal nodes and build a new tree top-down (median split on the widest axis)
+        void Rebuild();
+
+        void Clear();
+
+        uint32_t GetUserData(int32_t proxy) const { return m_Nodes[proxy].userData; }
+        const AABB& GetFatAABB(int32_t proxy) const { return m_Nodes[proxy].box; }
+
+        size_t GetProxyCount() const { return m_ProxyCount; }
+        int32_t GetHeight() const { return m_Root == kNullNode ? 0 : m_Nodes[m_Root].height; }
+
+        // Sum of internal node areas over the root area; lower is better, useful to decide when to Rebuild()
+        float GetAreaRatio() const;
+
+        // fn(int32_t proxy) -> bool for every leaf overlapping box; return false to stop
+        template <typename Fn>
+        void Query(const AABB& box, Fn&& fn) const
+        {
+            NodeStack stack;
+            stack.Push(m_Root);
+            while (!stack.Empty())
+            {
+                const int32_t id = stack.Pop();
+                if (id == kNullNode) continue;
+
+                const Node& node = m_Nodes[id];
+                if (!node.box.Overlaps(box)) continue;
+
+                if (node.IsLeaf())
+                {
+                    if (!fn(id)) return;
+                }
+                else
+                {
+                    stack.Push(node.child1);
+                    stack.Push(node.child2);
+                }
+            }
+        }
+
+        // fn(int32_t proxy) -> bool for every leaf touching the convex volume (planes point inward).
+        // Subtrees fully inside every plane are reported without further plane tests.
+        template <typename Fn>
+        void QueryPlanes(const Vec4* planes, int planeCount, Fn&& fn) const
+        {
+            NodeStack stack;
+            stack.Push(m_Root);
+            while (!stack.Empty())
+            {
+                const int32_t id = stack.Pop();
+                if (id == kNullNode) continue;
+
+                const Node& node = m_Nodes[id];
+                bool fullyInside = true;
+                bool outside = false;
+                for (int p = 0; p < planeCount && !outside; ++p)
+                {
+                    const Vec4& pl = planes[p];
+
+                    // Corner furthest along the normal (p-vertex) and the opposite one (n-vertex)
+                    const Vec3 pv(pl.x >= 0.0f ? node.box.max.x : node.box.min.x,
+                                  pl.y >= 0.0f ? node.box.max.y : node.box.min.y,
+                                  pl.z >= 0.0f ? node.box.max.z : node.box.min.z);
+                    const Vec3 nv(pl.x >= 0.0f ? node.box.min.x : node.box.max.x,
+                                  pl.y >= 0.0f ? node.box.min.y : node.box.max.y,
+                                  pl.z >= 0.0f ? node.box.min.z : node.box.max.z);
+
+                    outside = pl.x * pv.x + pl.y * pv.y + pl.z * pv.z + pl.w < 0.0f;
+                    fullyInside = fullyInside && pl.x * nv.x + pl.y * nv.y + pl.z * nv.z + pl.w >= 0.0f;
+                }
+                if (outside) continue;
+
+                if (fullyInside)
+                {
+                    if (!ReportSubtree(id, fn)) return;
+                }
+                else if (node.IsLeaf())
+                {
+                    if (!fn(id)) return;
+                }
+                else
+                {
+                    stack.Push(node.child1);
+                    stack.Push(node.child2);
+                }
+            }
+        }
+
+        // Walks leaves whose box the ray [origin, origin + dir * maxT] enters, nearest subtrees first.
+        // fn(int32_t proxy, float maxT) -> float: return a hit distance below maxT to clip the ray,
+        // anything else (e.g. maxT or a negative value) to ignore the leaf. Returning 0 stops the walk.
+        template <typename Fn>
+        void Raycast(const Vec3& origin, const Vec3& dir, float maxT, Fn&& fn) const
+        {
+            const Vec3 invDir(1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z);
+
+            NodeStack stack;
+            stack.Push(m_Root);
+            while (!stack.Empty())
+            {
+                const int32_t id = stack.Pop();
+                if (id == kNullNode) continue;
+
+                const Node& node = m_Nodes[id];
+                if (RayBoxEntry(origin, invDir, node.box, maxT) < 0.0f) continue;
+
+                if (node.IsLeaf())
+                {
+                    const float t = fn(id, maxT);
+                    if (t == 0.0f) return;
+                    if (t > 0.0f && t < maxT) maxT = t;
+                }
+                else
+                {
+                    // Push the far child first so the near one is popped next and clips maxT early
+                    const float t1 = RayBoxEntry(origin, invDir, m_Nodes[node.child1].box, maxT);
+                    const float t2 = RayBoxEntry(origin, invDir, m_Nodes[node.child2].box, maxT);
+                    const bool firstNear = t1 >= 0.0f && (t2 < 0.0f || t1 <= t2);
+                    stack.Push(firstNear ? node.child2 : node.child1);
+                    stack.Push(firstNear ? node.child1 : node.child2);
+                }
+            }
+        }
+
+        // Slab test. Entry distance in [0, maxT], or -1 when the ray misses the box.
+        static float RayBoxEntry(const Vec3& origin, const Vec3& invDir, const AABB& box, float maxT)
+        {
+            const Vec3 t0 = (box.min - origin) * invDir;
+            const Vec3 t1 = (box.max - origin) * invDir;
+            const Vec3 tNear = glm::min(t0, t1);
+            const Vec3 tFar = glm::max(t0, t1);
+
+            const float enter = glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, 0.0f));
+            const float exit = glm::min(glm::min(tFar.x, tFar.y), glm::min(tFar.z, maxT));
+            return enter <= exit ? enter : -1.0f;
+        }
+
+    private:
+        struct Node
+        {
+            AABB box;
+            int32_t parent = kNullNode; // next free node while on the free list
+            int32_t child1 = kNullNode;
+            int32_t child2 = kNullNode;
+            int32_t height = 0;         // 0 for leaves, -1 for free nodes
+            uint32_t userData = 0;
+
+            bool IsLeaf() const { return child1 == kNullNode; }
+        };
+
+        // Traversal stack; balanced trees stay far below the inline capacity
+        struct NodeStack
+        {
+            int32_t inlineItems[128];
+            std::vector<int32_t> overflow;
+            int32_t count = 0;
+
+            bool Empty() const { return count == 0 && overflow.empty(); }
+
+            void Push(int32_t id)
+            {
+                if (count < 128) inlineItems[count++] = id;
+                else overflow.push_back(id);
+            }
+
+            int32_t Pop()
+            {
+                if (!overflow.empty())
+                {
+                    const int32_t id = overflow.back();
+                    overflow.pop_back();
+                    return id;
+                }
+                return inlineItems[--count];
+            }
+        };
+
+        template <typename Fn>
+        bool ReportSubtree(int32_t root, Fn& fn) const
+        {
+            NodeStack stack;
+            stack.Push(root);
+            while (!stack.Empty())
+            {
+                const Node& node = m_Nodes[stack.Pop()];
+                if (node.IsLeaf())
+                {
+                    if (!fn(static_cast<int32_t>(&node - m_Nodes.data()))) return false;
+                }
+                else
+                {
+                    stack.Push(node.child1);
+                    stack.Push(node.child2);
+                }
+            }
+            return true;
+        }
+
+        int32_t AllocateNode();
+        void FreeNode(int32_t id);
+
+        void InsertLeaf(int32_t leaf);
+        void RemoveLeaf(int32_t leaf);
+
+        // Rotate the subtree rooted at a if it is unbalanced; returns the new subtree root
+        int32_t Balance(int32_t a);
+
+        // Recompute box and height of every ancestor starting at id
+        void FixUpwards(int32_t id);
+
+        int32_t BuildTopDown(int32_t* leaves, int32_t count);
+
+        std::vector<Node> m_Nodes;
+        int32_t m_Root = kNullNode;
+        int32_t m_FreeList = kNullNode;
+        size_t m_ProxyCount = 0;
+        float m_Margin;
+    };
+}
+
+#endif
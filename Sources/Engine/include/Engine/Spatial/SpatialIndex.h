@@ -0,0 +1,60 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef SPATIALINDEX_H
+#define SPATIALINDEX_H
+
+#pragma once
+
+#include "Engine/ECS/ECS.h"
+#include "Engine/Math/Math.h"
+#include "Engine/Spatial/DynamicAABBTree.h"
+#include "Engine/ECS/Systems/CullingSystem.h"
+
+#include <vector>
+
+namespace ZED
+{
+    // World-space BVH over every entity with a WorldMatrixComponent, using the same bounding
+    // sphere as culling (BoundsComponent or the unit cube). Stays in sync incrementally:
+    // registry signals record which entities moved, and Update() only touches those.
+    // Each registry has its own tree, kept in the registry's context.
+    struct ZEDENGINE_API SpatialIndex
+    {
+        // Hook TransformDirty/WorldMatrixComponent/BoundsComponent signals. Call once per registry,
+        // after TransformSystem::connect().
+        static void connect(Registry& r);
+
+        // Insert, move or refit the entities recorded since the last call.
+        // Call right after TransformSystem::UpdateWorldMatrices().
+        static void Update(Registry& r);
+
+        // Queries replace the contents of out. The tree is tested first, then each
+        // candidate's exact bounding sphere. Safe to call from several threads at once.
+        static void QueryAABB(const Registry& r, const AABB& box, std::vector<entt::entity>& out);
+        static void QuerySphere(const Registry& r, const Vec3& center, float radius, std::vector<entt::entity>& out);
+        static void QueryFrustum(const Registry& r, const Frustum& frustum, std::vector<entt::entity>& out);
+
+        // Closest entity whose bounding sphere the ray hits within maxDistance, or entt::null
+        static entt::entity Raycast(const Registry& r, const Vec3& origin, const Vec3& direction, float maxDistance,
+                                    float* outDistance = nullptr);
+
+        static const DynamicAABBTree& GetTree(Registry& r);
+
+        // Drop every proxy (e.g. when the registry is cleared)
+        static void Clear(Registry& r);
+
+    private:
+        static void onMoved  (Registry& r, entt::entity e);
+        static void onDestroy(Registry& r, entt::entity e);
+
+        // Tree, proxy map and pending moves of one registry, created on first use
+        struct IndexState;
+        static IndexState& GetState(Registry& r);
+        // Null when nothing was ever indexed in r
+        static const IndexState* FindState(const Registry& r);
+    };
+}
+
+#endif
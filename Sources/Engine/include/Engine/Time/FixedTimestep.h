@@ -0,0 +1,68 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef FIXEDTIMESTEP_H
+#define FIXEDTIMESTEP_H
+
+#pragma once
+
+#include <cstdint>
+
+namespace ZED
+{
+    /**
+     * Fixed-rate simulation clock.
+     *
+     * Frame time goes into an accumulator and comes out as whole steps of GetStep() seconds,
+     * so scripts and physics see the same dt at any frame rate. Per frame:
+     *
+     *     for (uint32_t i = FixedTimestep::Advance(frameDt); i > 0; --i)
+     *         simulate(FixedTimestep::GetStep());
+     *     render(FixedTimestep::GetAlpha());
+     *
+     * A frame never runs more than the catch-up limit; the time beyond it is dropped, so one
+     * slow frame makes the simulation fall behind instead of spiralling into ever longer frames.
+     *
+     * In lockstep every Advance() is exactly one step whatever the frame took, so the number of
+     * steps a run takes depends only on its frame count (see Determinism).
+     */
+    class ZEDENGINE_API FixedTimestep
+    {
+    public:
+        // Read [Time] FixedTimeStep / MaxCatchUpSteps from the loaded INI and reset the clock
+        static void InitFromConfig();
+
+        static void Configure(double step, uint32_t maxCatchUpSteps);
+
+        // Add a frame's elapsed time; returns how many steps to run now
+        static uint32_t Advance(double frameDeltaTime);
+
+        // One step per Advance(), ignoring frame time. Survives Configure().
+        static void SetLockstep(bool lockstep) { s_lockstep = lockstep; }
+        static bool IsLockstep() { return s_lockstep; }
+
+        // Seconds per step
+        static double GetStep() { return s_step; }
+
+        // How far the clock is into the next step, in [0, 1); blends the previous and current
+        // simulation state for rendering
+        static float GetAlpha() { return static_cast<float>(s_accumulator / s_step); }
+
+        // Steps taken since InitFromConfig()/Configure(); the simulation time is GetTick() * GetStep()
+        static uint64_t GetTick() { return s_tick; }
+
+        // Frame time thrown away by the catch-up limit since the last reset
+        static double GetDroppedTime() { return s_dropped; }
+
+    private:
+        static double s_step;
+        static uint32_t s_maxCatchUpSteps;
+        static double s_accumulator;
+        static uint64_t s_tick;
+        static double s_dropped;
+        static bool s_lockstep;
+    };
+}
+
+#endif
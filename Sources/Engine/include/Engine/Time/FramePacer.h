@@ -0,0 +1,42 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#pragma once
+
+#include <chrono>
+
+namespace ZED
+{
+    /**
+     * Holds the main loop to a target frame time.
+     *
+     * OS sleeps overshoot by an unpredictable amount (up to a scheduler tick), so Wait() sleeps
+     * in 1 ms slices only while the remaining time exceeds its running estimate of that
+     * overshoot, then spins for the last stretch. The estimate (mean + one standard deviation of
+     * observed slices) adapts to the machine, keeping both the spin short and the frame on time.
+     */
+    class ZEDENGINE_API FramePacer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        // Read [Time] TargetFrameRate from the loaded INI (0 = uncapped)
+        static void InitFromConfig();
+
+        static void SetTargetFrameRate(double framesPerSecond);
+        static double GetTargetFrameRate();
+
+        // Call once at the end of each frame; returns when the frame's time slot is over.
+        // Returns immediately when uncapped or when the frame already ran long.
+        static void Wait();
+
+        // Seconds Wait() spent sleeping and spinning in the last frame
+        static double GetLastWaitTime();
+    };
+}
+
+#endif
@@ -9,20 +9,50 @@
 
 #include "Engine/IWindow.h"
 #include "Engine/Time.h"
+#include "Engine/Time/FixedTimestep.h"
+#include "Engine/Time/FramePacer.h"
+#include "Engine/Determinism/Determinism.h"
+#include "Engine/Profiler/Profiler.h"
+#include "Engine/Memory/Memory.h"
+#include "Engine/Memory/Allocators.h"
 #include "Engine/Input/Input.h"
 #include "Engine/Config/Config.h"
 #include "Engine/Module/ModuleLoader.h"
 #include "Engine/Events/EventSystem.h"
+#include "Engine/Jobs/JobSystem.h"
 #include "Engine/ECS/ECS.h"
+#include "Engine/ECS/ParallelForEach.h"
+#include "Engine/ECS/SystemScheduler.h"
+#include "Engine/ECS/Snapshot.h"
+#include "Engine/ECS/StateHash.h"
+#include "Engine/Hash/Hash.h"
 #include "Engine/ECS/Components/ScriptComponent.h"
 #include "Engine/ECS/Systems/ScriptSystems.h"
 #include "Engine/ECS/Components/TransformComponent.h"
+#include "Engine/ECS/Components/WorldMatrixComponent.h"
 #include "Engine/ECS/Systems/TransformSystem.h"
+#include "Engine/ECS/Components/PreviousTransformComponent.h"
+#include "Engine/ECS/Systems/InterpolationSystem.h"
+#include "Engine/ECS/Components/HierarchyComponent.h"
+#include "Engine/ECS/Systems/HierarchySystem.h"
 #include "Engine/ECS/Components/CameraComponent.h"
 #include "Engine/ECS/Systems/CameraSystem.h"
 #include "Engine/ECS/Systems/CameraController.h"
+#include "Engine/ECS/Components/BoundsComponent.h"
+#include "Engine/ECS/Systems/CullingSystem.h"
+#include "Engine/ECS/Components/RigidBodyComponent.h"
+#include "Engine/ECS/Components/ColliderComponent.h"
+#include "Engine/ECS/Systems/PhysicsSystem.h"
+#include "Engine/Spatial/DynamicAABBTree.h"
+#include "Engine/Spatial/SpatialIndex.h"
+#include "Engine/IO/MappedFile.h"
+#include "Engine/Scene/Scene.h"
 #include "Engine/Interfaces/Scripting/IScripting.h"
+#include "Engine/Scripting/Scripting.h"
 #include "Engine/Interfaces/Renderer/IRenderer.h"
+#include "Engine/Interfaces/Physics/IPhysics.h"
+#include "Engine/Physics/Physics.h"
+#include "Engine/Renderer/RenderQueue.h"
 #include "Engine/Math/Math.h"
 
 #endif
@@ -0,0 +1,266 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Determinism/Determinism.h"
+#include "Engine/Config/Config.h"
+#include "Engine/ECS/StateHash.h"
+#include "Engine/Profiler/Profiler.h"
+#include "Engine/Time/FixedTimestep.h"
+
+#include <array>
+#include <bit>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace ZED
+{
+    namespace
+    {
+        bool s_enabled = false;
+        uint64_t s_seed = 0;
+        uint64_t s_tick = 0;
+
+        // Recorded since the last BeginTick(), waiting for a tick number
+        std::vector<InputEvent> s_pending;
+        std::vector<InputRecord> s_stream;
+        size_t s_tickBegin = 0;
+        std::vector<uint8_t> s_keys; // indexed by Key
+
+        std::array<uint64_t, 4> s_rng{};
+
+        StateHash s_hash;
+        uint64_t s_lastHash = 0;
+        uint64_t s_hashedTicks = 0;
+        uint64_t s_verifyInterval = 0;
+        std::ofstream s_hashLog;
+        std::string s_hashFile;
+
+        uint64_t SplitMix64(uint64_t& x)
+        {
+            uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        void SetKey(Key key, bool down)
+        {
+            const size_t index = static_cast<size_t>(key);
+            if (index >= s_keys.size()) s_keys.resize(index + 1, 0);
+            s_keys[index] = down ? 1 : 0;
+        }
+    }
+
+    void Determinism::InitFromConfig()
+    {
+        const auto& ini = Config::Get();
+        s_enabled = ini.GetBoolValue("Determinism", "Enabled", false);
+
+        // 64-bit seeds don't fit GetLongValue() on every platform
+        Seed(std::strtoull(ini.GetValue("Determinism", "Seed", "1"), nullptr, 0));
+
+        const long verify = ini.GetLongValue("Determinism", "VerifyInterval", 0);
+        s_verifyInterval = verify > 0 ? static_cast<uint64_t>(verify) : 0;
+
+        s_tick = 0;
+        s_pending.clear();
+        s_stream.clear();
+        s_tickBegin = 0;
+        s_keys.clear();
+        s_hash.Reset();
+        s_lastHash = 0;
+        s_hashedTicks = 0;
+
+        FixedTimestep::SetLockstep(s_enabled);
+        if (!s_enabled) return;
+
+        s_hashFile = ini.GetValue("Determinism", "HashFile", "");
+        if (!s_hashFile.empty())
+        {
+            s_hashLog.open(s_hashFile, std::ios::out | std::ios::trunc);
+            if (!s_hashLog)
+            {
+                std::cerr << "[ZED::Determinism] Can't open hash log " << s_hashFile << "\n";
+                s_hashFile.clear();
+            }
+        }
+
+        std::cout << "[ZED::Determinism] Lockstep at " << FixedTimestep::GetStep() << " s per tick, seed " << s_seed
+                  << (s_hashFile.empty() ? "" : ", hashes to " + s_hashFile) << "\n";
+    }
+
+    void Determinism::Shutdown()
+    {
+        if (!s_enabled) return;
+
+        if (s_hashLog.is_open())
+            s_hashLog.close();
+
+        const auto flags = std::cout.flags();
+        std::cout << "[ZED::Determinism] " << s_hashedTicks << " ticks, " << s_stream.size() << " input events, final state hash "
+                  << std::hex << std::setw(16) << std::setfill('0') << s_lastHash << std::setfill(' ') << "\n";
+        std::cout.flags(flags);
+    }
+
+    bool Determinism::IsEnabled()
+    {
+        return s_enabled;
+    }
+
+    void Determinism::AttachInput(IInput* input)
+    {
+        if (!s_enabled || !input) return;
+        input->SetEventCallback([](const InputEvent& e) { RecordInput(e); });
+    }
+
+    void Determinism::RecordInput(const InputEvent& e)
+    {
+        s_pending.push_back(e);
+    }
+
+    void Determinism::BeginTick(uint64_t tick)
+    {
+        s_tick = tick;
+        s_tickBegin = s_stream.size();
+
+        uint32_t sequence = 0;
+        for (const InputEvent& e : s_pending)
+        {
+            s_stream.push_back(InputRecord{ tick, sequence++, e });
+
+            switch (e.type)
+            {
+                case InputEventType::KeyDown:
+                case InputEventType::MouseButtonDown:
+                case InputEventType::GamepadButtonDown:
+                    SetKey(e.key, true);
+                    break;
+                case InputEventType::KeyUp:
+                case InputEventType::MouseButtonUp:
+                case InputEventType::GamepadButtonUp:
+                    SetKey(e.key, false);
+                    break;
+                default:
+                    break;
+            }
+        }
+        s_pending.clear();
+    }
+
+    uint64_t Determinism::EndTick(const Registry& reg)
+    {
+        if (!s_enabled) return 0;
+        ZED_PROFILE_SCOPE("Determinism::EndTick");
+
+        s_lastHash = s_hash.Update(reg);
+        ++s_hashedTicks;
+
+        // A full rehash now and then catches transform writes that skipped MarkDirty()
+        if (s_verifyInterval > 0 && s_hashedTicks % s_verifyInterval == 0)
+        {
+            const uint64_t full = s_hash.Compute(reg);
+            if (full != s_lastHash)
+            {
+                std::cerr << "[ZED::Determinism] Tick " << s_tick << ": incremental hash missed a change; something wrote "
+                          << "TransformComponent without TransformSystem::MarkDirty()\n";
+                s_lastHash = full;
+            }
+        }
+
+        if (s_hashLog.is_open())
+        {
+            const auto flags = s_hashLog.flags();
+            s_hashLog << std::dec << s_tick << ' ' << std::hex << std::setw(16) << std::setfill('0') << s_lastHash << '\n';
+            s_hashLog.flags(flags);
+        }
+        return s_lastHash;
+    }
+
+    uint64_t Determinism::GetTick()
+    {
+        return s_tick;
+    }
+
+    std::span<const InputRecord> Determinism::GetTickInput()
+    {
+        return std::span<const InputRecord>(s_stream).subspan(s_tickBegin);
+    }
+
+    const std::vector<InputRecord>& Determinism::GetInputStream()
+    {
+        return s_stream;
+    }
+
+    bool Determinism::IsKeyDown(Key key)
+    {
+        const size_t index = static_cast<size_t>(key);
+        return index < s_keys.size() && s_keys[index] != 0;
+    }
+
+    Event Determinism::ToEvent(const InputEvent& e)
+    {
+        // Same fields the input modules fill when they post to the event system
+        Event ev{};
+        ev.a = static_cast<int>(e.key);
+        switch (e.type)
+        {
+            case InputEventType::KeyDown:           ev.type = EventType::KeyDown; break;
+            case InputEventType::KeyUp:             ev.type = EventType::KeyUp; break;
+            case InputEventType::TextInput:         ev.type = EventType::TextInput; break;
+            case InputEventType::MouseButtonDown:   ev.type = EventType::MouseButtonDown; break;
+            case InputEventType::MouseButtonUp:     ev.type = EventType::MouseButtonUp; break;
+            case InputEventType::GamepadButtonDown: ev.type = EventType::GamepadButtonDown; break;
+            case InputEventType::GamepadButtonUp:   ev.type = EventType::GamepadButtonUp; break;
+            case InputEventType::DeviceConnected:   ev.type = EventType::DeviceConnected; break;
+            case InputEventType::DeviceDisconnected: ev.type = EventType::DeviceDisconnected; break;
+            case InputEventType::GamepadAxisMotion:
+            case InputEventType::AxisMotion:
+                ev.type = EventType::GamepadAxisMotion;
+                ev.b = e.mouseX;
+                break;
+            case InputEventType::MouseMove:
+            case InputEventType::MouseWheel:
+                ev.type = e.type == InputEventType::MouseMove ? EventType::MouseMove : EventType::MouseWheel;
+                ev.a = 0;
+                ev.c = e.mouseX;
+                ev.d = e.mouseY;
+                break;
+        }
+        return ev;
+    }
+
+    void Determinism::Seed(uint64_t seed)
+    {
+        s_seed = seed;
+        for (uint64_t& word : s_rng)
+            word = SplitMix64(seed);
+    }
+
+    uint64_t Determinism::NextRandom()
+    {
+        // xoshiro256** (Blackman & Vigna)
+        const uint64_t result = std::rotl(s_rng[1] * 5, 7) * 9;
+        const uint64_t t = s_rng[1] << 17;
+        s_rng[2] ^= s_rng[0];
+        s_rng[3] ^= s_rng[1];
+        s_rng[1] ^= s_rng[2];
+        s_rng[0] ^= s_rng[3];
+        s_rng[2] ^= t;
+        s_rng[3] = std::rotl(s_rng[3], 45);
+        return result;
+    }
+
+    double Determinism::RandomUnit()
+    {
+        return static_cast<double>(NextRandom() >> 11) * 0x1.0p-53;
+    }
+
+    uint64_t Determinism::GetLastHash()
+    {
+        return s_lastHash;
+    }
+}
@@ -6,9 +6,9 @@
 
 namespace ZED
 {
-    ZEDENGINE_API entt::registry& ECS::Registry()
+    ZEDENGINE_API Registry& ECS::Registry()
     {
-        static entt::registry r;
+        static ZED::Registry r;
         return r;
     }
 }
\ No newline at end of file
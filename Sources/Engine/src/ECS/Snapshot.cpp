@@ -0,0 +1,581 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/ECS/Snapshot.h"
+#include "Engine/ECS/Components/TransformComponent.h"
+#include "Engine/ECS/Components/HierarchyComponent.h"
+#include "Engine/ECS/Components/BoundsComponent.h"
+#include "Engine/ECS/Components/CameraComponent.h"
+#include "Engine/ECS/Components/ColliderComponent.h"
+#include "Engine/ECS/Components/RigidBodyComponent.h"
+#include "Engine/ECS/Components/PreviousTransformComponent.h"
+#include "Engine/ECS/Components/ScriptComponent.h"
+#include "Engine/ECS/Systems/TransformSystem.h"
+#include "Engine/ECS/Systems/HierarchySystem.h"
+#include "Engine/Interfaces/Physics/IPhysics.h"
+#include "Engine/Physics/Physics.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace ZED
+{
+    namespace
+    {
+        using Buffer = std::vector<std::byte, TaggedAllocator<std::byte, MemoryTag::ECS>>;
+
+        // Delta granularity. Small enough that a few moving entities don't drag whole pools
+        // along, large enough that the chunk list stays short.
+        constexpr size_t kChunk = 256;
+        constexpr size_t kPoolCount = 8;
+        constexpr size_t kNoSlot = std::numeric_limits<size_t>::max();
+
+        struct PoolRecord
+        {
+            size_t count = 0;
+            bool delta = false;
+
+            // Byte offsets into the slot's buffer. Deltas share their keyframe's entity list,
+            // and data holds only the chunks listed in chunks, back to back.
+            size_t entities = 0;
+            size_t data = 0;
+            std::vector<uint32_t> chunks;
+        };
+
+        struct Slot
+        {
+            bool valid = false;
+            uint64_t tick = 0;
+            uint64_t sequence = 0;   // capture order, to find the oldest slot
+            uint64_t generation = 0; // bumped whenever the slot is rewritten or dropped
+
+            // Deltas: the keyframe's slot and its generation when the delta was taken
+            bool delta = false;
+            size_t base = kNoSlot;
+            uint64_t baseGeneration = 0;
+
+            Buffer buffer;
+            size_t used = 0;
+
+            // The entity storage as a whole: live ids first, then recycled ones with their versions
+            size_t entityCount = 0;
+            size_t entityAlive = 0;
+            size_t entities = 0;
+            bool entitiesFromBase = false;
+
+            std::array<PoolRecord, kPoolCount> pools;
+
+            // One PhysicsBodyState per RigidBodyComponent, in pool order
+            size_t bodyCount = 0;
+            size_t bodies = 0;
+        };
+
+        // Reused between restores so rolling back doesn't allocate once warmed up
+        struct Scratch
+        {
+            std::vector<entt::entity> lookup;
+            std::vector<entt::entity> pending;
+            std::vector<PhysicsBodyHandle> handles;
+            std::vector<PhysicsBodyState> states;
+        };
+
+        void Grow(Slot& slot, size_t size)
+        {
+            if (slot.buffer.size() < size)
+                slot.buffer.resize(std::max(size, slot.buffer.size() + slot.buffer.size() / 2));
+        }
+
+        size_t Append(Slot& slot, const void* src, size_t bytes, size_t align = 16)
+        {
+            const size_t offset = (slot.used + align - 1) & ~(align - 1);
+            Grow(slot, offset + bytes);
+            if (bytes > 0) std::memcpy(slot.buffer.data() + offset, src, bytes);
+            slot.used = offset + bytes;
+            return offset;
+        }
+
+        template <typename T>
+        const T* At(const Slot& slot, size_t offset)
+        {
+            return reinterpret_cast<const T*>(slot.buffer.data() + offset);
+        }
+
+        // Restored transforms, links and bounds all need new world matrices and spatial proxies
+        void MarkDirty(Registry& reg, const entt::entity* entities, size_t count)
+        {
+            auto& dirty = reg.storage<TransformDirty>();
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!dirty.contains(entities[i]))
+                    dirty.emplace(entities[i]);
+            }
+        }
+
+        // Copies one component pool. Keep names a field that belongs to the live world rather than
+        // to the simulation state (a physics handle, a per-frame scratch flag): restores leave it
+        // alone, and recreated components get its default.
+        template <typename T, auto Keep = nullptr, void (*OnChanged)(Registry&, const entt::entity*, size_t) = nullptr>
+        struct Pool
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Snapshot pools are copied with memcpy");
+
+            static constexpr size_t kPage = entt::component_traits<T>::page_size;
+            static_assert(kPage % kChunk == 0, "Chunks must not straddle storage pages");
+
+            static size_t Bytes(const Registry& reg)
+            {
+                const auto* storage = reg.storage<T>();
+                const size_t n = storage ? storage->size() : 0;
+                return n * (sizeof(entt::entity) + sizeof(T)) + 32;
+            }
+
+            static void Capture(const Registry& reg, Slot& slot, PoolRecord& rec, const Slot* base, const PoolRecord* baseRec)
+            {
+                const auto* storage = reg.storage<T>();
+                const size_t n = storage ? storage->size() : 0;
+
+                rec.count = n;
+                rec.delta = false;
+                rec.chunks.clear();
+                if (n == 0) return;
+
+                const entt::entity* entities = storage->data();
+                const bool sameEntities = base && !baseRec->delta && baseRec->count == n &&
+                    std::memcmp(At<entt::entity>(*base, baseRec->entities), entities, n * sizeof(entt::entity)) == 0;
+
+                rec.data = Append(slot, nullptr, 0, alignof(T));
+
+                if (sameEntities)
+                {
+                    rec.delta = true;
+                    const T* previous = At<T>(*base, baseRec->data);
+                    for (size_t first = 0; first < n; first += kChunk)
+                    {
+                        const T* live = storage->raw()[first / kPage] + first % kPage;
+                        const size_t bytes = std::min(kChunk, n - first) * sizeof(T);
+                        if (std::memcmp(live, previous + first, bytes) == 0) continue;
+
+                        Append(slot, live, bytes, 1);
+                        rec.chunks.push_back(static_cast<uint32_t>(first / kChunk));
+                    }
+                    return;
+                }
+
+                for (size_t first = 0; first < n; first += kPage)
+                    Append(slot, storage->raw()[first / kPage], std::min(kPage, n - first) * sizeof(T), 1);
+
+                // Written after the components so their offset is the aligned one computed above
+                rec.entities = Append(slot, entities, n * sizeof(entt::entity));
+            }
+
+            // True when anything in the live pool changed
+            static bool Restore(Registry& reg, const Slot& slot, const PoolRecord& rec, const Slot* base,
+                                const PoolRecord* baseRec, Scratch& scratch)
+            {
+                auto& storage = reg.storage<T>();
+                const size_t n = rec.count;
+
+                const Slot& keySlot = rec.delta ? *base : slot;
+                const PoolRecord& keyRec = rec.delta ? *baseRec : rec;
+                const entt::entity* entities = n > 0 ? At<entt::entity>(keySlot, keyRec.entities) : nullptr;
+
+                // Chunk c as of the snapshot: from the delta if it changed, otherwise from the keyframe
+                const auto source = [&](size_t c) -> const T*
+                {
+                    if (rec.delta)
+                    {
+                        const auto it = std::lower_bound(rec.chunks.begin(), rec.chunks.end(), static_cast<uint32_t>(c));
+                        if (it != rec.chunks.end() && *it == c)
+                            return At<T>(slot, rec.data) + static_cast<size_t>(it - rec.chunks.begin()) * kChunk;
+                    }
+                    return At<T>(keySlot, keyRec.data) + c * kChunk;
+                };
+
+                bool changed = false;
+
+                if (storage.size() != n || (n > 0 && std::memcmp(storage.data(), entities, n * sizeof(entt::entity)) != 0))
+                {
+                    changed = true;
+
+                    // Every id is below the entity storage's size once the entity list is restored
+                    scratch.lookup.assign(reg.storage<entt::entity>().size(), entt::null);
+                    for (size_t i = 0; i < n; ++i)
+                        scratch.lookup[entt::to_entity(entities[i])] = entities[i];
+
+                    scratch.pending.clear();
+                    for (size_t i = 0; i < storage.size(); ++i)
+                    {
+                        const entt::entity e = storage.data()[i];
+                        if (scratch.lookup[entt::to_entity(e)] != e)
+                            scratch.pending.push_back(e);
+                    }
+                    storage.remove(scratch.pending.begin(), scratch.pending.end());
+
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        if (storage.contains(entities[i])) continue;
+
+                        T value;
+                        std::memcpy(&value, source(i / kChunk) + i % kChunk, sizeof(T));
+                        if constexpr (!std::is_null_pointer_v<decltype(Keep)>)
+                            value.*Keep = T{}.*Keep;
+                        storage.emplace(entities[i], value);
+                    }
+
+                    // Same packed order as the snapshot, so the chunks below line up and the next
+                    // restore of a snapshot taken after this one takes the fast path
+                    storage.sort_as(std::make_reverse_iterator(entities + n), std::make_reverse_iterator(entities));
+                }
+
+                constexpr bool kHasKeep = !std::is_null_pointer_v<decltype(Keep)>;
+                scratch.pending.clear();
+
+                for (size_t first = 0; first < n; first += kChunk)
+                {
+                    T* live = storage.raw()[first / kPage] + first % kPage;
+                    const T* src = source(first / kChunk);
+                    const size_t count = std::min(kChunk, n - first);
+                    if (std::memcmp(live, src, count * sizeof(T)) == 0) continue;
+
+                    if constexpr (!kHasKeep && OnChanged == nullptr)
+                    {
+                        std::memcpy(live, src, count * sizeof(T));
+                        changed = true;
+                        continue;
+                    }
+
+                    // Element by element, so only what really changed is reported (and the kept
+                    // field, which differs all the time, doesn't count)
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        T value;
+                        std::memcpy(&value, &src[i], sizeof(T));
+                        if constexpr (kHasKeep)
+                            value.*Keep = live[i].*Keep;
+                        if (std::memcmp(&value, &live[i], sizeof(T)) == 0) continue;
+
+                        std::memcpy(&live[i], &value, sizeof(T));
+                        changed = true;
+                        scratch.pending.push_back(storage.data()[first + i]);
+                    }
+                }
+
+                if constexpr (OnChanged != nullptr)
+                {
+                    if (!scratch.pending.empty())
+                        OnChanged(reg, scratch.pending.data(), scratch.pending.size());
+                }
+                return changed;
+            }
+        };
+
+        struct PoolOps
+        {
+            size_t (*bytes)(const Registry&);
+            void (*capture)(const Registry&, Slot&, PoolRecord&, const Slot*, const PoolRecord*);
+            bool (*restore)(Registry&, const Slot&, const PoolRecord&, const Slot*, const PoolRecord*, Scratch&);
+            void (*afterRestore)(Registry&);
+        };
+
+        template <typename P>
+        constexpr PoolOps MakeOps(void (*afterRestore)(Registry&) = nullptr)
+        {
+            return PoolOps{ &P::Bytes, &P::Capture, &P::Restore, afterRestore };
+        }
+
+        constexpr size_t kRigidBodyPool = 5;
+
+        // Restore order matters for the construction signals of recreated components: transforms
+        // first, scripts last so OnStart sees a complete entity
+        constexpr std::array<PoolOps, kPoolCount> kPools{
+            MakeOps<Pool<TransformComponent, nullptr, &MarkDirty>>(),
+            MakeOps<Pool<HierarchyComponent, &HierarchyComponent::worldChanged, &MarkDirty>>(&HierarchySystem::SortByDepth),
+            MakeOps<Pool<BoundsComponent, nullptr, &MarkDirty>>(),
+            MakeOps<Pool<CameraComponent>>(),
+            MakeOps<Pool<ColliderComponent>>(),
+            MakeOps<Pool<RigidBodyComponent, &RigidBodyComponent::handle>>(),
+            MakeOps<Pool<PreviousTransformComponent>>(),
+            MakeOps<Pool<ScriptComponent>>(),
+        };
+    }
+
+    struct SnapshotRing::State
+    {
+        std::vector<Slot> slots;
+        size_t keyframeInterval = 1;
+
+        // Keyframe the next deltas are taken against
+        size_t keyframe = kNoSlot;
+        uint64_t keyframeGeneration = 0;
+        size_t sinceKeyframe = 0;
+
+        uint64_t sequence = 0;
+        Scratch scratch;
+
+        bool Restorable(const Slot& slot) const
+        {
+            if (!slot.valid) return false;
+            if (!slot.delta) return true;
+
+            const Slot& base = slots[slot.base];
+            return base.valid && !base.delta && base.generation == slot.baseGeneration;
+        }
+
+        Slot* Find(uint64_t tick)
+        {
+            for (Slot& slot : slots)
+            {
+                if (slot.valid && slot.tick == tick) return &slot;
+            }
+            return nullptr;
+        }
+
+        const Slot* Find(uint64_t tick) const
+        {
+            return const_cast<State*>(this)->Find(tick);
+        }
+
+        void Drop(Slot& slot)
+        {
+            slot.valid = false;
+            ++slot.generation;
+        }
+    };
+
+    SnapshotRing::SnapshotRing(size_t capacity, size_t keyframeInterval)
+        : m_state(std::make_unique<State>())
+    {
+        m_state->slots.resize(std::max<size_t>(capacity, 1));
+        m_state->keyframeInterval = std::max<size_t>(keyframeInterval, 1);
+    }
+
+    SnapshotRing::~SnapshotRing() = default;
+
+    void SnapshotRing::Reserve(const Registry& reg)
+    {
+        const auto* entities = reg.storage<entt::entity>();
+        size_t bytes = (entities ? entities->size() * sizeof(entt::entity) : 0) + 16;
+
+        for (const PoolOps& pool : kPools)
+            bytes += pool.bytes(reg);
+
+        const auto* bodies = reg.storage<RigidBodyComponent>();
+        bytes += (bodies ? bodies->size() * sizeof(PhysicsBodyState) : 0) + 16;
+
+        for (Slot& slot : m_state->slots)
+            Grow(slot, bytes);
+    }
+
+    void SnapshotRing::Capture(const Registry& reg, uint64_t tick)
+    {
+        ZED_PROFILE_SCOPE("SnapshotRing::Capture");
+        State& s = *m_state;
+
+        if (Slot* existing = s.Find(tick))
+            s.Drop(*existing);
+
+        // An empty slot if there is one, otherwise the oldest
+        size_t index = 0;
+        for (size_t i = 0; i < s.slots.size(); ++i)
+        {
+            if (!s.slots[i].valid) { index = i; break; }
+            if (s.slots[i].sequence < s.slots[index].sequence) index = i;
+        }
+
+        Slot& slot = s.slots[index];
+        s.Drop(slot);
+        slot.tick = tick;
+        slot.sequence = ++s.sequence;
+        slot.used = 0;
+
+        const bool keyframeUsable = s.keyframe != kNoSlot && s.keyframe != index &&
+                                    s.slots[s.keyframe].valid && s.slots[s.keyframe].generation == s.keyframeGeneration;
+        slot.delta = keyframeUsable && s.sinceKeyframe + 1 < s.keyframeInterval;
+        slot.base = slot.delta ? s.keyframe : kNoSlot;
+        slot.baseGeneration = slot.delta ? s.keyframeGeneration : 0;
+        const Slot* base = slot.delta ? &s.slots[slot.base] : nullptr;
+
+        // Entities
+        const auto* entities = reg.storage<entt::entity>();
+        slot.entityCount = entities ? entities->size() : 0;
+        slot.entityAlive = entities ? entities->free_list() : 0;
+        slot.entitiesFromBase = base && base->entityCount == slot.entityCount && base->entityAlive == slot.entityAlive &&
+            std::memcmp(At<entt::entity>(*base, base->entities), entities->data(), slot.entityCount * sizeof(entt::entity)) == 0;
+        if (!slot.entitiesFromBase)
+            slot.entities = Append(slot, entities ? entities->data() : nullptr, slot.entityCount * sizeof(entt::entity));
+
+        for (size_t p = 0; p < kPools.size(); ++p)
+            kPools[p].capture(reg, slot, slot.pools[p], base, base ? &base->pools[p] : nullptr);
+
+        // Physics bodies. Bodies the backend hasn't created yet start from their components.
+        const auto* bodies = reg.storage<RigidBodyComponent>();
+        slot.bodyCount = bodies ? bodies->size() : 0;
+        if (slot.bodyCount > 0)
+        {
+            Scratch& scratch = s.scratch;
+            scratch.handles.resize(slot.bodyCount);
+            scratch.states.resize(slot.bodyCount);
+
+            const auto* transforms = reg.storage<TransformComponent>();
+            for (size_t i = 0; i < slot.bodyCount; ++i)
+            {
+                const entt::entity e = bodies->data()[i];
+                const RigidBodyComponent& rb = bodies->get(e);
+
+                PhysicsBodyState& state = scratch.states[i];
+                state = PhysicsBodyState{};
+                if (transforms && transforms->contains(e))
+                {
+                    state.position = transforms->get(e).position;
+                    state.rotation = QuatFromEuler(transforms->get(e).rotation);
+                }
+                state.linearVelocity = rb.linearVelocity;
+                state.angularVelocity = rb.angularVelocity;
+                scratch.handles[i] = rb.handle;
+            }
+
+            if (IPhysics* physics = Physics::Get())
+                physics->GetBodyStates(scratch.handles, scratch.states);
+
+            slot.bodies = Append(slot, scratch.states.data(), slot.bodyCount * sizeof(PhysicsBodyState));
+        }
+
+        slot.valid = true;
+
+        if (slot.delta)
+        {
+            ++s.sinceKeyframe;
+        }
+        else
+        {
+            s.keyframe = index;
+            s.keyframeGeneration = slot.generation;
+            s.sinceKeyframe = 0;
+        }
+    }
+
+    bool SnapshotRing::Restore(Registry& reg, uint64_t tick)
+    {
+        ZED_PROFILE_SCOPE("SnapshotRing::Restore");
+        State& s = *m_state;
+
+        const Slot* found = s.Find(tick);
+        if (!found || !s.Restorable(*found)) return false;
+
+        const Slot& slot = *found;
+        const Slot* base = slot.delta ? &s.slots[slot.base] : nullptr;
+        Scratch& scratch = s.scratch;
+
+        // Entities: make the live set match first, then rebuild the storage itself so ids,
+        // versions and the recycling order are exactly what they were
+        const Slot& entitySlot = slot.entitiesFromBase ? *base : slot;
+        const entt::entity* entities = At<entt::entity>(entitySlot, entitySlot.entities);
+        auto& entityStorage = reg.storage<entt::entity>();
+
+        const bool sameEntities = entityStorage.size() == slot.entityCount && entityStorage.free_list() == slot.entityAlive &&
+            std::memcmp(entityStorage.data(), entities, slot.entityCount * sizeof(entt::entity)) == 0;
+        if (!sameEntities)
+        {
+            scratch.lookup.assign(std::max(entityStorage.size(), slot.entityCount), entt::null);
+            for (size_t i = 0; i < slot.entityAlive; ++i)
+                scratch.lookup[entt::to_entity(entities[i])] = entities[i];
+
+            scratch.pending.clear();
+            for (size_t i = 0; i < entityStorage.free_list(); ++i)
+            {
+                const entt::entity e = entityStorage.data()[i];
+                if (scratch.lookup[entt::to_entity(e)] != e)
+                    scratch.pending.push_back(e);
+            }
+            reg.destroy(scratch.pending.begin(), scratch.pending.end());
+
+            // What's left alive is exactly the snapshot's live set, so no component is orphaned
+            entityStorage.clear();
+            entityStorage.reserve(slot.entityCount);
+            entt::entity highest = entt::null;
+            for (size_t i = 0; i < slot.entityCount; ++i)
+            {
+                entityStorage.generate(entities[i]);
+                if (highest == entt::null || entt::to_entity(entities[i]) > entt::to_entity(highest))
+                    highest = entities[i];
+            }
+            entityStorage.free_list(slot.entityAlive);
+            if (highest != entt::null) entityStorage.start_from(highest);
+        }
+
+        for (size_t p = 0; p < kPools.size(); ++p)
+        {
+            const bool changed = kPools[p].restore(reg, slot, slot.pools[p], base, base ? &base->pools[p] : nullptr, scratch);
+            if (changed && kPools[p].afterRestore) kPools[p].afterRestore(reg);
+        }
+
+        // Physics bodies, now in the same order as the snapshot
+        IPhysics* physics = slot.bodyCount > 0 ? Physics::Get() : nullptr;
+        if (physics)
+        {
+            auto& bodies = reg.storage<RigidBodyComponent>();
+            scratch.handles.resize(slot.bodyCount);
+            scratch.states.resize(slot.bodyCount);
+            std::memcpy(scratch.states.data(), At<PhysicsBodyState>(slot, slot.bodies), slot.bodyCount * sizeof(PhysicsBodyState));
+            for (size_t i = 0; i < slot.bodyCount; ++i)
+                scratch.handles[i] = bodies.get(bodies.data()[i]).handle;
+
+            physics->SetBodyStates(scratch.handles, scratch.states);
+        }
+
+        return true;
+    }
+
+    bool SnapshotRing::Contains(uint64_t tick) const
+    {
+        const Slot* slot = m_state->Find(tick);
+        return slot && m_state->Restorable(*slot);
+    }
+
+    bool SnapshotRing::GetInfo(uint64_t tick, SnapshotInfo& out) const
+    {
+        const Slot* slot = m_state->Find(tick);
+        if (!slot || !m_state->Restorable(*slot)) return false;
+
+        out.tick = slot->tick;
+        out.bytes = slot->used;
+        out.delta = slot->delta;
+        return true;
+    }
+
+    void SnapshotRing::DiscardAfter(uint64_t tick)
+    {
+        for (Slot& slot : m_state->slots)
+        {
+            if (slot.valid && slot.tick > tick)
+                m_state->Drop(slot);
+        }
+    }
+
+    void SnapshotRing::Clear()
+    {
+        for (Slot& slot : m_state->slots)
+            m_state->Drop(slot);
+        m_state->keyframe = kNoSlot;
+    }
+
+    size_t SnapshotRing::GetCapacity() const
+    {
+        return m_state->slots.size();
+    }
+
+    size_t SnapshotRing::GetMemoryUsage() const
+    {
+        size_t bytes = 0;
+        for (const Slot& slot : m_state->slots)
+            bytes += slot.buffer.size();
+        return bytes;
+    }
+}
@@ -0,0 +1,236 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/ECS/StateHash.h"
+#include "Engine/ECS/Components/TransformComponent.h"
+#include "Engine/ECS/Components/HierarchyComponent.h"
+#include "Engine/ECS/Components/CameraComponent.h"
+#include "Engine/ECS/Components/ColliderComponent.h"
+#include "Engine/ECS/Components/RigidBodyComponent.h"
+#include "Engine/ECS/Components/ScriptComponent.h"
+#include "Engine/ECS/Components/WorldMatrixComponent.h"
+#include "Engine/Hash/Hash.h"
+#include "Engine/Interfaces/Physics/IPhysics.h"
+#include "Engine/Physics/Physics.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace ZED
+{
+    namespace
+    {
+        // Same granularity as snapshot deltas: a few moving entities rehash a few KB
+        constexpr size_t kChunk = 256;
+
+        static_assert(sizeof(TransformComponent) == 9 * sizeof(float), "Transforms are hashed in place and must have no padding");
+        static_assert(sizeof(PhysicsBodyState) == 13 * sizeof(float), "Body states are hashed in place and must have no padding");
+
+        // Writes fields back to back, leaving out the padding between them
+        template <typename... F>
+        void Put(std::byte*& out, const F&... fields)
+        {
+            ((std::memcpy(out, &fields, sizeof(F)), out += sizeof(F)), ...);
+        }
+
+        void PackHierarchy(const HierarchyComponent& h, std::byte*& out)
+        {
+            // worldChanged is scratch for the current propagation pass
+            Put(out, h.parent, h.firstChild, h.prevSibling, h.nextSibling, h.childCount, h.depth);
+        }
+
+        void PackCamera(const CameraComponent& c, std::byte*& out)
+        {
+            Put(out, c.fovRadians, c.znear, c.zfar, c.projection, c.aspect, c.primary, c.editorMode);
+        }
+
+        void PackCollider(const ColliderComponent& c, std::byte*& out)
+        {
+            Put(out, c.shape, c.halfExtents, c.radius, c.halfHeight);
+        }
+
+        void PackRigidBody(const RigidBodyComponent& rb, std::byte*& out)
+        {
+            // The handle is whatever id the backend handed out, not part of the simulation
+            Put(out, rb.motion, rb.mass, rb.friction, rb.restitution, rb.linearDamping, rb.angularDamping, rb.allowSleep,
+                rb.linearVelocity, rb.angularVelocity);
+        }
+
+        void PackScript(const ScriptComponent& s, std::byte*& out)
+        {
+            Put(out, s.script, s.enabled);
+        }
+
+        // Per pool: the hash of each chunk's entity ids, then of its components, interleaved
+        struct PoolCache
+        {
+            std::vector<uint64_t> hashes;
+            std::vector<uint8_t> dirty;
+        };
+
+        struct Scratch
+        {
+            std::vector<std::byte> packed;
+            std::vector<PhysicsBodyHandle> handles;
+            std::vector<PhysicsBodyState> states;
+        };
+
+        // Pack == nullptr hashes the components where they lie, for types without padding.
+        // Tracked pools rehash a chunk's components only when its ids changed or it holds a
+        // TransformDirty entity; the others are rehashed whole every time.
+        template <typename T, void (*Pack)(const T&, std::byte*&) = nullptr, bool Tracked = false>
+        struct Pool
+        {
+            static constexpr size_t kPage = entt::component_traits<T>::page_size;
+            static_assert(kPage % kChunk == 0, "Chunks must not straddle storage pages");
+
+            static uint64_t Hash(const Registry& reg, PoolCache& cache, Scratch& scratch, bool full)
+            {
+                const auto* storage = reg.storage<T>();
+                const size_t count = storage ? storage->size() : 0;
+                const size_t chunks = (count + kChunk - 1) / kChunk;
+                cache.hashes.resize(chunks * 2);
+
+                if constexpr (Tracked)
+                {
+                    cache.dirty.assign(chunks, 0);
+                    const auto* tags = reg.storage<TransformDirty>();
+                    if (!full && tags && storage)
+                    {
+                        const entt::entity* tagged = tags->data();
+                        for (size_t i = 0, n = tags->size(); i < n; ++i)
+                        {
+                            if (storage->contains(tagged[i]))
+                                cache.dirty[storage->index(tagged[i]) / kChunk] = 1;
+                        }
+                    }
+                }
+
+                if constexpr (Pack != nullptr)
+                    scratch.packed.resize(kChunk * sizeof(T));
+
+                for (size_t c = 0; c < chunks; ++c)
+                {
+                    const size_t first = c * kChunk;
+                    const size_t n = std::min(kChunk, count - first);
+
+                    const uint64_t ids = Hash64(storage->data() + first, n * sizeof(entt::entity));
+                    bool changed = full || !Tracked || ids != cache.hashes[2 * c];
+                    if constexpr (Tracked)
+                        changed = changed || cache.dirty[c];
+                    if (!changed) continue;
+
+                    const T* components = storage->raw()[first / kPage] + first % kPage;
+                    cache.hashes[2 * c] = ids;
+                    if constexpr (Pack != nullptr)
+                    {
+                        std::byte* out = scratch.packed.data();
+                        for (size_t i = 0; i < n; ++i)
+                            Pack(components[i], out);
+                        cache.hashes[2 * c + 1] = Hash64(scratch.packed.data(), static_cast<size_t>(out - scratch.packed.data()));
+                    }
+                    else
+                    {
+                        cache.hashes[2 * c + 1] = Hash64(components, n * sizeof(T));
+                    }
+                }
+
+                return Hash64(cache.hashes.data(), cache.hashes.size() * sizeof(uint64_t));
+            }
+        };
+
+        using PoolHashFn = uint64_t (*)(const Registry&, PoolCache&, Scratch&, bool);
+
+        constexpr std::array<PoolHashFn, 6> kPools{
+            &Pool<TransformComponent, nullptr, true>::Hash,
+            &Pool<HierarchyComponent, &PackHierarchy>::Hash,
+            &Pool<CameraComponent, &PackCamera>::Hash,
+            &Pool<ColliderComponent, &PackCollider>::Hash,
+            &Pool<RigidBodyComponent, &PackRigidBody>::Hash,
+            &Pool<ScriptComponent, &PackScript>::Hash,
+        };
+
+        // Ids in packed order, recycled ones with their versions, and how many are alive: all of
+        // it decides which id the next create() hands out
+        uint64_t HashEntities(const Registry& reg)
+        {
+            const auto* entities = reg.storage<entt::entity>();
+            if (!entities) return 0;
+
+            const uint64_t ids = Hash64(entities->data(), entities->size() * sizeof(entt::entity));
+            const uint64_t parts[2] = { ids, static_cast<uint64_t>(entities->free_list()) };
+            return Hash64(parts, sizeof(parts));
+        }
+
+        // Positions, rotations and velocities as the physics backend holds them, in body pool order
+        uint64_t HashBodies(const Registry& reg, Scratch& scratch)
+        {
+            const auto* bodies = reg.storage<RigidBodyComponent>();
+            IPhysics* physics = bodies && !bodies->empty() ? Physics::Get() : nullptr;
+            if (!physics) return 0;
+
+            const size_t count = bodies->size();
+            scratch.handles.resize(count);
+            scratch.states.assign(count, PhysicsBodyState{});
+            for (size_t i = 0; i < count; ++i)
+                scratch.handles[i] = bodies->get(bodies->data()[i]).handle;
+
+            physics->GetBodyStates(scratch.handles, scratch.states);
+            return Hash64(scratch.states.data(), count * sizeof(PhysicsBodyState));
+        }
+    }
+
+    struct StateHash::State
+    {
+        std::array<PoolCache, kPools.size()> pools;
+        Scratch scratch;
+        uint64_t value = 0;
+
+        uint64_t Run(const Registry& reg, bool full)
+        {
+            std::array<uint64_t, kPools.size() + 2> parts{};
+            parts[0] = HashEntities(reg);
+            for (size_t i = 0; i < kPools.size(); ++i)
+                parts[i + 1] = kPools[i](reg, pools[i], scratch, full);
+            parts.back() = HashBodies(reg, scratch);
+
+            value = Hash64(parts.data(), sizeof(parts));
+            return value;
+        }
+    };
+
+    StateHash::StateHash()
+        : m_state(std::make_unique<State>())
+    {
+    }
+
+    StateHash::~StateHash() = default;
+
+    uint64_t StateHash::Update(const Registry& reg)
+    {
+        ZED_PROFILE_SCOPE("StateHash::Update");
+        return m_state->Run(reg, false);
+    }
+
+    uint64_t StateHash::Compute(const Registry& reg)
+    {
+        ZED_PROFILE_SCOPE("StateHash::Compute");
+        return m_state->Run(reg, true);
+    }
+
+    uint64_t StateHash::Get() const
+    {
+        return m_state->value;
+    }
+
+    void StateHash::Reset()
+    {
+        for (PoolCache& pool : m_state->pools)
+            pool.hashes.clear();
+        m_state->value = 0;
+    }
+}
@@ -0,0 +1,321 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/ECS/SystemScheduler.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+namespace ZED
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        double ElapsedMs(Clock::time_point start)
+        {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        struct Node
+        {
+            std::unique_ptr<SystemDesc> desc;
+            std::vector<size_t> deps; // direct dependencies only, for the dump
+            uint32_t stage = 0;
+
+            uint64_t calls = 0;
+            double totalMs = 0.0;
+            double peakMs = 0.0;
+        };
+
+        // Raw job payload, so queuing a system doesn't allocate
+        struct Task
+        {
+            Node* node;
+            Registry* registry;
+            double dt;
+        };
+
+        struct Phase
+        {
+            std::vector<Node> nodes;
+            std::vector<std::vector<size_t>> stages;
+            std::vector<Task> tasks;
+            bool dirty = false;
+
+            uint64_t runs = 0;
+            double totalMs = 0.0;
+        };
+
+        constexpr size_t kPhaseCount = static_cast<size_t>(SystemPhase::Count);
+        constexpr std::array<const char*, kPhaseCount> kPhaseNames{ "Update", "FixedUpdate", "PostUpdate", "Render" };
+
+        std::array<Phase, kPhaseCount> s_phases;
+        bool s_parallel = true;
+        bool s_dumpSchedule = false;
+
+        bool Conflicts(const SystemDesc& a, const SystemDesc& b)
+        {
+            if (a.exclusive || b.exclusive) return true;
+
+            for (const auto& x : a.access)
+                for (const auto& y : b.access)
+                    if (x.id == y.id && (x.write || y.write))
+                        return true;
+            return false;
+        }
+
+        void Execute(Node& node, Registry& r, double dt)
+        {
+            ZED_PROFILE_SCOPE(node.desc->name.c_str());
+            const auto start = Clock::now();
+            node.desc->func(r, dt);
+            const double ms = ElapsedMs(start);
+
+            ++node.calls;
+            node.totalMs += ms;
+            node.peakMs = std::max(node.peakMs, ms);
+        }
+
+        void RunTask(void* data, size_t, size_t)
+        {
+            auto* task = static_cast<Task*>(data);
+            Execute(*task->node, *task->registry, task->dt);
+        }
+
+        // "ZED::TransformComponent" -> "TransformComponent"
+        std::string_view ShortName(std::string_view name)
+        {
+            const size_t colon = name.rfind("::");
+            return colon == std::string_view::npos ? name : name.substr(colon + 2);
+        }
+
+        void DumpPhase(std::ostream& out, size_t index)
+        {
+            const Phase& p = s_phases[index];
+            if (p.nodes.empty()) return;
+
+            out << "[ZED::SystemScheduler] " << kPhaseNames[index] << ": " << p.nodes.size() << " system(s) in "
+                << p.stages.size() << " stage(s)\n";
+
+            for (size_t s = 0; s < p.stages.size(); ++s)
+            {
+                out << "  stage " << s << "\n";
+                for (size_t i : p.stages[s])
+                {
+                    const Node& node = p.nodes[i];
+                    const SystemDesc& d = *node.desc;
+                    out << "    " << d.name;
+                    if (d.exclusive) out << " [exclusive]";
+                    if (d.mainThread) out << " [main thread]";
+
+                    for (const bool write : { false, true })
+                    {
+                        const char* sep = write ? " | writes " : " | reads ";
+                        for (const auto& a : d.access)
+                        {
+                            if (a.write != write) continue;
+                            out << sep << ShortName(a.name);
+                            sep = ", ";
+                        }
+                    }
+
+                    const char* sep = " | after ";
+                    for (size_t dep : node.deps)
+                    {
+                        out << sep << p.nodes[dep].desc->name;
+                        sep = ", ";
+                    }
+                    out << "\n";
+                }
+            }
+        }
+
+        void Build(size_t index)
+        {
+            Phase& p = s_phases[index];
+            const size_t n = p.nodes.size();
+
+            // reach[j][i]: system j transitively depends on system i
+            std::vector<std::vector<bool>> reach(n, std::vector<bool>(n, false));
+            std::vector<size_t> direct;
+            p.stages.clear();
+
+            for (size_t j = 0; j < n; ++j)
+            {
+                Node& node = p.nodes[j];
+                direct.clear();
+                node.stage = 0;
+
+                for (size_t i = 0; i < j; ++i)
+                {
+                    if (!Conflicts(*p.nodes[i].desc, *node.desc)) continue;
+
+                    direct.push_back(i);
+                    node.stage = std::max(node.stage, p.nodes[i].stage + 1);
+                    reach[j][i] = true;
+                    for (size_t k = 0; k < i; ++k)
+                        if (reach[i][k]) reach[j][k] = true;
+                }
+
+                // Drop edges another dependency already implies
+                node.deps.clear();
+                for (size_t i : direct)
+                {
+                    const bool implied = std::any_of(direct.begin(), direct.end(), [&](size_t k) { return k != i && reach[k][i]; });
+                    if (!implied) node.deps.push_back(i);
+                }
+
+                if (p.stages.size() <= node.stage) p.stages.resize(node.stage + 1);
+                p.stages[node.stage].push_back(j);
+            }
+
+            p.tasks.resize(n);
+            p.dirty = false;
+
+            if (s_dumpSchedule) DumpPhase(std::cout, index);
+        }
+    }
+
+    void SystemScheduler::InitFromConfig()
+    {
+        const auto& ini = Config::Get();
+        SetParallel(ini.GetBoolValue("Systems", "Parallel", true));
+        s_dumpSchedule = ini.GetBoolValue("Systems", "DumpSchedule", false);
+    }
+
+    SystemDesc& SystemScheduler::Add(SystemPhase phase, std::string name, SystemFunc func)
+    {
+        Phase& p = s_phases[static_cast<size_t>(phase)];
+
+        Node node;
+        node.desc = std::make_unique<SystemDesc>();
+        node.desc->name = std::move(name);
+        node.desc->func = std::move(func);
+        p.nodes.push_back(std::move(node));
+
+        // Access is declared on the returned reference after this call, so build on the next Run()
+        p.dirty = true;
+        return *p.nodes.back().desc;
+    }
+
+    void SystemScheduler::Run(SystemPhase phase, Registry& r, double dt)
+    {
+        const size_t index = static_cast<size_t>(phase);
+        Phase& p = s_phases[index];
+        if (p.dirty) Build(index);
+
+        ZED_PROFILE_SCOPE(kPhaseNames[index]);
+        const auto start = Clock::now();
+
+        if (!s_parallel || JobSystem::GetThreadCount() <= 1)
+        {
+            for (Node& node : p.nodes)
+                Execute(node, r, dt);
+        }
+        else
+        {
+            for (const auto& stage : p.stages)
+            {
+                if (stage.size() == 1)
+                {
+                    Execute(p.nodes[stage[0]], r, dt);
+                    continue;
+                }
+
+                // The registry creates a storage on first lookup. Do that now, so systems running
+                // side by side only ever read its storage map.
+                for (size_t i : stage)
+                    for (const auto& a : p.nodes[i].desc->access)
+                        if (a.assure) a.assure(r);
+
+                JobCounter counter;
+                for (size_t i : stage)
+                {
+                    if (p.nodes[i].desc->mainThread) continue;
+                    p.tasks[i] = Task{ &p.nodes[i], &r, dt };
+                    JobSystem::Run(&RunTask, &p.tasks[i], 0, 0, &counter);
+                }
+
+                for (size_t i : stage)
+                    if (p.nodes[i].desc->mainThread)
+                        Execute(p.nodes[i], r, dt);
+
+                JobSystem::Wait(counter);
+            }
+        }
+
+        ++p.runs;
+        p.totalMs += ElapsedMs(start);
+    }
+
+    void SystemScheduler::Clear()
+    {
+        for (Phase& p : s_phases)
+            p = Phase{};
+    }
+
+    void SystemScheduler::SetParallel(bool parallel)
+    {
+        s_parallel = parallel;
+    }
+
+    bool SystemScheduler::IsParallel()
+    {
+        return s_parallel;
+    }
+
+    void SystemScheduler::DumpSchedule(std::ostream& out)
+    {
+        for (size_t i = 0; i < kPhaseCount; ++i)
+        {
+            if (s_phases[i].dirty) Build(i);
+            DumpPhase(out, i);
+        }
+    }
+
+    void SystemScheduler::DumpTimings(std::ostream& out)
+    {
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(3);
+
+        for (size_t index = 0; index < kPhaseCount; ++index)
+        {
+            const Phase& p = s_phases[index];
+            if (p.nodes.empty() || p.runs == 0) continue;
+
+            double systemsMs = 0.0;
+            for (const Node& node : p.nodes)
+                systemsMs += node.totalMs;
+
+            // Systems time above wall time is work that overlapped
+            const double runs = static_cast<double>(p.runs);
+            out << "[ZED::SystemScheduler] " << kPhaseNames[index] << ": " << p.runs << " run(s), avg "
+                << p.totalMs / runs << " ms wall, " << systemsMs / runs << " ms in systems\n";
+
+            for (const Node& node : p.nodes)
+            {
+                out << "    " << std::left << std::setw(24) << node.desc->name << std::right
+                    << " stage " << node.stage << " | " << node.calls << " call(s)";
+                if (node.calls > 0)
+                {
+                    out << " | avg " << node.totalMs / static_cast<double>(node.calls) << " ms, peak "
+                        << node.peakMs << " ms";
+                }
+                out << "\n";
+            }
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
@@ -1,4 +1,5 @@
 #include "Engine/ECS/Systems/CameraController.h"
+#include "Engine/ECS/Systems/TransformSystem.h"
 #include <iostream>
 #include <cmath>
 
@@ -59,7 +60,7 @@ namespace ZED
 		s_mouseDeltaY += static_cast<float>(e.d);
 	}
 
-	void CameraController::Update(entt::registry& r, double dt)
+	void CameraController::Update(Registry& r, double dt)
 	{
 		if (!s_enabled) return;
 
@@ -112,6 +113,8 @@ namespace ZED
 			const float maxPitch = 89.0f * 3.14159265f / 180.0f;
 			if (tr->rotation.x > maxPitch) tr->rotation.x = maxPitch;
 			if (tr->rotation.x < -maxPitch) tr->rotation.x = -maxPitch;
+		
+			TransformSystem::MarkDirty(r, camEnt);
 		}
 
 		// Reset mouse delta for next frame (after using it)
@@ -169,6 +172,7 @@ namespace ZED
 		{
 			moveDir = glm::normalize(moveDir);
 			tr->position += moveDir * moveDelta;
+			TransformSystem::MarkDirty(r, camEnt);
 		}
 	}
 }
\ No newline at end of file
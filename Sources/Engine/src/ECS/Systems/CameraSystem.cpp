@@ -3,6 +3,7 @@
  */
 
 #include "Engine/ECS/Systems/CameraSystem.h"
+#include "Engine/ECS/Systems/HierarchySystem.h"
 #include "Engine/Events/EventSystem.h"
 #include "Engine/Events/Event.h"
 
@@ -31,7 +32,7 @@ namespace ZED
 			s_aspect = aspect;
 	}
 
-	void CameraSystem::Update(entt::registry& r)
+	void CameraSystem::Update(Registry& r)
 	{
 		// Find active camera (primary first, else any)
 		entt::entity active = entt::null;
@@ -80,8 +81,15 @@ namespace ZED
 			cam->aspect = s_aspect;
 
 		// Build View from transform (LH): inverse of T*Rz*Ry*Rx*S
-		Mat4 model = tr->ToMatrix();
-		s_view = glm::inverse(model);
+		// Reuse the cached world matrix when the transform system maintains one
+		const auto* wm = r.try_get<WorldMatrixComponent>(active);
+		const Mat4 model = wm ? wm->matrix : tr->ToMatrix();
+
+		// Cameras are normally unscaled, so the cheap transpose-based inverse applies.
+		// A parent may carry scale of its own, so parented cameras take the general path.
+		const bool unitScale = glm::all(glm::lessThan(glm::abs(tr->scale - Vec3(1.0f)), Vec3(1e-5f)));
+		const bool rigid = unitScale && HierarchySystem::GetParent(r, active) == entt::null;
+		s_view = rigid ? InverseRigid(model) : glm::inverse(model);
 
 		// Build Proj
 		if (cam->projection == CameraProjection::Perspective)
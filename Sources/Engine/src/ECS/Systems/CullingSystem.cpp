@@ -0,0 +1,255 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/ECS/Systems/CullingSystem.h"
+#include "Engine/ECS/Components/CameraComponent.h"
+#include "Engine/Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <immintrin.h>
+    #define ZED_CULL_SSE 1
+#endif
+
+namespace ZED
+{
+    std::vector<entt::entity> CullingSystem::s_visible;
+    size_t CullingSystem::s_tested = 0;
+
+    namespace
+    {
+        // Entities per job chunk; the SoA scratch for one chunk (20 KB) stays in L1/L2
+        constexpr size_t kChunkSize = 1024;
+
+        struct ChunkScratch
+        {
+            alignas(32) float x[kChunkSize];
+            alignas(32) float y[kChunkSize];
+            alignas(32) float z[kChunkSize];
+            alignas(32) float r[kChunkSize];
+            uint32_t visible[kChunkSize];
+        };
+
+        thread_local ChunkScratch t_Scratch;
+
+        // Per-chunk results: chunk c writes its visible entities at s_chunkOutput[c * kChunkSize]
+        // and their number to s_chunkCounts[c]. Only grows, so steady frames don't re-initialize it.
+        std::vector<entt::entity> s_chunkOutput;
+        std::vector<uint32_t> s_chunkCounts;
+
+        Vec4 NormalizePlane(const Vec4& p)
+        {
+            const float len = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+            return len > 0.0f ? p / len : p;
+        }
+    }
+
+    Frustum Frustum::FromViewProj(const Mat4& m)
+    {
+        // GLM is column-major: row i is (m[0][i], m[1][i], m[2][i], m[3][i])
+        const Vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const Vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const Vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        const Vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        Frustum f;
+        f.planes[0] = NormalizePlane(row3 + row0); // left
+        f.planes[1] = NormalizePlane(row3 - row0); // right
+        f.planes[2] = NormalizePlane(row3 + row1); // bottom
+        f.planes[3] = NormalizePlane(row3 - row1); // top
+        f.planes[4] = NormalizePlane(row2);        // near (depth 0..1)
+        f.planes[5] = NormalizePlane(row3 - row2); // far
+        return f;
+    }
+
+    bool Frustum::IntersectsSphere(const Vec3& c, float radius) const
+    {
+        for (const Vec4& p : planes)
+        {
+            if (p.x * c.x + p.y * c.y + p.z * c.z + p.w < -radius)
+                return false;
+        }
+        return true;
+    }
+
+    size_t CullingSystem::CullSpheres(const Frustum& frustum,
+                                      const float* x, const float* y, const float* z, const float* radius,
+                                      size_t count, uint32_t* outVisible)
+    {
+        size_t visible = 0;
+        size_t i = 0;
+
+        // Output is written branch-free: every lane stores its index, only visible lanes advance the cursor.
+        // The cursor never passes the lane being written, so outVisible needs no slack beyond count.
+
+    #if defined(__AVX__)
+        {
+            __m256 px[6], py[6], pz[6], pw[6];
+            for (int p = 0; p < 6; ++p)
+            {
+                px[p] = _mm256_set1_ps(frustum.planes[p].x);
+                py[p] = _mm256_set1_ps(frustum.planes[p].y);
+                pz[p] = _mm256_set1_ps(frustum.planes[p].z);
+                pw[p] = _mm256_set1_ps(frustum.planes[p].w);
+            }
+
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m256 cx = _mm256_loadu_ps(x + i);
+                const __m256 cy = _mm256_loadu_ps(y + i);
+                const __m256 cz = _mm256_loadu_ps(z + i);
+                const __m256 nr = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius + i));
+
+                __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+                for (int p = 0; p < 6; ++p)
+                {
+                    __m256 d = _mm256_add_ps(_mm256_mul_ps(px[p], cx), pw[p]);
+                    d = _mm256_add_ps(d, _mm256_mul_ps(py[p], cy));
+                    d = _mm256_add_ps(d, _mm256_mul_ps(pz[p], cz));
+                    inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, nr, _CMP_GE_OQ));
+                }
+
+                const int mask = _mm256_movemask_ps(inside);
+                for (int lane = 0; lane < 8; ++lane)
+                {
+                    outVisible[visible] = static_cast<uint32_t>(i + lane);
+                    visible += (mask >> lane) & 1;
+                }
+            }
+        }
+    #endif
+
+    #if defined(ZED_CULL_SSE)
+        {
+            __m128 px[6], py[6], pz[6], pw[6];
+            for (int p = 0; p < 6; ++p)
+            {
+                px[p] = _mm_set1_ps(frustum.planes[p].x);
+                py[p] = _mm_set1_ps(frustum.planes[p].y);
+                pz[p] = _mm_set1_ps(frustum.planes[p].z);
+                pw[p] = _mm_set1_ps(frustum.planes[p].w);
+            }
+
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128 cx = _mm_loadu_ps(x + i);
+                const __m128 cy = _mm_loadu_ps(y + i);
+                const __m128 cz = _mm_loadu_ps(z + i);
+                const __m128 nr = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + i));
+
+                __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                for (int p = 0; p < 6; ++p)
+                {
+                    __m128 d = _mm_add_ps(_mm_mul_ps(px[p], cx), pw[p]);
+                    d = _mm_add_ps(d, _mm_mul_ps(py[p], cy));
+                    d = _mm_add_ps(d, _mm_mul_ps(pz[p], cz));
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(d, nr));
+                }
+
+                const int mask = _mm_movemask_ps(inside);
+                for (int lane = 0; lane < 4; ++lane)
+                {
+                    outVisible[visible] = static_cast<uint32_t>(i + lane);
+                    visible += (mask >> lane) & 1;
+                }
+            }
+        }
+    #endif
+
+        // Tail (and the whole range on targets without SSE)
+        for (; i < count; ++i)
+        {
+            outVisible[visible] = static_cast<uint32_t>(i);
+            visible += frustum.IntersectsSphere(Vec3(x[i], y[i], z[i]), radius[i]) ? 1 : 0;
+        }
+
+        return visible;
+    }
+
+    void CullingSystem::Update(Registry& r, const Mat4& view, const Mat4& proj)
+    {
+        const auto& matrices = r.storage<WorldMatrixComponent>();
+        const auto& bounds = r.storage<BoundsComponent>();
+        const auto& cameras = r.storage<CameraComponent>();
+
+        const size_t count = matrices.size();
+        s_tested = count;
+        s_visible.clear();
+        if (count == 0) return;
+
+        const Frustum frustum = Frustum::FromViewProj(proj * view);
+
+        // Walk the packed arrays directly: entity i lives at pages[i / pageSize][i % pageSize]
+        const entt::entity* entities = matrices.data();
+        const auto* pages = matrices.raw();
+        constexpr size_t pageSize = entt::component_traits<WorldMatrixComponent>::page_size;
+
+        const bool anyBounds = !bounds.empty();
+        const bool anyCameras = !cameras.empty();
+
+        const size_t chunks = (count + kChunkSize - 1) / kChunkSize;
+        s_chunkCounts.assign(chunks, 0);
+        if (s_chunkOutput.size() < count)
+            s_chunkOutput.resize(count);
+
+        JobSystem::ParallelFor(chunks, 1, [&](size_t chunkBegin, size_t chunkEnd)
+        {
+            ChunkScratch& scratch = t_Scratch;
+
+            for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk)
+            {
+                const size_t first = chunk * kChunkSize;
+                const size_t n = std::min(kChunkSize, count - first);
+
+                // Gather world-space spheres into SoA
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const size_t index = first + i;
+                    const entt::entity e = entities[index];
+                    const Mat4& m = pages[index / pageSize][index % pageSize].matrix;
+
+                    const BoundsComponent* b = anyBounds && bounds.contains(e) ? &bounds.get(e) : nullptr;
+                    const Vec4 sphere = ComputeWorldSphere(m, b);
+                    scratch.x[i] = sphere.x;
+                    scratch.y[i] = sphere.y;
+                    scratch.z[i] = sphere.z;
+                    scratch.r[i] = sphere.w;
+
+                    // Cameras carry a world matrix too; a -inf radius fails every plane
+                    if (anyCameras && cameras.contains(e))
+                        scratch.r[i] = -std::numeric_limits<float>::infinity();
+                }
+
+                const size_t visible = CullSpheres(frustum, scratch.x, scratch.y, scratch.z, scratch.r, n, scratch.visible);
+
+                // Each chunk writes only its own slice of the output
+                entt::entity* out = s_chunkOutput.data() + first;
+                for (size_t k = 0; k < visible; ++k)
+                    out[k] = entities[first + scratch.visible[k]];
+
+                s_chunkCounts[chunk] = static_cast<uint32_t>(visible);
+            }
+        });
+
+        // Concatenate the chunk slices in storage order
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            const auto first = s_chunkOutput.begin() + static_cast<ptrdiff_t>(chunk * kChunkSize);
+            s_visible.insert(s_visible.end(), first, first + s_chunkCounts[chunk]);
+        }
+    }
+
+    const std::vector<entt::entity>& CullingSystem::GetVisible()
+    {
+        return s_visible;
+    }
+
+    size_t CullingSystem::GetTestedCount()
+    {
+        return s_tested;
+    }
+}
@@ -0,0 +1,214 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/ECS/Systems/HierarchySystem.h"
+#include "Engine/ECS/Systems/TransformSystem.h"
+#include "Engine/Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace ZED
+{
+    HierarchySystem::SortState& HierarchySystem::GetSortState(Registry& r)
+    {
+        // Created on first use; returns the existing one afterwards
+        return r.ctx().emplace<SortState>();
+    }
+
+    void HierarchySystem::connect(Registry& r)
+    {
+        r.on_destroy<HierarchyComponent>().connect<&HierarchySystem::onDestroy>();
+    }
+
+    entt::entity HierarchySystem::GetParent(const Registry& r, entt::entity e)
+    {
+        const auto* h = r.try_get<HierarchyComponent>(e);
+        return h ? h->parent : entt::null;
+    }
+
+    bool HierarchySystem::SetParent(Registry& r, entt::entity child, entt::entity parent)
+    {
+        if (!r.valid(child) || child == parent) return false;
+        if (parent != entt::null && !r.valid(parent)) return false;
+
+        auto& hs = r.storage<HierarchyComponent>();
+
+        // Refuse to attach under one of our own descendants
+        for (entt::entity p = parent; p != entt::null && hs.contains(p); p = hs.get(p).parent)
+        {
+            if (p == child) return false;
+        }
+
+        // Emplace both up front; emplacing may move the storage and invalidate references
+        if (!hs.contains(child)) hs.emplace(child);
+        if (parent != entt::null && !hs.contains(parent)) hs.emplace(parent);
+
+        if (hs.get(child).parent == parent) return true;
+
+        Unlink(r, child);
+
+        if (parent != entt::null)
+        {
+            auto& h  = hs.get(child);
+            auto& ph = hs.get(parent);
+
+            h.parent = parent;
+            h.prevSibling = entt::null;
+            h.nextSibling = ph.firstChild;
+            if (ph.firstChild != entt::null)
+                hs.get(ph.firstChild).prevSibling = child;
+            ph.firstChild = child;
+            ++ph.childCount;
+        }
+
+        // Local TRS is kept as-is, so the child snaps to the same offset under the new parent
+        UpdateSubtreeDepth(r, child);
+        TransformSystem::MarkDirty(r, child);
+
+        auto& state = GetSortState(r);
+        state.needsSort = true;
+        ++state.pendingChanges;
+        return true;
+    }
+
+    void HierarchySystem::Unlink(Registry& r, entt::entity e)
+    {
+        auto& hs = r.storage<HierarchyComponent>();
+        auto& h = hs.get(e);
+        if (h.parent == entt::null) return;
+
+        if (h.prevSibling != entt::null)
+            hs.get(h.prevSibling).nextSibling = h.nextSibling;
+        else if (hs.contains(h.parent))
+            hs.get(h.parent).firstChild = h.nextSibling;
+
+        if (h.nextSibling != entt::null)
+            hs.get(h.nextSibling).prevSibling = h.prevSibling;
+
+        if (hs.contains(h.parent))
+            --hs.get(h.parent).childCount;
+
+        h.parent = entt::null;
+        h.prevSibling = entt::null;
+        h.nextSibling = entt::null;
+    }
+
+    void HierarchySystem::UpdateSubtreeDepth(Registry& r, entt::entity e)
+    {
+        auto& hs = r.storage<HierarchyComponent>();
+
+        // Explicit stack: a 1000-level chain would blow a recursive walk on small thread stacks
+        std::vector<entt::entity> stack{ e };
+        while (!stack.empty())
+        {
+            const entt::entity cur = stack.back();
+            stack.pop_back();
+
+            auto& h = hs.get(cur);
+            h.depth = h.parent != entt::null ? hs.get(h.parent).depth + 1 : 0;
+
+            for (entt::entity c = h.firstChild; c != entt::null; c = hs.get(c).nextSibling)
+                stack.push_back(c);
+        }
+    }
+
+    void HierarchySystem::onDestroy(Registry& r, entt::entity e)
+    {
+        auto& hs = r.storage<HierarchyComponent>();
+
+        // Orphan the children: they become roots and keep their local transform
+        entt::entity c = hs.get(e).firstChild;
+        while (c != entt::null)
+        {
+            auto& ch = hs.get(c);
+            const entt::entity next = ch.nextSibling;
+
+            ch.parent = entt::null;
+            ch.prevSibling = entt::null;
+            ch.nextSibling = entt::null;
+            UpdateSubtreeDepth(r, c);
+            TransformSystem::MarkDirty(r, c);
+
+            c = next;
+        }
+
+        auto& h = hs.get(e);
+        h.firstChild = entt::null;
+        h.childCount = 0;
+        Unlink(r, e);
+
+        // Removal swaps the last element into this slot, which breaks the depth order
+        auto& state = GetSortState(r);
+        state.needsSort = true;
+        ++state.pendingChanges;
+    }
+
+    void HierarchySystem::SortByDepth(Registry& r)
+    {
+        auto& hs = r.storage<HierarchyComponent>();
+        const auto byDepth = [](const HierarchyComponent& a, const HierarchyComponent& b) { return a.depth < b.depth; };
+        if (!std::is_sorted(hs.begin(), hs.end(), byDepth))
+            r.sort<HierarchyComponent>(byDepth);
+    }
+
+    void HierarchySystem::Propagate(Registry& r)
+    {
+        auto& hs = r.storage<HierarchyComponent>();
+        if (hs.empty()) return;
+
+        auto& state = GetSortState(r);
+        if (state.needsSort)
+        {
+            // A handful of re-parents leaves the storage nearly sorted, where insertion sort is
+            // close to linear; after bulk changes fall back to a full sort
+            const auto byDepth = [](const HierarchyComponent& a, const HierarchyComponent& b) { return a.depth < b.depth; };
+            if (state.pendingChanges * 64 < hs.size())
+                r.sort<HierarchyComponent>(byDepth, entt::insertion_sort{});
+            else
+                r.sort<HierarchyComponent>(byDepth);
+
+            state.needsSort = false;
+            state.pendingChanges = 0;
+        }
+
+        auto& dirty      = r.storage<TransformDirty>();
+        auto& transforms = r.storage<TransformComponent>();
+        auto& worlds     = r.storage<WorldMatrixComponent>();
+
+        const auto update = [&](entt::entity e)
+        {
+            auto& h = hs.get(e);
+            const bool parentChanged = h.parent != entt::null && hs.get(h.parent).worldChanged;
+            h.worldChanged = parentChanged || dirty.contains(e);
+            if (!h.worldChanged || !transforms.contains(e) || !worlds.contains(e)) return;
+
+            Mat4 world = TransformComponent::Compose(transforms.get(e));
+            if (h.parent != entt::null && worlds.contains(h.parent))
+                world = worlds.get(h.parent).matrix * world;
+            worlds.get(e).matrix = world;
+        };
+
+        // Sorted iteration order runs from the back of the packed array to the front,
+        // so walk it backwards. Entities of one depth only read their parent (one level up),
+        // which makes each level safe to split across the job system.
+        const entt::entity* entities = hs.data();
+        size_t end = hs.size();
+        while (end > 0)
+        {
+            const uint32_t depth = hs.get(entities[end - 1]).depth;
+            size_t begin = end - 1;
+            while (begin > 0 && hs.get(entities[begin - 1]).depth == depth)
+                --begin;
+
+            JobSystem::ParallelFor(end - begin, 1024, [&](size_t b, size_t e)
+            {
+                for (size_t i = begin + b; i < begin + e; ++i)
+                    update(entities[i]);
+            });
+
+            end = begin;
+        }
+    }
+}
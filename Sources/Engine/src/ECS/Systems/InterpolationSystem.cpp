@@ -0,0 +1,74 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/ECS/Systems/InterpolationSystem.h"
+#include "Engine/ECS/Components/TransformComponent.h"
+#include "Engine/ECS/Components/WorldMatrixComponent.h"
+#include "Engine/ECS/Components/HierarchyComponent.h"
+#include "Engine/ECS/ParallelForEach.h"
+
+namespace ZED
+{
+    void InterpolationSystem::connect(Registry& r)
+    {
+        r.on_construct<PreviousTransformComponent>().connect<&InterpolationSystem::onConstruct>();
+    }
+
+    void InterpolationSystem::onConstruct(Registry& r, entt::entity e)
+    {
+        // Otherwise a new entity would sweep in from the origin over its first step
+        auto& prev = r.get<PreviousTransformComponent>(e);
+        if (const auto* tr = r.try_get<TransformComponent>(e))
+        {
+            prev.position = tr->position;
+            prev.rotation = tr->rotation;
+            prev.scale = tr->scale;
+            prev.renderMatrix = tr->ToMatrix();
+        }
+    }
+
+    void InterpolationSystem::Capture(Registry& r)
+    {
+        ParallelForEach(r.view<PreviousTransformComponent, const TransformComponent>(),
+                        [](entt::entity, PreviousTransformComponent& prev, const TransformComponent& tr)
+        {
+            prev.position = tr.position;
+            prev.rotation = tr.rotation;
+            prev.scale = tr.scale;
+        });
+    }
+
+    void InterpolationSystem::Update(Registry& r, float alpha)
+    {
+        const auto& worlds = r.storage<WorldMatrixComponent>();
+        const auto& hierarchy = r.storage<HierarchyComponent>();
+
+        ParallelForEach(r.view<PreviousTransformComponent, const TransformComponent>(),
+                        [&](entt::entity e, PreviousTransformComponent& prev, const TransformComponent& tr)
+        {
+            // Most interpolated entities are at rest on any given frame; their world matrix is exact
+            if (prev.position == tr.position && prev.rotation == tr.rotation && prev.scale == tr.scale && worlds.contains(e))
+            {
+                prev.renderMatrix = worlds.get(e).matrix;
+                return;
+            }
+
+            const Quat rotation = glm::slerp(QuatFromEuler(prev.rotation), QuatFromEuler(tr.rotation), alpha);
+            const Mat4 local = ComposeTRS(glm::mix(prev.position, tr.position, alpha), rotation,
+                                          glm::mix(prev.scale, tr.scale, alpha));
+
+            const entt::entity parent = hierarchy.contains(e) ? hierarchy.get(e).parent : entt::null;
+            prev.renderMatrix = parent != entt::null && worlds.contains(parent)
+                ? worlds.get(parent).matrix * local
+                : local;
+        }, 512);
+    }
+
+    const Mat4& InterpolationSystem::GetRenderMatrix(const Registry& r, entt::entity e)
+    {
+        if (const auto* prev = r.try_get<PreviousTransformComponent>(e))
+            return prev->renderMatrix;
+        return r.get<WorldMatrixComponent>(e).matrix;
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/ECS/Systems/PhysicsSystem.h"
+#include "Engine/ECS/Systems/TransformSystem.h"
+#include "Engine/ECS/Components/HierarchyComponent.h"
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/Physics/Physics.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <iostream>
+#include <vector>
+
+namespace ZED
+{
+    namespace
+    {
+        // Reused every frame so steady-state updates don't allocate
+        std::vector<PhysicsBodyDesc> s_descs;
+        std::vector<PhysicsBodyHandle> s_handles;
+        std::vector<entt::entity> s_pending;
+        std::vector<PhysicsBodyPose> s_poses;
+
+        // Tags parented bodies that were already warned about, so the warning shows once per entity
+        struct ParentedBodyWarned {};
+
+        // Bodies live in world space but a child's TransformComponent is relative to its parent
+        template <typename Storage>
+        bool HasParent(const Storage& hierarchy, entt::entity e)
+        {
+            return hierarchy.contains(e) && hierarchy.get(e).parent != entt::null;
+        }
+    }
+
+    void PhysicsSystem::connect(Registry& r)
+    {
+        r.on_destroy<RigidBodyComponent>().connect<&PhysicsSystem::onDestroy>();
+    }
+
+    void PhysicsSystem::onDestroy(Registry& r, entt::entity e)
+    {
+        auto& rb = r.get<RigidBodyComponent>(e);
+        if (rb.handle == kInvalidPhysicsBody) return;
+
+        if (IPhysics* physics = Physics::Get())
+            physics->DestroyBody(rb.handle);
+        rb.handle = kInvalidPhysicsBody;
+    }
+
+    void PhysicsSystem::CreatePendingBodies(Registry& r)
+    {
+        IPhysics* physics = Physics::Get();
+        if (!physics) return;
+
+        s_descs.clear();
+        s_pending.clear();
+
+        const auto& hierarchy = r.storage<HierarchyComponent>();
+        auto& warned = r.storage<ParentedBodyWarned>();
+
+        for (auto [e, rb, col, tr] : r.view<RigidBodyComponent, ColliderComponent, TransformComponent>().each())
+        {
+            if (rb.handle != kInvalidPhysicsBody) continue;
+
+            if (HasParent(hierarchy, e))
+            {
+                if (!warned.contains(e))
+                {
+                    warned.emplace(e);
+                    std::cerr << "[ZED::PhysicsSystem] Entity " << entt::to_integral(e)
+                              << " has a parent; rigid bodies must be root entities, skipping its body\n";
+                }
+                continue;
+            }
+
+            PhysicsBodyDesc desc;
+            desc.entity = entt::to_integral(e);
+            desc.position = tr.position;
+            desc.rotation = QuatFromEuler(tr.rotation);
+            desc.scale = tr.scale;
+            desc.body = rb;
+            desc.collider = col;
+            s_descs.push_back(desc);
+            s_pending.push_back(e);
+        }
+
+        if (s_descs.empty()) return;
+
+        s_handles.assign(s_descs.size(), kInvalidPhysicsBody);
+        physics->CreateBodies(s_descs, s_handles);
+
+        auto& bodies = r.storage<RigidBodyComponent>();
+        for (size_t i = 0; i < s_pending.size(); ++i)
+            bodies.get(s_pending[i]).handle = s_handles[i];
+    }
+
+    void PhysicsSystem::FixedUpdate(Registry& r, float dt)
+    {
+        IPhysics* physics = Physics::Get();
+        if (!physics) return;
+
+        CreatePendingBodies(r);
+
+        // Kinematic bodies reach their TransformComponent pose by the end of the step
+        const auto& hierarchy = r.storage<HierarchyComponent>();
+        for (auto [e, rb, tr] : r.view<RigidBodyComponent, TransformComponent>().each())
+        {
+            if (rb.motion == BodyMotion::Kinematic && rb.handle != kInvalidPhysicsBody && !HasParent(hierarchy, e))
+                physics->MoveKinematic(rb.handle, tr.position, QuatFromEuler(tr.rotation), dt);
+        }
+
+        {
+            ZED_PROFILE_SCOPE("IPhysics::Step");
+            physics->Step(dt);
+        }
+
+        ZED_PROFILE_SCOPE("PhysicsSystem::WriteBack");
+        WriteBack(r);
+    }
+
+    void PhysicsSystem::WriteBack(Registry& r)
+    {
+        IPhysics* physics = Physics::Get();
+        physics->GetActivePoses(s_poses);
+        if (s_poses.empty()) return;
+
+        auto& transforms = r.storage<TransformComponent>();
+        auto& bodies = r.storage<RigidBodyComponent>();
+        const auto& hierarchy = r.storage<HierarchyComponent>();
+
+        // Writing components in place doesn't touch storage layout, so it can run in parallel
+        JobSystem::ParallelFor(s_poses.size(), 512, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const PhysicsBodyPose& pose = s_poses[i];
+                const auto e = static_cast<entt::entity>(pose.entity);
+                if (!transforms.contains(e) || !bodies.contains(e)) continue;
+                if (bodies.get(e).motion != BodyMotion::Dynamic || HasParent(hierarchy, e)) continue;
+
+                TransformComponent& tr = transforms.get(e);
+                tr.position = pose.position;
+                tr.rotation = EulerFromQuat(pose.rotation);
+            }
+        });
+
+        // Tagging changes storage, so it can't happen inside the parallel pass
+        for (const PhysicsBodyPose& pose : s_poses)
+        {
+            const auto e = static_cast<entt::entity>(pose.entity);
+            if (transforms.contains(e) && bodies.contains(e) && bodies.get(e).motion == BodyMotion::Dynamic && !HasParent(hierarchy, e))
+                TransformSystem::MarkDirty(r, e);
+        }
+    }
+}
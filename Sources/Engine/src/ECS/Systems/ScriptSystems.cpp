@@ -6,17 +6,29 @@
 #include "Engine/Interfaces/Scripting/IScripting.h"
 #include "Engine/Scripting/Scripting.h"
 #include "Engine/ECS/Components/ScriptComponent.h"
+#include "Engine/Determinism/Determinism.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <map>
+#include <vector>
 
 namespace ZED
 {
-    void ScriptLifecycleSystem::connect(entt::registry& r)
+    namespace
+    {
+        // Entities grouped by ScriptId, rebuilt every tick. The vectors are cleared rather
+        // than freed so a steady scene stops allocating after the first frame.
+        std::map<uint64_t, std::vector<Entity>> s_Batches;
+    }
+
+    void ScriptLifecycleSystem::connect(Registry& r)
     {
         // Handlers must have signature: void(registry&, entity)
         r.on_construct<ScriptComponent>().connect<&ScriptLifecycleSystem::onAdd>();
         r.on_destroy  <ScriptComponent>().connect<&ScriptLifecycleSystem::onRemove>();
     }
 
-    void ScriptLifecycleSystem::onAdd(entt::registry& r, entt::entity e)
+    void ScriptLifecycleSystem::onAdd(Registry& r, entt::entity e)
     {
         IScripting* s = Scripting::Get();
         if (!s) return;
@@ -27,7 +39,7 @@ namespace ZED
         s->Start({sc.script}, static_cast<uint32_t>(e));
     }
 
-    void ScriptLifecycleSystem::onRemove(entt::registry& r, entt::entity e)
+    void ScriptLifecycleSystem::onRemove(Registry& r, entt::entity e)
     {
         IScripting* s = Scripting::Get();
         if (!s) return;
@@ -36,17 +48,50 @@ namespace ZED
         s->Stop({sc.script}, static_cast<uint32_t>(e));
     }
 
-    void ScriptUpdateSystem::tick(entt::registry& r, double dt)
+    void ScriptUpdateSystem::tick(Registry& r, double dt)
     {
+        ZED_PROFILE_SCOPE("ScriptUpdateSystem::tick");
         IScripting* s = Scripting::Get();
         if (!s) return;
 
+        s->BeginFrame();
+
+        // Lockstep: the tick's recorded input reaches OnEvent in arrival order, before any update
+        if (Determinism::IsEnabled())
+        {
+            for (const InputRecord& record : Determinism::GetTickInput())
+            {
+                const Event ev = Determinism::ToEvent(record.event);
+                s->PushEvent(static_cast<int>(ev.type), ev.a, ev.b, ev.c, ev.d);
+            }
+        }
+
+        for (auto& [script, entities] : s_Batches)
+            entities.clear();
+
+        // Entities sharing a script are usually created together, so cache the last bucket
+        uint64_t lastScript = 0;
+        std::vector<Entity>* bucket = nullptr;
+
         auto view = r.view<ScriptComponent>();
         for (auto ent : view)
         {
             auto& sc = view.get<ScriptComponent>(ent);
-            if (sc.enabled)
-                s->Update({sc.script}, static_cast<uint32_t>(ent), dt);
+            if (!sc.enabled) continue;
+
+            if (!bucket || sc.script != lastScript)
+            {
+                lastScript = sc.script;
+                bucket = &s_Batches[sc.script];
+            }
+            bucket->push_back(static_cast<uint32_t>(ent));
+        }
+
+        // One call into the scripting module per script rather than per entity
+        for (auto& [script, entities] : s_Batches)
+        {
+            if (!entities.empty())
+                s->UpdateBatch({script}, entities, dt);
         }
     }
 }
\ No newline at end of file
@@ -3,6 +3,48 @@
  */
 
 #include "Engine/ECS/Systems/TransformSystem.h"
+#include "Engine/ECS/Systems/HierarchySystem.h"
 
-// Intentionally empty since all methods are inline/simple.
-// This TU exists to keep parity with other systems and for future expansion.
\ No newline at end of file
+namespace ZED
+{
+    void TransformSystem::connect(Registry& r)
+    {
+        r.on_construct<TransformComponent>().connect<&TransformSystem::onConstruct>();
+        r.on_update   <TransformComponent>().connect<&TransformSystem::onUpdate>();
+        r.on_destroy  <TransformComponent>().connect<&TransformSystem::onDestroy>();
+    }
+
+    void TransformSystem::onConstruct(Registry& r, entt::entity e)
+    {
+        r.emplace_or_replace<WorldMatrixComponent>(e);
+        MarkDirty(r, e);
+    }
+
+    void TransformSystem::onUpdate(Registry& r, entt::entity e)
+    {
+        MarkDirty(r, e);
+    }
+
+    void TransformSystem::onDestroy(Registry& r, entt::entity e)
+    {
+        r.remove<WorldMatrixComponent, TransformDirty>(e);
+    }
+
+    void TransformSystem::UpdateWorldMatrices(Registry& r)
+    {
+        auto& dirty = r.storage<TransformDirty>();
+        if (dirty.empty()) return;
+
+        // The tag storage leads the view, so only changed entities are visited.
+        // Parented entities need their parent's matrix first and are handled by the hierarchy pass.
+        auto view = r.view<TransformDirty, TransformComponent, WorldMatrixComponent>(entt::exclude<HierarchyComponent>);
+        ParallelForEach(view, [](entt::entity, const TransformComponent& tr, WorldMatrixComponent& wm)
+        {
+            wm.matrix = TransformComponent::Compose(tr);
+        }, 256);
+
+        HierarchySystem::Propagate(r);
+
+        dirty.clear();
+    }
+}
@@ -3,6 +3,8 @@
  */
 
 #include "Engine/Events/EventSystem.h"
+#include "Engine/Profiler/Profiler.h"
+#include <algorithm>
 #include <utility>
 
 namespace ZED
@@ -16,72 +18,108 @@ namespace ZED
 
     int EventSystem::Subscribe(EventType type, Handler handler)
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        const auto index = static_cast<size_t>(type);
+        if (index >= kEventTypeCount) return 0;
+
+        std::lock_guard<std::mutex> lock(m_WriteMutex);
         int id = m_NextId++;
-        m_Handlers[type].push_back({id, std::move(handler)});
+
+        // Copy-on-write: readers keep iterating the old list until the next dispatch
+        auto list = m_OwnedHandlers[index] ? std::make_unique<HandlerList>(*m_OwnedHandlers[index])
+                                           : std::make_unique<HandlerList>();
+        list->push_back({id, std::move(handler)});
+        Publish(type, std::move(list));
         return id;
     }
 
     void EventSystem::Unsubscribe(EventType type, int id)
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        auto it = m_Handlers.find(type);
-        if (it != m_Handlers.end())
+        const auto index = static_cast<size_t>(type);
+        if (index >= kEventTypeCount) return;
+
+        std::lock_guard<std::mutex> lock(m_WriteMutex);
+        const HandlerList* current = m_OwnedHandlers[index].get();
+        if (!current) return;
+
+        auto list = std::make_unique<HandlerList>();
+        list->reserve(current->size());
+        std::copy_if(current->begin(), current->end(), std::back_inserter(*list), [id](const Subscription& sub) {
+            return sub.id != id;
+        });
+
+        if (list->size() == current->size()) return; // id not found, nothing to publish
+        Publish(type, std::move(list));
+    }
+
+    void EventSystem::Publish(EventType type, std::unique_ptr<const HandlerList> list)
+    {
+        const auto index = static_cast<size_t>(type);
+        m_Handlers[index].store(list.get(), std::memory_order_release);
+
+        // The dispatch thread may still be walking the old list; free it on the next Dispatch()
+        if (m_OwnedHandlers[index])
         {
-            auto& vec = it->second;
-            vec.erase(std::remove_if(vec.begin(), vec.end(), [id](const Subscription& sub) {
-                return sub.id == id;
-            }), vec.end());
+            m_Retired.push_back(std::move(m_OwnedHandlers[index]));
+            m_HasRetired.store(true, std::memory_order_release);
         }
+        m_OwnedHandlers[index] = std::move(list);
+    }
+
+    void EventSystem::ReclaimRetired()
+    {
+        // Only touch the writer lock when something was actually retired
+        if (!m_HasRetired.exchange(false, std::memory_order_acquire)) return;
+
+        std::lock_guard<std::mutex> lock(m_WriteMutex);
+        m_Retired.clear();
     }
 
-    void EventSystem::Post(const Event& e)
+    bool EventSystem::Post(const Event& e)
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        m_EventQueue.push(e);
+        if (m_EventQueue.Push(e)) return true;
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
     }
 
-    void EventSystem::PostDeferred(const Event& e)
+    bool EventSystem::PostDeferred(const Event& e)
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        m_DeferredQueue.push(e);
+        if (m_DeferredQueue.Push(e)) return true;
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
     }
 
     void EventSystem::DispatchDeferred()
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        while (!m_DeferredQueue.empty())
+        ZED_PROFILE_SCOPE("EventSystem::DispatchDeferred");
+
+        // Move only what was queued when we started so a steady stream of
+        // producers can't keep us here forever
+        const size_t end = m_DeferredQueue.EnqueueTicket();
+        Event e{};
+        while (m_DeferredQueue.DequeueTicket() != end && m_DeferredQueue.Pop(e))
         {
-            m_EventQueue.push(m_DeferredQueue.front());
-            m_DeferredQueue.pop();
+            Post(e);
         }
     }
 
     void EventSystem::Dispatch()
     {
-        std::queue<Event> localQueue;
-        {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            localQueue.swap(m_EventQueue);
-        }
+        ZED_PROFILE_SCOPE("EventSystem::Dispatch");
+        ReclaimRetired();
 
-        // Process outside the lock to allow posting within handlers
-        while (!localQueue.empty())
+        // Events posted by handlers land after 'end' and are delivered next call
+        const size_t end = m_EventQueue.EnqueueTicket();
+        Event e{};
+        while (m_EventQueue.DequeueTicket() != end && m_EventQueue.Pop(e))
         {
-            const Event e = localQueue.front();
-            localQueue.pop();
+            const auto index = static_cast<size_t>(e.type);
+            if (index >= kEventTypeCount) continue;
+            if (m_DispatchSink) m_DispatchSink->push_back(e);
 
-            std::vector<Subscription> subs;
-            {
-                std::lock_guard<std::mutex> lock(m_Mutex);
-                auto it = m_Handlers.find(e.type);
-                if (it != m_Handlers.end())
-                {
-                    subs = it->second;
-                }
-            }
+            const HandlerList* subs = m_Handlers[index].load(std::memory_order_acquire);
+            if (!subs) continue;
 
-            for (const auto& sub : subs)
+            for (const auto& sub : *subs)
             {
                 try {
                     sub.handler(e);
@@ -92,4 +130,14 @@ namespace ZED
             }
         }
     }
-}
\ No newline at end of file
+
+    void EventSystem::SetDispatchSink(std::vector<Event>* sink)
+    {
+        m_DispatchSink = sink;
+    }
+
+    uint64_t EventSystem::GetDroppedCount() const
+    {
+        return m_Dropped.load(std::memory_order_relaxed);
+    }
+}
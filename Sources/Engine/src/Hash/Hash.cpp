@@ -0,0 +1,277 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Hash/Hash.h"
+
+#include <bit>
+#include <cstring>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ZED_HASH_SSE2 1
+#endif
+
+// XXH3 64-bit, default secret and seed 0 only. Follows xxHash 0.8 (BSD-2-Clause, Yann Collet)
+// step for step: every size class below has its own code path there too, and long inputs use
+// its SSE2 kernel where available and the scalar one elsewhere.
+
+namespace ZED
+{
+    static_assert(std::endian::native == std::endian::little, "Hash64 reads input as little-endian words");
+
+    namespace
+    {
+        constexpr uint64_t kPrime32_1 = 0x9E3779B1U;
+        constexpr uint64_t kPrime32_2 = 0x85EBCA77U;
+        constexpr uint64_t kPrime32_3 = 0xC2B2AE3DU;
+        constexpr uint64_t kPrime64_1 = 0x9E3779B185EBCA87ULL;
+        constexpr uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+        constexpr uint64_t kPrime64_3 = 0x165667B19E3779F9ULL;
+        constexpr uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ULL;
+        constexpr uint64_t kPrime64_5 = 0x27D4EB2F165667C5ULL;
+        constexpr uint64_t kPrimeMx1  = 0x165667919E3779F9ULL;
+        constexpr uint64_t kPrimeMx2  = 0x9FB21C651E98DF25ULL;
+
+        constexpr size_t kSecretSize = 192;
+        constexpr size_t kStripeLen = 64;
+        constexpr size_t kStripesPerBlock = (kSecretSize - kStripeLen) / 8;
+        constexpr size_t kBlockLen = kStripeLen * kStripesPerBlock;
+
+        alignas(64) constexpr uint8_t kSecret[kSecretSize] = {
+            0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+            0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+            0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+            0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+            0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+            0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+            0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+            0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+            0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+            0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+            0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+            0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+        };
+
+        inline uint32_t Read32(const uint8_t* p)
+        {
+            uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        inline uint64_t Read64(const uint8_t* p)
+        {
+            uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        inline uint64_t Mul128Fold64(uint64_t lhs, uint64_t rhs)
+        {
+        #if defined(__SIZEOF_INT128__)
+            const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+            return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+        #elif defined(_MSC_VER)
+            uint64_t high = 0;
+            const uint64_t low = _umul128(lhs, rhs, &high);
+            return low ^ high;
+        #else
+            const uint64_t loLo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+            const uint64_t hiLo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+            const uint64_t loHi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+            const uint64_t hiHi = (lhs >> 32) * (rhs >> 32);
+            const uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+            const uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+            const uint64_t lower = (cross << 32) | (loLo & 0xFFFFFFFF);
+            return lower ^ upper;
+        #endif
+        }
+
+        inline uint64_t ByteSwap64(uint64_t v)
+        {
+            v = ((v & 0x00FF00FF00FF00FFULL) << 8) | ((v >> 8) & 0x00FF00FF00FF00FFULL);
+            v = ((v & 0x0000FFFF0000FFFFULL) << 16) | ((v >> 16) & 0x0000FFFF0000FFFFULL);
+            return (v << 32) | (v >> 32);
+        }
+
+        inline uint64_t XorShift(uint64_t v, int shift)
+        {
+            return v ^ (v >> shift);
+        }
+
+        inline uint64_t Avalanche64(uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= kPrime64_2;
+            h ^= h >> 29;
+            h *= kPrime64_3;
+            return h ^ (h >> 32);
+        }
+
+        inline uint64_t Avalanche(uint64_t h)
+        {
+            h = XorShift(h, 37);
+            h *= kPrimeMx1;
+            return XorShift(h, 32);
+        }
+
+        inline uint64_t Rrmxmx(uint64_t h, uint64_t len)
+        {
+            h ^= std::rotl(h, 49) ^ std::rotl(h, 24);
+            h *= kPrimeMx2;
+            h ^= (h >> 35) + len;
+            h *= kPrimeMx2;
+            return XorShift(h, 28);
+        }
+
+        inline uint64_t Mix16(const uint8_t* input, const uint8_t* secret)
+        {
+            return Mul128Fold64(Read64(input) ^ Read64(secret), Read64(input + 8) ^ Read64(secret + 8));
+        }
+
+        uint64_t HashUpTo16(const uint8_t* input, size_t len)
+        {
+            if (len > 8)
+            {
+                const uint64_t lo = Read64(input) ^ (Read64(kSecret + 24) ^ Read64(kSecret + 32));
+                const uint64_t hi = Read64(input + len - 8) ^ (Read64(kSecret + 40) ^ Read64(kSecret + 48));
+                return Avalanche(len + ByteSwap64(lo) + hi + Mul128Fold64(lo, hi));
+            }
+            if (len >= 4)
+            {
+                const uint64_t in64 = Read32(input + len - 4) + (static_cast<uint64_t>(Read32(input)) << 32);
+                return Rrmxmx(in64 ^ (Read64(kSecret + 8) ^ Read64(kSecret + 16)), len);
+            }
+            if (len > 0)
+            {
+                const uint32_t combined = (static_cast<uint32_t>(input[0]) << 16) | (static_cast<uint32_t>(input[len >> 1]) << 24)
+                                        | static_cast<uint32_t>(input[len - 1]) | (static_cast<uint32_t>(len) << 8);
+                return Avalanche64(combined ^ static_cast<uint64_t>(Read32(kSecret) ^ Read32(kSecret + 4)));
+            }
+            return Avalanche64(Read64(kSecret + 56) ^ Read64(kSecret + 64));
+        }
+
+        uint64_t HashUpTo128(const uint8_t* input, size_t len)
+        {
+            uint64_t acc = len * kPrime64_1;
+            if (len > 32)
+            {
+                if (len > 64)
+                {
+                    if (len > 96)
+                    {
+                        acc += Mix16(input + 48, kSecret + 96);
+                        acc += Mix16(input + len - 64, kSecret + 112);
+                    }
+                    acc += Mix16(input + 32, kSecret + 64);
+                    acc += Mix16(input + len - 48, kSecret + 80);
+                }
+                acc += Mix16(input + 16, kSecret + 32);
+                acc += Mix16(input + len - 32, kSecret + 48);
+            }
+            acc += Mix16(input, kSecret);
+            acc += Mix16(input + len - 16, kSecret + 16);
+            return Avalanche(acc);
+        }
+
+        uint64_t HashUpTo240(const uint8_t* input, size_t len)
+        {
+            uint64_t acc = len * kPrime64_1;
+            for (size_t i = 0; i < 8; ++i)
+                acc += Mix16(input + 16 * i, kSecret + 16 * i);
+
+            uint64_t accEnd = Mix16(input + len - 16, kSecret + 136 - 17);
+            acc = Avalanche(acc);
+            for (size_t i = 8; i < len / 16; ++i)
+                accEnd += Mix16(input + 16 * i, kSecret + 16 * (i - 8) + 3);
+            return Avalanche(acc + accEnd);
+        }
+
+        inline void Accumulate512(uint64_t* acc, const uint8_t* input, const uint8_t* secret)
+        {
+        #if defined(ZED_HASH_SSE2)
+            // Two lanes per register; the same operations as the scalar loop below
+            auto* xacc = reinterpret_cast<__m128i*>(acc);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input) + i);
+                const __m128i key = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+                const __m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+                const __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+                xacc[i] = _mm_add_epi64(product, _mm_add_epi64(xacc[i], swapped));
+            }
+        #else
+            for (size_t lane = 0; lane < 8; ++lane)
+            {
+                const uint64_t value = Read64(input + lane * 8);
+                const uint64_t key = value ^ Read64(secret + lane * 8);
+                acc[lane ^ 1] += value;
+                acc[lane] += (key & 0xFFFFFFFF) * (key >> 32);
+            }
+        #endif
+        }
+
+        inline void Accumulate(uint64_t* acc, const uint8_t* input, size_t stripes)
+        {
+            for (size_t n = 0; n < stripes; ++n)
+                Accumulate512(acc, input + n * kStripeLen, kSecret + n * 8);
+        }
+
+        inline void Scramble(uint64_t* acc)
+        {
+            const uint8_t* secret = kSecret + kSecretSize - kStripeLen;
+        #if defined(ZED_HASH_SSE2)
+            auto* xacc = reinterpret_cast<__m128i*>(acc);
+            const __m128i prime = _mm_set1_epi32(static_cast<int>(kPrime32_1));
+            for (size_t i = 0; i < 4; ++i)
+            {
+                const __m128i shifted = _mm_xor_si128(xacc[i], _mm_srli_epi64(xacc[i], 47));
+                const __m128i key = _mm_xor_si128(shifted, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+                const __m128i productLo = _mm_mul_epu32(key, prime);
+                const __m128i productHi = _mm_mul_epu32(_mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+                xacc[i] = _mm_add_epi64(productLo, _mm_slli_epi64(productHi, 32));
+            }
+        #else
+            for (size_t lane = 0; lane < 8; ++lane)
+                acc[lane] = (XorShift(acc[lane], 47) ^ Read64(secret + lane * 8)) * kPrime32_1;
+        #endif
+        }
+
+        uint64_t HashLong(const uint8_t* input, size_t len)
+        {
+            alignas(64) uint64_t acc[8] = { kPrime32_3, kPrime64_1, kPrime64_2, kPrime64_3,
+                                            kPrime64_4, kPrime32_2, kPrime64_5, kPrime32_1 };
+
+            const size_t blocks = (len - 1) / kBlockLen;
+            for (size_t n = 0; n < blocks; ++n)
+            {
+                Accumulate(acc, input + n * kBlockLen, kStripesPerBlock);
+                Scramble(acc);
+            }
+
+            // Whole stripes of the last block, then the final 64 bytes (which may overlap them)
+            const size_t stripes = ((len - 1) - kBlockLen * blocks) / kStripeLen;
+            Accumulate(acc, input + blocks * kBlockLen, stripes);
+            Accumulate512(acc, input + len - kStripeLen, kSecret + kSecretSize - kStripeLen - 7);
+
+            uint64_t result = len * kPrime64_1;
+            for (size_t i = 0; i < 4; ++i)
+                result += Mul128Fold64(acc[2 * i] ^ Read64(kSecret + 11 + 16 * i), acc[2 * i + 1] ^ Read64(kSecret + 19 + 16 * i));
+            return Avalanche(result);
+        }
+    }
+
+    uint64_t Hash64(const void* data, size_t size)
+    {
+        const auto* input = static_cast<const uint8_t*>(data);
+        if (size <= 16) return HashUpTo16(input, size);
+        if (size <= 128) return HashUpTo128(input, size);
+        if (size <= 240) return HashUpTo240(input, size);
+        return HashLong(input, size);
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/IO/MappedFile.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace ZED
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            m_Data = std::exchange(other.m_Data, nullptr);
+            m_Size = std::exchange(other.m_Size, 0);
+        #if defined(_WIN32)
+            m_File = std::exchange(other.m_File, nullptr);
+            m_Mapping = std::exchange(other.m_Mapping, nullptr);
+        #endif
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const std::string& path)
+    {
+        Close();
+
+    #if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view)
+        {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_File = file;
+        m_Mapping = mapping;
+        m_Data = static_cast<const std::byte*>(view);
+        m_Size = static_cast<size_t>(size.QuadPart);
+    #else
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // the mapping keeps the file alive
+        if (view == MAP_FAILED) return false;
+
+        // Loaders stream through the file front to back
+        madvise(view, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+
+        m_Data = static_cast<const std::byte*>(view);
+        m_Size = static_cast<size_t>(st.st_size);
+    #endif
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (!m_Data) return;
+
+    #if defined(_WIN32)
+        UnmapViewOfFile(m_Data);
+        CloseHandle(static_cast<HANDLE>(m_Mapping));
+        CloseHandle(static_cast<HANDLE>(m_File));
+        m_File = nullptr;
+        m_Mapping = nullptr;
+    #else
+        munmap(const_cast<std::byte*>(m_Data), m_Size);
+    #endif
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+}
@@ -0,0 +1,263 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ZED
+{
+    namespace
+    {
+        struct Job
+        {
+            JobSystem::JobFunc func = nullptr;
+            void* data = nullptr;
+            size_t begin = 0;
+            size_t end = 0;
+            JobCounter* counter = nullptr;
+        };
+
+        // Per-worker deque: owner works the back, thieves take from the front
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+
+            void Push(const Job& job)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                jobs.push_back(job);
+            }
+
+            bool Pop(Job& out)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (jobs.empty()) return false;
+                out = jobs.back();
+                jobs.pop_back();
+                return true;
+            }
+
+            bool Steal(Job& out)
+            {
+                std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+                if (!lock.owns_lock() || jobs.empty()) return false;
+                out = jobs.front();
+                jobs.pop_front();
+                return true;
+            }
+        };
+
+        struct State
+        {
+            std::vector<std::unique_ptr<WorkerQueue>> queues; // [0] belongs to the thread that called Init()
+            std::vector<std::thread> threads;
+
+            std::atomic<bool> running{false};
+            std::atomic<uint32_t> queued{0};
+
+            // Idle workers park here instead of spinning
+            std::mutex sleepMutex;
+            std::condition_variable sleepCv;
+        };
+
+        State s_State;
+
+        // Index of the queue owned by this thread; external threads feed queue 0
+        thread_local uint32_t t_WorkerIndex = 0;
+
+        void Push(const Job& job)
+        {
+            if (job.counter)
+                job.counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+            s_State.queued.fetch_add(1, std::memory_order_release);
+            s_State.queues[t_WorkerIndex]->Push(job);
+
+            // Touch the sleep mutex so a worker between its predicate check and wait() can't miss this
+            { std::lock_guard<std::mutex> lock(s_State.sleepMutex); }
+            s_State.sleepCv.notify_one();
+        }
+
+        bool TryGetJob(Job& out)
+        {
+            const auto count = static_cast<uint32_t>(s_State.queues.size());
+            if (s_State.queues[t_WorkerIndex]->Pop(out)) return true;
+
+            // Steal round-robin starting from our neighbour to spread contention
+            for (uint32_t i = 1; i < count; ++i)
+            {
+                const uint32_t victim = (t_WorkerIndex + i) % count;
+                if (s_State.queues[victim]->Steal(out)) return true;
+            }
+            return false;
+        }
+
+        void Execute(const Job& job)
+        {
+            s_State.queued.fetch_sub(1, std::memory_order_relaxed);
+            job.func(job.data, job.begin, job.end);
+            if (job.counter)
+                job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        void WorkerLoop(uint32_t index)
+        {
+            t_WorkerIndex = index;
+            ZED_PROFILE_THREAD(("Worker " + std::to_string(index)).c_str());
+
+            Job job;
+            while (s_State.running.load(std::memory_order_acquire))
+            {
+                if (TryGetJob(job))
+                {
+                    Execute(job);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(s_State.sleepMutex);
+                s_State.sleepCv.wait(lock, []
+                {
+                    return s_State.queued.load(std::memory_order_acquire) > 0 ||
+                           !s_State.running.load(std::memory_order_acquire);
+                });
+            }
+        }
+
+        void RunFunction(void* data, size_t, size_t)
+        {
+            std::unique_ptr<std::function<void()>> fn(static_cast<std::function<void()>*>(data));
+            (*fn)();
+        }
+    }
+
+    void JobSystem::Init(uint32_t workerCount)
+    {
+        if (s_State.running.load()) return;
+
+        if (workerCount == 0)
+        {
+            const uint32_t hw = std::thread::hardware_concurrency();
+            workerCount = hw > 1 ? hw - 1 : 0;
+        }
+
+        s_State.queues.clear();
+        for (uint32_t i = 0; i < workerCount + 1; ++i)
+            s_State.queues.push_back(std::make_unique<WorkerQueue>());
+
+        t_WorkerIndex = 0;
+        s_State.running.store(true, std::memory_order_release);
+
+        for (uint32_t i = 1; i <= workerCount; ++i)
+            s_State.threads.emplace_back(WorkerLoop, i);
+
+        std::cout << "[ZED::JobSystem] Started with " << workerCount << " worker thread(s)\n";
+    }
+
+    void JobSystem::InitFromConfig()
+    {
+        const auto& ini = Config::Get();
+        const long workers = ini.GetLongValue("Jobs", "WorkerThreads", 0);
+        Init(workers > 0 ? static_cast<uint32_t>(workers) : 0);
+    }
+
+    void JobSystem::Shutdown()
+    {
+        if (!s_State.running.load()) return;
+
+        // Finish whatever is still queued on the calling thread before stopping
+        Job job;
+        while (TryGetJob(job))
+            Execute(job);
+
+        {
+            std::lock_guard<std::mutex> lock(s_State.sleepMutex);
+            s_State.running.store(false, std::memory_order_release);
+        }
+        s_State.sleepCv.notify_all();
+
+        for (auto& t : s_State.threads)
+            if (t.joinable()) t.join();
+
+        s_State.threads.clear();
+        s_State.queues.clear();
+    }
+
+    uint32_t JobSystem::GetThreadCount()
+    {
+        return s_State.running.load() ? static_cast<uint32_t>(s_State.queues.size()) : 1u;
+    }
+
+    bool JobSystem::IsInitialized()
+    {
+        return s_State.running.load(std::memory_order_acquire);
+    }
+
+    uint32_t JobSystem::GetWorkerIndex()
+    {
+        return t_WorkerIndex;
+    }
+
+    void JobSystem::Run(JobFunc func, void* data, size_t begin, size_t end, JobCounter* counter)
+    {
+        if (!IsInitialized())
+        {
+            func(data, begin, end);
+            return;
+        }
+        Push(Job{func, data, begin, end, counter});
+    }
+
+    void JobSystem::Run(std::function<void()> job, JobCounter* counter)
+    {
+        Run(RunFunction, new std::function<void()>(std::move(job)), 0, 0, counter);
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        Job job;
+        while (!counter.IsDone())
+        {
+            // Help out instead of blocking: this is what lets nested ParallelFor calls make progress
+            if (IsInitialized() && TryGetJob(job))
+                Execute(job);
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    void JobSystem::ParallelForImpl(size_t count, size_t minBatch, JobFunc func, void* data)
+    {
+        const size_t threads = GetThreadCount();
+        if (threads <= 1 || count <= minBatch)
+        {
+            func(data, 0, count);
+            return;
+        }
+
+        // A few batches per thread keeps everyone busy when batches are uneven
+        const size_t target = threads * 4;
+        const size_t batch = std::max<size_t>(std::max<size_t>(minBatch, 1), (count + target - 1) / target);
+
+        JobCounter counter;
+        size_t begin = 0;
+        for (; begin + batch < count; begin += batch)
+            Push(Job{func, data, begin, begin + batch, &counter});
+
+        // Run the tail on this thread, then help with the rest
+        func(data, begin, count);
+        Wait(counter);
+    }
+}
@@ -0,0 +1,372 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Memory/Memory.h"
+#include "Engine/Config/Config.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace ZED
+{
+    namespace
+    {
+        constexpr std::array<const char*, kMemoryTagCount> kTagNames{
+            "General", "ECS", "Events", "Scripting", "Physics", "Renderer", "Frame"
+        };
+
+        // ---------- accounting ----------
+        struct TagCounters
+        {
+            // Written from any thread
+            std::atomic<int64_t> live{ 0 };
+            std::atomic<uint64_t> frameBytes{ 0 };
+            std::atomic<uint64_t> frameAllocations{ 0 };
+
+            // Closed frames, written by EndFrame() only
+            int64_t peakLive = 0;
+            uint64_t lastFrameBytes = 0;
+            uint64_t lastFrameAllocations = 0;
+            uint64_t peakFrameBytes = 0;
+            uint64_t totalBytes = 0;
+            uint64_t totalAllocations = 0;
+        };
+
+        std::array<TagCounters, kMemoryTagCount> s_tags;
+        uint64_t s_frames = 0;
+        uint64_t s_reportInterval = 0;
+
+        TagCounters& Counters(MemoryTag tag)
+        {
+            const auto index = static_cast<size_t>(tag);
+            return s_tags[index < kMemoryTagCount ? index : 0];
+        }
+
+        void Charge(MemoryTag tag, size_t size)
+        {
+            TagCounters& c = Counters(tag);
+            c.live.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+            c.frameBytes.fetch_add(size, std::memory_order_relaxed);
+            c.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Release(MemoryTag tag, size_t size)
+        {
+            Counters(tag).live.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+        }
+
+        // ---------- small-object pools ----------
+        constexpr size_t kClassCount = Memory::kMaxPooledSize / Memory::kPoolAlignment;
+        constexpr size_t kChunkSize = 64 * 1024;
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        // Trivially destructible, so frees during static destruction still work
+        thread_local std::array<FreeBlock*, kClassCount> t_freeLists{};
+
+        std::atomic<uint64_t> s_poolChunks{ 0 };
+
+        bool IsPooled(size_t size, size_t alignment)
+        {
+            return size <= Memory::kMaxPooledSize && alignment <= Memory::kPoolAlignment;
+        }
+
+        // Size classes step by kPoolAlignment: 1..16 -> 0, 17..32 -> 1, ...
+        size_t ClassOf(size_t size)
+        {
+            return (std::max<size_t>(size, 1) - 1) / Memory::kPoolAlignment;
+        }
+
+        void* PoolAllocate(size_t size)
+        {
+            const size_t cls = ClassOf(size);
+            FreeBlock*& head = t_freeLists[cls];
+
+            if (!head)
+            {
+                // Carve a fresh chunk into blocks of this class for the calling thread
+                auto* chunk = static_cast<std::byte*>(std::malloc(kChunkSize));
+                if (!chunk) return nullptr;
+                s_poolChunks.fetch_add(1, std::memory_order_relaxed);
+
+                const size_t blockSize = (cls + 1) * Memory::kPoolAlignment;
+                const size_t count = kChunkSize / blockSize;
+                for (size_t i = count; i-- > 0;)
+                {
+                    auto* block = reinterpret_cast<FreeBlock*>(chunk + i * blockSize);
+                    block->next = head;
+                    head = block;
+                }
+            }
+
+            FreeBlock* block = head;
+            head = block->next;
+            return block;
+        }
+
+        void PoolFree(void* ptr, size_t size)
+        {
+            FreeBlock*& head = t_freeLists[ClassOf(size)];
+            auto* block = static_cast<FreeBlock*>(ptr);
+            block->next = head;
+            head = block;
+        }
+
+        // ---------- heap ----------
+        void* HeapAllocate(size_t size, size_t alignment)
+        {
+            if (alignment <= alignof(std::max_align_t))
+                return std::malloc(std::max<size_t>(size, 1));
+            return ::operator new(size, std::align_val_t(alignment), std::nothrow);
+        }
+
+        void HeapFree(void* ptr, size_t alignment)
+        {
+            if (alignment <= alignof(std::max_align_t)) std::free(ptr);
+            else ::operator delete(ptr, std::align_val_t(alignment));
+        }
+
+        // ---------- frame arena ----------
+        struct Spill
+        {
+            void* ptr;
+            size_t alignment;
+        };
+
+        struct FrameArena
+        {
+            std::byte* base = nullptr;
+            size_t capacity = 0;
+            // Bytes reserved this frame, spills included, so EndFrame() knows what would have fit
+            std::atomic<size_t> offset{ 0 };
+
+            std::mutex spillMutex;
+            std::vector<Spill> spills;
+
+            size_t lastUsed = 0;
+            size_t peakUsed = 0;
+            uint64_t spillCount = 0;
+        };
+
+        FrameArena s_arena;
+
+        void ResizeArena(size_t capacity)
+        {
+            std::free(s_arena.base);
+            s_arena.base = capacity > 0 ? static_cast<std::byte*>(std::malloc(capacity)) : nullptr;
+            s_arena.capacity = s_arena.base ? capacity : 0;
+        }
+
+        size_t NextPowerOfTwo(size_t v)
+        {
+            size_t p = 64 * 1024;
+            while (p < v) p <<= 1;
+            return p;
+        }
+
+        double KiB(double bytes)
+        {
+            return bytes / 1024.0;
+        }
+    }
+
+    void Memory::InitFromConfig()
+    {
+        const auto& ini = Config::Get();
+
+        const long arena = ini.GetLongValue("Memory", "FrameArenaSize", 1 << 20);
+        ResizeArena(arena > 0 ? NextPowerOfTwo(static_cast<size_t>(arena)) : 0);
+
+        const long interval = ini.GetLongValue("Memory", "ReportInterval", 0);
+        s_reportInterval = interval > 0 ? static_cast<uint64_t>(interval) : 0;
+    }
+
+    void* Memory::Allocate(size_t size, MemoryTag tag, size_t alignment)
+    {
+        void* ptr = IsPooled(size, alignment) ? PoolAllocate(size) : HeapAllocate(size, alignment);
+        if (ptr) Charge(tag, size);
+        return ptr;
+    }
+
+    void Memory::Free(void* ptr, size_t size, MemoryTag tag, size_t alignment)
+    {
+        if (!ptr) return;
+
+        Release(tag, size);
+        if (IsPooled(size, alignment)) PoolFree(ptr, size);
+        else HeapFree(ptr, alignment);
+    }
+
+    void* Memory::Reallocate(void* ptr, size_t oldSize, size_t newSize, MemoryTag tag)
+    {
+        if (!ptr) return Allocate(newSize, tag);
+        if (newSize == 0)
+        {
+            Free(ptr, oldSize, tag);
+            return nullptr;
+        }
+
+        constexpr size_t alignment = alignof(std::max_align_t);
+        const bool wasPooled = IsPooled(oldSize, alignment);
+        const bool isPooled = IsPooled(newSize, alignment);
+
+        // Same block still fits, or both live on the heap where realloc can grow in place
+        void* result = nullptr;
+        if (wasPooled && isPooled && ClassOf(oldSize) == ClassOf(newSize))
+        {
+            result = ptr;
+        }
+        else if (!wasPooled && !isPooled)
+        {
+            result = std::realloc(ptr, newSize);
+            if (!result) return nullptr;
+        }
+        else
+        {
+            result = isPooled ? PoolAllocate(newSize) : HeapAllocate(newSize, alignment);
+            if (!result) return nullptr;
+
+            std::memcpy(result, ptr, std::min(oldSize, newSize));
+            if (wasPooled) PoolFree(ptr, oldSize);
+            else HeapFree(ptr, alignment);
+        }
+
+        Release(tag, oldSize);
+        Charge(tag, newSize);
+        return result;
+    }
+
+    void* Memory::FrameAllocate(size_t size, size_t alignment)
+    {
+        size = std::max<size_t>(size, 1);
+        const size_t reserve = size + alignment - 1;
+        const size_t start = s_arena.offset.fetch_add(reserve, std::memory_order_relaxed);
+
+        void* ptr = nullptr;
+        if (start + reserve <= s_arena.capacity)
+        {
+            const auto address = reinterpret_cast<uintptr_t>(s_arena.base + start);
+            ptr = reinterpret_cast<void*>((address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+        }
+        else
+        {
+            // Out of arena for this frame; the heap block is released with the arena
+            ptr = ::operator new(size, std::align_val_t(alignment), std::nothrow);
+            if (!ptr) return nullptr;
+
+            std::lock_guard<std::mutex> lock(s_arena.spillMutex);
+            s_arena.spills.push_back({ ptr, alignment });
+        }
+
+        Charge(MemoryTag::Frame, size);
+        return ptr;
+    }
+
+    void Memory::EndFrame()
+    {
+        // Release the arena, and grow it if this frame didn't fit
+        const size_t used = s_arena.offset.exchange(0, std::memory_order_relaxed);
+        s_arena.lastUsed = used;
+        s_arena.peakUsed = std::max(s_arena.peakUsed, used);
+
+        if (!s_arena.spills.empty())
+        {
+            for (const Spill& spill : s_arena.spills)
+                ::operator delete(spill.ptr, std::align_val_t(spill.alignment));
+            s_arena.spillCount += s_arena.spills.size();
+            s_arena.spills.clear();
+
+            ResizeArena(NextPowerOfTwo(used));
+        }
+        Counters(MemoryTag::Frame).live.store(0, std::memory_order_relaxed);
+
+        for (TagCounters& c : s_tags)
+        {
+            c.lastFrameBytes = c.frameBytes.exchange(0, std::memory_order_relaxed);
+            c.lastFrameAllocations = c.frameAllocations.exchange(0, std::memory_order_relaxed);
+            c.peakFrameBytes = std::max(c.peakFrameBytes, c.lastFrameBytes);
+            c.totalBytes += c.lastFrameBytes;
+            c.totalAllocations += c.lastFrameAllocations;
+            c.peakLive = std::max(c.peakLive, c.live.load(std::memory_order_relaxed));
+        }
+        // Frame memory is gone by now; its peak is the most handed out in one frame
+        TagCounters& frame = Counters(MemoryTag::Frame);
+        frame.peakLive = static_cast<int64_t>(frame.peakFrameBytes);
+
+        ++s_frames;
+        if (s_reportInterval > 0 && s_frames % s_reportInterval == 0)
+            Report(std::cout);
+    }
+
+    MemoryTagStats Memory::GetStats(MemoryTag tag)
+    {
+        const TagCounters& c = Counters(tag);
+
+        MemoryTagStats stats;
+        stats.liveBytes = c.live.load(std::memory_order_relaxed);
+        stats.peakLiveBytes = std::max(c.peakLive, stats.liveBytes);
+        stats.frameBytes = c.lastFrameBytes;
+        stats.frameAllocations = c.lastFrameAllocations;
+        stats.peakFrameBytes = c.peakFrameBytes;
+        stats.totalBytes = c.totalBytes;
+        stats.totalAllocations = c.totalAllocations;
+        return stats;
+    }
+
+    const char* Memory::GetTagName(MemoryTag tag)
+    {
+        const auto index = static_cast<size_t>(tag);
+        return index < kMemoryTagCount ? kTagNames[index] : "Unknown";
+    }
+
+    void Memory::Report(std::ostream& out)
+    {
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(1);
+
+        const double frames = static_cast<double>(std::max<uint64_t>(s_frames, 1));
+        out << "[ZED::Memory] " << s_frames << " frame(s), KiB per tag\n";
+        out << "    " << std::left << std::setw(10) << "tag" << std::right
+            << std::setw(12) << "live" << std::setw(12) << "peak"
+            << std::setw(14) << "last frame" << std::setw(10) << "allocs"
+            << std::setw(14) << "avg/frame" << std::setw(10) << "allocs"
+            << std::setw(14) << "max/frame" << "\n";
+
+        for (size_t i = 0; i < kMemoryTagCount; ++i)
+        {
+            const MemoryTagStats s = GetStats(static_cast<MemoryTag>(i));
+            if (s.peakLiveBytes == 0 && s.totalBytes == 0 && s.frameBytes == 0) continue;
+
+            out << "    " << std::left << std::setw(10) << kTagNames[i] << std::right
+                << std::setw(12) << KiB(static_cast<double>(s.liveBytes))
+                << std::setw(12) << KiB(static_cast<double>(s.peakLiveBytes))
+                << std::setw(14) << KiB(static_cast<double>(s.frameBytes))
+                << std::setw(10) << s.frameAllocations
+                << std::setw(14) << KiB(static_cast<double>(s.totalBytes) / frames)
+                << std::setw(10) << static_cast<double>(s.totalAllocations) / frames
+                << std::setw(14) << KiB(static_cast<double>(s.peakFrameBytes)) << "\n";
+        }
+
+        out << "    frame arena: " << KiB(static_cast<double>(s_arena.lastUsed)) << " KiB last frame, "
+            << KiB(static_cast<double>(s_arena.peakUsed)) << " KiB peak of "
+            << KiB(static_cast<double>(s_arena.capacity)) << " KiB, " << s_arena.spillCount << " spilled allocation(s)\n";
+        out << "    pools: " << s_poolChunks.load(std::memory_order_relaxed) << " chunk(s), "
+            << KiB(static_cast<double>(s_poolChunks.load(std::memory_order_relaxed) * kChunkSize)) << " KiB reserved\n";
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
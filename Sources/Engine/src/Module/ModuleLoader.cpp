@@ -8,8 +8,60 @@
 #include <iostream>
 #include <SimpleIni.h>
 
+#if defined(_WIN32)
+    #include <Windows.h>
+#else
+    #include <dlfcn.h>
+#endif
+
 namespace ZED::Module
 {
+    namespace
+    {
+        ModuleLoader::Handle OpenLibrary(const std::string& path)
+        {
+        #if defined(_WIN32)
+            return reinterpret_cast<ModuleLoader::Handle>(LoadLibraryA(path.c_str()));
+        #else
+            // RTLD_LOCAL: modules export the same entry point names (CreateRenderer, RegisterTime...)
+            void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+            // A bare file name only searches the library path; LoadLibrary would also look next to the exe
+            if (!handle && path.find('/') == std::string::npos)
+                handle = dlopen(("./" + path).c_str(), RTLD_NOW | RTLD_LOCAL);
+            return handle;
+        #endif
+        }
+
+        void* FindSymbol(ModuleLoader::Handle handle, const char* name)
+        {
+        #if defined(_WIN32)
+            return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle), name));
+        #else
+            return dlsym(handle, name);
+        #endif
+        }
+
+        void CloseLibrary(ModuleLoader::Handle handle)
+        {
+        #if defined(_WIN32)
+            FreeLibrary(static_cast<HMODULE>(handle));
+        #else
+            dlclose(handle);
+        #endif
+        }
+
+        const char* LastError()
+        {
+        #if defined(_WIN32)
+            return "LoadLibrary failed";
+        #else
+            const char* err = dlerror();
+            return err ? err : "dlopen failed";
+        #endif
+        }
+    }
+
     void ModuleLoader::LoadModulesFromINI(const std::string& section)
     {
         const auto& ini = Config::Get();
@@ -20,40 +72,55 @@ namespace ZED::Module
         for (const auto& key : keys)
         {
             std::string moduleName = key.pItem;
-            std::string dllPath = ini.GetValue(section.c_str(), moduleName.c_str(), "");
+            std::string libPath = ini.GetValue(section.c_str(), moduleName.c_str(), "");
 
-            if (dllPath.empty())
+            if (libPath.empty())
                 continue;
 
-            HMODULE handle = LoadLibraryA(dllPath.c_str());
-            if (!handle)
-            {
-                std::cerr << "[ZED::ModuleLoader] Failed to load module: " << dllPath << "\n";
-                continue;
-            }
+            // Both loaders refcount, so a library listed under several keys is opened (and freed) once per key
+            LoadModule(moduleName, libPath);
+        }
+    }
 
-            std::cout << "[ZED::ModuleLoader] Loaded module [" << moduleName << "]: " << dllPath << "\n";
-            s_modules[moduleName] = handle;
+    bool ModuleLoader::LoadModule(const std::string& moduleName, const std::string& libPath)
+    {
+        Handle handle = OpenLibrary(libPath);
+        if (!handle)
+        {
+            std::cerr << "[ZED::ModuleLoader] Failed to load module: " << libPath << " (" << LastError() << ")\n";
+            return false;
         }
+
+        auto it = s_modules.find(moduleName);
+        if (it != s_modules.end() && it->second)
+            CloseLibrary(it->second);
+
+        std::cout << "[ZED::ModuleLoader] Loaded module [" << moduleName << "]: " << libPath << "\n";
+        if (it == s_modules.end())
+            s_loadOrder.push_back(moduleName);
+        s_modules[moduleName] = handle;
+        return true;
     }
 
-    FARPROC ModuleLoader::GetFunction(const std::string& moduleName, const std::string& functionName)
+    void* ModuleLoader::GetFunction(const std::string& moduleName, const std::string& functionName)
     {
         auto it = s_modules.find(moduleName);
         if (it == s_modules.end()) return nullptr;
-        return GetProcAddress(it->second, functionName.c_str());
+        return FindSymbol(it->second, functionName.c_str());
     }
 
     void ModuleLoader::Cleanup()
     {
-        for (auto& [name, handle] : s_modules)
+        for (auto name = s_loadOrder.rbegin(); name != s_loadOrder.rend(); ++name)
         {
+            Handle handle = s_modules[*name];
             if (handle)
             {
-                FreeLibrary(handle);
-                std::cout << "[ZED::ModuleLoader] Unloaded module: " << name << "\n";
+                CloseLibrary(handle);
+                std::cout << "[ZED::ModuleLoader] Unloaded module: " << *name << "\n";
             }
         }
         s_modules.clear();
+        s_loadOrder.clear();
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,20 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Physics/Physics.h"
+
+namespace ZED
+{
+    IPhysics* Physics::s_Impl = nullptr;
+
+    void Physics::SetImplementation(IPhysics* impl)
+    {
+        s_Impl = impl;
+    }
+
+    IPhysics* Physics::Get()
+    {
+        return s_Impl;
+    }
+}
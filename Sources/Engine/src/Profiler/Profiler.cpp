@@ -0,0 +1,229 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Profiler/Profiler.h"
+#include "Engine/Config/Config.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ZED
+{
+    std::atomic<bool> Profiler::s_capturing{ false };
+
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        struct ZoneEvent
+        {
+            const char* name;
+            uint64_t start;
+            uint64_t end;
+        };
+
+        // Written only by its owning thread; head is published with release so the exporter
+        // sees every event below it
+        struct ThreadBuffer
+        {
+            std::unique_ptr<ZoneEvent[]> events;
+            uint64_t mask = 0;
+            std::atomic<uint64_t> head{ 0 };
+            std::string name;
+            uint32_t id = 0;
+        };
+
+        std::mutex s_buffersMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+        thread_local ThreadBuffer* t_buffer = nullptr;
+        thread_local std::string t_threadName;
+
+        uint64_t s_eventsPerThread = 1u << 16;
+
+        // Capture window, in raw ticks and in steady_clock time to convert between the two
+        uint64_t s_beginTicks = 0;
+        uint64_t s_endTicks = 0;
+        Clock::time_point s_beginTime{};
+        Clock::time_point s_endTime{};
+
+        // Automatic capture driven by NewFrame()
+        uint64_t s_frame = 0;
+        uint64_t s_captureFirstFrame = 0;
+        uint64_t s_captureFrames = 0;
+        std::string s_traceFile = "zed_trace.json";
+
+        ThreadBuffer* RegisterThread()
+        {
+            auto buffer = std::make_unique<ThreadBuffer>();
+
+            std::lock_guard<std::mutex> lock(s_buffersMutex);
+            buffer->events = std::make_unique<ZoneEvent[]>(s_eventsPerThread);
+            buffer->mask = s_eventsPerThread - 1;
+            buffer->name = t_threadName;
+            buffer->id = static_cast<uint32_t>(s_buffers.size());
+            s_buffers.push_back(std::move(buffer));
+
+            t_buffer = s_buffers.back().get();
+            return t_buffer;
+        }
+
+        void WriteEscaped(std::ostream& out, const char* s)
+        {
+            for (; *s; ++s)
+            {
+                if (*s == '"' || *s == '\\') out << '\\';
+                out << *s;
+            }
+        }
+    }
+
+    void Profiler::InitFromConfig()
+    {
+        const auto& ini = Config::Get();
+
+        const long frames = ini.GetLongValue("Profiler", "CaptureFrames", 0);
+        const long first = ini.GetLongValue("Profiler", "CaptureFirstFrame", 0);
+        s_captureFrames = frames > 0 ? static_cast<uint64_t>(frames) : 0;
+        s_captureFirstFrame = first > 0 ? static_cast<uint64_t>(first) : 0;
+        s_traceFile = ini.GetValue("Profiler", "TraceFile", "zed_trace.json");
+
+        // Power of two so the ring index is a mask. Only affects threads that haven't recorded yet.
+        const long events = ini.GetLongValue("Profiler", "EventsPerThread", 1 << 16);
+        uint64_t capacity = 1024;
+        while (capacity < static_cast<uint64_t>(std::max(events, 1L))) capacity <<= 1;
+
+        std::lock_guard<std::mutex> lock(s_buffersMutex);
+        s_eventsPerThread = capacity;
+    }
+
+    void Profiler::NewFrame()
+    {
+        const uint64_t frame = s_frame++;
+        if (s_captureFrames == 0) return;
+
+        if (frame == s_captureFirstFrame)
+        {
+            BeginCapture();
+        }
+        else if (frame == s_captureFirstFrame + s_captureFrames && IsCapturing())
+        {
+            EndCapture();
+            WriteChromeTrace(s_traceFile);
+        }
+    }
+
+    void Profiler::Shutdown()
+    {
+        if (!IsCapturing()) return;
+
+        EndCapture();
+        WriteChromeTrace(s_traceFile);
+    }
+
+    void Profiler::BeginCapture()
+    {
+        if (IsCapturing()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(s_buffersMutex);
+            for (auto& buffer : s_buffers)
+                buffer->head.store(0, std::memory_order_relaxed);
+        }
+
+        s_beginTime = Clock::now();
+        s_beginTicks = Now();
+        s_capturing.store(true, std::memory_order_release);
+    }
+
+    void Profiler::EndCapture()
+    {
+        if (!IsCapturing()) return;
+
+        s_capturing.store(false, std::memory_order_release);
+        s_endTicks = Now();
+        s_endTime = Clock::now();
+    }
+
+    bool Profiler::WriteChromeTrace(const std::string& path)
+    {
+        std::ofstream out(path, std::ios::binary);
+        if (!out)
+        {
+            std::cerr << "[ZED::Profiler] Can't open " << path << " for writing\n";
+            return false;
+        }
+
+        // Both clocks were read back to back at each end of the capture
+        const double captureUs = std::chrono::duration<double, std::micro>(s_endTime - s_beginTime).count();
+        const double ticks = static_cast<double>(s_endTicks - s_beginTicks);
+        const double usPerTick = ticks > 0.0 ? captureUs / ticks : 0.0;
+
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"ZEDEngine\"}}";
+
+        size_t zones = 0;
+        uint64_t overwritten = 0;
+
+        std::lock_guard<std::mutex> lock(s_buffersMutex);
+        for (const auto& buffer : s_buffers)
+        {
+            const uint64_t head = buffer->head.load(std::memory_order_acquire);
+            if (head == 0) continue;
+
+            const uint64_t capacity = buffer->mask + 1;
+            const uint64_t count = std::min(head, capacity);
+            overwritten += head - count;
+
+            out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id << ",\"args\":{\"name\":\"";
+            if (!buffer->name.empty()) WriteEscaped(out, buffer->name.c_str());
+            else out << "Thread " << buffer->id;
+            out << "\"}}";
+
+            for (uint64_t i = head - count; i < head; ++i)
+            {
+                const ZoneEvent& e = buffer->events[i & buffer->mask];
+                const double ts = static_cast<double>(static_cast<int64_t>(e.start - s_beginTicks)) * usPerTick;
+                const double dur = static_cast<double>(e.end - e.start) * usPerTick;
+
+                out << ",\n{\"name\":\"";
+                WriteEscaped(out, e.name);
+                out << "\",\"cat\":\"zed\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id
+                    << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+            }
+            zones += count;
+        }
+        out << "\n]}\n";
+
+        std::cout << "[ZED::Profiler] Wrote " << zones << " zones over " << captureUs / 1000.0 << " ms to " << path;
+        if (overwritten > 0) std::cout << " (" << overwritten << " older zones overwritten; raise [Profiler] EventsPerThread)";
+        std::cout << "\n";
+        return true;
+    }
+
+    void Profiler::SetThreadName(const char* name)
+    {
+        t_threadName = name;
+        if (t_buffer)
+        {
+            std::lock_guard<std::mutex> lock(s_buffersMutex);
+            t_buffer->name = name;
+        }
+    }
+
+    void Profiler::Record(const char* name, uint64_t start, uint64_t end)
+    {
+        if (!IsCapturing()) return;
+
+        ThreadBuffer* buffer = t_buffer ? t_buffer : RegisterThread();
+        const uint64_t head = buffer->head.load(std::memory_order_relaxed);
+        buffer->events[head & buffer->mask] = ZoneEvent{ name, start, end };
+        buffer->head.store(head + 1, std::memory_order_release);
+    }
+}
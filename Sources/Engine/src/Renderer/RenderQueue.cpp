@@ -0,0 +1,179 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Renderer/RenderQueue.h"
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace ZED
+{
+    namespace
+    {
+        struct State
+        {
+            // One list per job system thread; unique_ptr keeps each list's vector header off its neighbours' cache lines
+            std::vector<std::unique_ptr<RenderCommandList>> lists;
+
+            std::vector<RenderQueue::SortEntry> entries;
+            std::vector<RenderQueue::SortEntry> scratch;
+            std::vector<Mat4> models;
+            std::vector<RenderBatch> batches;
+
+            RenderQueueStats stats;
+        };
+
+        State s_State;
+
+        // Below this many draws a comparison sort beats eight histogram passes
+        constexpr size_t kRadixThreshold = 256;
+    }
+
+    void RenderQueue::Begin()
+    {
+        const size_t threads = JobSystem::GetThreadCount();
+        while (s_State.lists.size() < threads)
+            s_State.lists.push_back(std::make_unique<RenderCommandList>());
+
+        for (auto& list : s_State.lists)
+            list->Clear();
+    }
+
+    RenderCommandList& RenderQueue::GetList()
+    {
+        const uint32_t index = JobSystem::GetWorkerIndex();
+        return *s_State.lists[index < s_State.lists.size() ? index : 0];
+    }
+
+    uint32_t RenderQueue::SortEntries(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch)
+    {
+        const size_t count = entries.size();
+        if (count < 2) return 0;
+
+        if (count < kRadixThreshold)
+        {
+            std::stable_sort(entries.begin(), entries.end(), [](const SortEntry& a, const SortEntry& b)
+            {
+                return a.key < b.key;
+            });
+            return 0;
+        }
+
+        // All eight byte histograms in one read of the keys
+        std::array<std::array<uint32_t, 256>, 8> histograms{};
+        for (const SortEntry& e : entries)
+        {
+            for (int byte = 0; byte < 8; ++byte)
+                ++histograms[byte][(e.key >> (byte * 8)) & 0xFF];
+        }
+
+        scratch.resize(count);
+        SortEntry* src = entries.data();
+        SortEntry* dst = scratch.data();
+        uint32_t passes = 0;
+
+        for (int byte = 0; byte < 8; ++byte)
+        {
+            auto& histogram = histograms[byte];
+
+            // Every key has the same value in this byte (unused material bits, single pass): nothing to reorder
+            const uint32_t firstDigit = static_cast<uint32_t>((src[0].key >> (byte * 8)) & 0xFF);
+            if (histogram[firstDigit] == count)
+                continue;
+
+            uint32_t offset = 0;
+            for (uint32_t& bucket : histogram)
+            {
+                const uint32_t n = bucket;
+                bucket = offset;
+                offset += n;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint32_t digit = static_cast<uint32_t>((src[i].key >> (byte * 8)) & 0xFF);
+                dst[histogram[digit]++] = src[i];
+            }
+
+            std::swap(src, dst);
+            ++passes;
+        }
+
+        // Odd number of passes leaves the result in scratch
+        if (src != entries.data())
+            entries.swap(scratch);
+
+        return passes;
+    }
+
+    void RenderQueue::Flush(IRenderer& renderer)
+    {
+        ZED_PROFILE_SCOPE("RenderQueue::Flush");
+        RenderQueueStats stats{};
+
+        size_t total = 0;
+        for (const auto& list : s_State.lists)
+        {
+            total += list->Size();
+            if (list->Size() > 0) ++stats.lists;
+        }
+
+        // Merge: keys plus where to find the packet, so the 64-byte matrices move only once
+        auto& entries = s_State.entries;
+        entries.clear();
+        entries.reserve(total);
+        for (uint32_t l = 0; l < s_State.lists.size(); ++l)
+        {
+            const auto& packets = s_State.lists[l]->GetPackets();
+            for (uint32_t i = 0; i < packets.size(); ++i)
+                entries.push_back({ packets[i].key, l, i });
+        }
+
+        stats.sortPasses = SortEntries(entries, s_State.scratch);
+
+        // Gather models into draw order; each job writes a disjoint range
+        auto& models = s_State.models;
+        models.resize(total);
+        JobSystem::ParallelFor(total, 4096, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const SortEntry& e = entries[i];
+                models[i] = s_State.lists[e.list]->GetPackets()[e.index].model;
+            }
+        });
+
+        // Split into runs of identical pass + material
+        auto& batches = s_State.batches;
+        batches.clear();
+        size_t runStart = 0;
+        for (size_t i = 1; i <= total; ++i)
+        {
+            if (i == total || RenderKey::GetStateBits(entries[i].key) != RenderKey::GetStateBits(entries[runStart].key))
+            {
+                batches.push_back({ RenderKey::GetStateBits(entries[runStart].key),
+                                    std::span<const Mat4>(models.data() + runStart, i - runStart) });
+                runStart = i;
+            }
+        }
+
+        stats.packets = static_cast<uint32_t>(total);
+        stats.batches = static_cast<uint32_t>(batches.size());
+        s_State.stats = stats;
+
+        if (!batches.empty())
+            renderer.SubmitBatches(batches);
+
+        for (auto& list : s_State.lists)
+            list->Clear();
+    }
+
+    const RenderQueueStats& RenderQueue::GetLastStats()
+    {
+        return s_State.stats;
+    }
+}
@@ -0,0 +1,707 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Scene/Scene.h"
+#include "Engine/IO/MappedFile.h"
+#include "Engine/Interfaces/Scripting/IScripting.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/ECS/Components/TransformComponent.h"
+#include "Engine/ECS/Components/HierarchyComponent.h"
+#include "Engine/ECS/Components/BoundsComponent.h"
+#include "Engine/ECS/Components/CameraComponent.h"
+#include "Engine/ECS/Components/ColliderComponent.h"
+#include "Engine/ECS/Components/RigidBodyComponent.h"
+#include "Engine/ECS/Components/PreviousTransformComponent.h"
+#include "Engine/ECS/Components/ScriptComponent.h"
+#include "Engine/ECS/Systems/HierarchySystem.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace ZED
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        double ElapsedMs(Clock::time_point start)
+        {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        // ---------- file layout ----------
+        // [FileHeader][StringEntry...][PoolEntry...][ColumnEntry... per pool][string bytes][pool blocks]
+        // Every table and every array starts on a kAlignment boundary.
+        constexpr std::array<char, 4> kMagic{ 'Z', 'S', 'C', 'N' };
+        constexpr uint64_t kAlignment = 16;
+        constexpr uint32_t kNullIndex = 0xFFFFFFFFu;
+
+        struct FileHeader
+        {
+            std::array<char, 4> magic;
+            uint32_t version;
+            uint32_t entityCount;
+            uint32_t poolCount;
+            uint32_t stringCount;
+            uint32_t reserved;
+            uint64_t stringTableOffset;
+            uint64_t poolTableOffset;
+            uint64_t fileSize;
+        };
+
+        struct StringEntry
+        {
+            uint64_t offset;
+            uint32_t length;
+            uint32_t reserved;
+        };
+
+        struct PoolEntry
+        {
+            std::array<char, 24> name;
+            uint32_t version;    // layout of this pool's columns
+            uint32_t count;
+            uint32_t columnCount;
+            uint32_t reserved;
+            uint64_t entityOffset; // uint32 scene index per element
+            uint64_t columnTableOffset;
+        };
+
+        struct ColumnEntry
+        {
+            uint64_t offset;
+            uint32_t elementSize;
+            uint32_t reserved;
+        };
+
+        static_assert(sizeof(FileHeader) == 48 && sizeof(StringEntry) == 16 && sizeof(PoolEntry) == 56 && sizeof(ColumnEntry) == 16);
+
+        uint64_t Align(uint64_t v)
+        {
+            return (v + kAlignment - 1) & ~(kAlignment - 1);
+        }
+
+        // ---------- contexts ----------
+        struct SaveContext
+        {
+            const Registry* reg = nullptr;
+            IScripting* scripting = nullptr;
+            std::vector<uint32_t> indexOf;            // scene index by entity id
+            std::vector<std::string> strings;         // script paths
+            std::unordered_map<uint64_t, uint32_t> scriptIndex;
+            size_t unnamedScripts = 0;
+
+            uint32_t EntityIndex(entt::entity e) const
+            {
+                if (e == entt::null || !reg->valid(e)) return kNullIndex;
+                return indexOf[entt::to_entity(e)];
+            }
+
+            uint32_t ScriptIndex(uint64_t script)
+            {
+                if (script == 0) return kNullIndex;
+
+                const auto it = scriptIndex.find(script);
+                if (it != scriptIndex.end()) return it->second;
+
+                std::string path = scripting ? scripting->GetScriptPath(ScriptId{ script }) : std::string();
+                uint32_t index = kNullIndex;
+                if (path.empty())
+                {
+                    ++unnamedScripts;
+                }
+                else
+                {
+                    index = static_cast<uint32_t>(strings.size());
+                    strings.push_back(std::move(path));
+                }
+                scriptIndex.emplace(script, index);
+                return index;
+            }
+        };
+
+        struct LoadContext
+        {
+            const entt::entity* entities = nullptr;
+            uint32_t entityCount = 0;
+            std::vector<uint64_t> scripts; // ScriptId by string index, 0 when unresolved
+
+            entt::entity Entity(uint32_t index) const
+            {
+                return index < entityCount ? entities[index] : entt::entity{ entt::null };
+            }
+
+            uint64_t Script(uint32_t index) const
+            {
+                return index < scripts.size() ? scripts[index] : 0;
+            }
+        };
+
+        // ---------- fields ----------
+        // A field maps one component member to one column. Stored is the column element type.
+
+        template <auto Member> struct Field;
+        template <typename T, typename F, F T::*Member>
+        struct Field<Member>
+        {
+            using Stored = F;
+            static Stored Encode(const T& c, SaveContext&) { return c.*Member; }
+            static void Decode(T& c, const Stored& v, const LoadContext&) { c.*Member = v; }
+        };
+
+        // Entity reference, stored as a scene index
+        template <auto Member> struct EntityField;
+        template <typename T, entt::entity T::*Member>
+        struct EntityField<Member>
+        {
+            using Stored = uint32_t;
+            static Stored Encode(const T& c, SaveContext& ctx) { return ctx.EntityIndex(c.*Member); }
+            static void Decode(T& c, const Stored& v, const LoadContext& ctx) { c.*Member = ctx.Entity(v); }
+        };
+
+        // ScriptId value, stored as an index into the script path table
+        template <auto Member> struct ScriptField;
+        template <typename T, uint64_t T::*Member>
+        struct ScriptField<Member>
+        {
+            using Stored = uint32_t;
+            static Stored Encode(const T& c, SaveContext& ctx) { return ctx.ScriptIndex(c.*Member); }
+            static void Decode(T& c, const Stored& v, const LoadContext& ctx) { c.*Member = ctx.Script(v); }
+        };
+
+        // ---------- load iterators ----------
+        // Both read the mapping directly; memcpy keeps unaligned or aliased reads well defined
+        // and compiles to plain loads.
+        class EntityIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = entt::entity;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = entt::entity;
+
+            EntityIterator() = default;
+            EntityIterator(const std::byte* indices, const LoadContext* ctx, size_t pos)
+                : m_Indices(indices), m_Ctx(ctx), m_Pos(pos)
+            {
+            }
+
+            entt::entity operator*() const
+            {
+                uint32_t index;
+                std::memcpy(&index, m_Indices + m_Pos * sizeof(index), sizeof(index));
+                return m_Ctx->entities[index];
+            }
+
+            EntityIterator& operator++() { ++m_Pos; return *this; }
+            EntityIterator operator++(int) { EntityIterator it = *this; ++m_Pos; return it; }
+            bool operator==(const EntityIterator& other) const { return m_Pos == other.m_Pos; }
+
+        private:
+            const std::byte* m_Indices = nullptr;
+            const LoadContext* m_Ctx = nullptr;
+            size_t m_Pos = 0;
+        };
+
+        // Gathers one component per step from its field columns
+        template <typename T, typename... Fields>
+        class ColumnIterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = T;
+
+            ColumnIterator(const std::byte* const* columns, const LoadContext* ctx)
+                : m_Columns(columns), m_Ctx(ctx)
+            {
+            }
+
+            T operator*() const
+            {
+                T c{};
+                Decode(c, std::index_sequence_for<Fields...>{});
+                return c;
+            }
+
+            ColumnIterator& operator++() { ++m_Pos; return *this; }
+            ColumnIterator operator++(int) { ColumnIterator it = *this; ++m_Pos; return it; }
+            bool operator==(const ColumnIterator& other) const { return m_Pos == other.m_Pos; }
+
+        private:
+            template <size_t... I>
+            void Decode(T& c, std::index_sequence<I...>) const
+            {
+                (DecodeField<Fields>(c, m_Columns[I]), ...);
+            }
+
+            template <typename F>
+            void DecodeField(T& c, const std::byte* column) const
+            {
+                typename F::Stored v;
+                std::memcpy(&v, column + m_Pos * sizeof(v), sizeof(v));
+                F::Decode(c, v, *m_Ctx);
+            }
+
+            const std::byte* const* m_Columns;
+            const LoadContext* m_Ctx;
+            size_t m_Pos = 0;
+        };
+
+        // ---------- pools ----------
+        struct PoolData
+        {
+            uint32_t count = 0;
+            std::vector<uint32_t> entities;
+            std::vector<std::vector<std::byte>> columns;
+        };
+
+        struct PoolView
+        {
+            uint32_t count = 0;
+            const std::byte* entities = nullptr;
+            std::vector<const std::byte*> columns;
+        };
+
+        template <typename T, typename... Fields>
+        struct Pool
+        {
+            static_assert((std::is_trivially_copyable_v<typename Fields::Stored> && ...), "Columns must be trivially copyable");
+
+            static constexpr std::array<uint32_t, sizeof...(Fields)> kColumnSizes{ static_cast<uint32_t>(sizeof(typename Fields::Stored))... };
+
+            // Packed order, so a load reproduces the storage order (hierarchy depth order in particular)
+            static void Save(const Registry& reg, SaveContext& ctx, PoolData& out)
+            {
+                const auto* storage = reg.storage<T>();
+                if (!storage || storage->empty()) return;
+
+                const size_t count = storage->size();
+                out.count = static_cast<uint32_t>(count);
+                out.entities.resize(count);
+                out.columns.resize(sizeof...(Fields));
+                for (size_t k = 0; k < sizeof...(Fields); ++k)
+                    out.columns[k].resize(count * kColumnSizes[k]);
+
+                const entt::entity* packed = storage->data();
+                for (size_t i = 0; i < count; ++i)
+                {
+                    out.entities[i] = ctx.EntityIndex(packed[i]);
+                    if constexpr (sizeof...(Fields) > 0)
+                    {
+                        const T& c = storage->get(packed[i]);
+                        size_t k = 0;
+                        (EncodeField<Fields>(c, ctx, out.columns[k++], i), ...);
+                    }
+                }
+            }
+
+            static void Load(Registry& reg, const PoolView& pool, const LoadContext& ctx)
+            {
+                auto& storage = reg.storage<T>();
+                storage.reserve(storage.size() + pool.count);
+
+                const EntityIterator first(pool.entities, &ctx, 0);
+                const EntityIterator last(pool.entities, &ctx, pool.count);
+                if constexpr (sizeof...(Fields) == 0)
+                    reg.insert<T>(first, last);
+                else
+                    reg.insert<T>(first, last, ColumnIterator<T, Fields...>(pool.columns.data(), &ctx));
+            }
+
+        private:
+            template <typename F>
+            static void EncodeField(const T& c, SaveContext& ctx, std::vector<std::byte>& column, size_t i)
+            {
+                const typename F::Stored v = F::Encode(c, ctx);
+                std::memcpy(column.data() + i * sizeof(v), &v, sizeof(v));
+            }
+        };
+
+        struct PoolCodec
+        {
+            const char* name;
+            uint32_t version;
+            const uint32_t* columnSizes;
+            uint32_t columnCount;
+            void (*save)(const Registry&, SaveContext&, PoolData&);
+            void (*load)(Registry&, const PoolView&, const LoadContext&);
+            void (*afterLoad)(Registry&);
+            bool needsScripting;
+        };
+
+        template <typename P>
+        constexpr PoolCodec MakeCodec(const char* name, uint32_t version, void (*afterLoad)(Registry&) = nullptr,
+                                      bool needsScripting = false)
+        {
+            return PoolCodec{ name, version, P::kColumnSizes.data(), static_cast<uint32_t>(P::kColumnSizes.size()),
+                              &P::Save, &P::Load, afterLoad, needsScripting };
+        }
+
+        using TransformPool = Pool<TransformComponent,
+            Field<&TransformComponent::position>, Field<&TransformComponent::rotation>, Field<&TransformComponent::scale>>;
+
+        using HierarchyPool = Pool<HierarchyComponent,
+            EntityField<&HierarchyComponent::parent>, EntityField<&HierarchyComponent::firstChild>,
+            EntityField<&HierarchyComponent::prevSibling>, EntityField<&HierarchyComponent::nextSibling>,
+            Field<&HierarchyComponent::childCount>, Field<&HierarchyComponent::depth>>;
+
+        using BoundsPool = Pool<BoundsComponent,
+            Field<&BoundsComponent::center>, Field<&BoundsComponent::radius>>;
+
+        using CameraPool = Pool<CameraComponent,
+            Field<&CameraComponent::fovRadians>, Field<&CameraComponent::znear>, Field<&CameraComponent::zfar>,
+            Field<&CameraComponent::projection>, Field<&CameraComponent::aspect>,
+            Field<&CameraComponent::primary>, Field<&CameraComponent::editorMode>>;
+
+        using ColliderPool = Pool<ColliderComponent,
+            Field<&ColliderComponent::shape>, Field<&ColliderComponent::halfExtents>,
+            Field<&ColliderComponent::radius>, Field<&ColliderComponent::halfHeight>>;
+
+        // The backend body handle is runtime state; PhysicsSystem creates a new body
+        using RigidBodyPool = Pool<RigidBodyComponent,
+            Field<&RigidBodyComponent::motion>, Field<&RigidBodyComponent::mass>,
+            Field<&RigidBodyComponent::friction>, Field<&RigidBodyComponent::restitution>,
+            Field<&RigidBodyComponent::linearDamping>, Field<&RigidBodyComponent::angularDamping>,
+            Field<&RigidBodyComponent::allowSleep>,
+            Field<&RigidBodyComponent::linearVelocity>, Field<&RigidBodyComponent::angularVelocity>>;
+
+        // Membership only; InterpolationSystem seeds it from the transform on construction
+        using PreviousTransformPool = Pool<PreviousTransformComponent>;
+
+        using ScriptPool = Pool<ScriptComponent,
+            ScriptField<&ScriptComponent::script>, Field<&ScriptComponent::enabled>>;
+
+        // Load order: transforms before anything whose construction reads them, scripts last
+        // so OnStart sees a complete entity. Bump a pool's version when its columns change.
+        constexpr std::array<PoolCodec, 8> kPools{
+            MakeCodec<TransformPool>("Transform", 1),
+            MakeCodec<HierarchyPool>("Hierarchy", 1, &HierarchySystem::SortByDepth),
+            MakeCodec<BoundsPool>("Bounds", 1),
+            MakeCodec<CameraPool>("Camera", 1),
+            MakeCodec<ColliderPool>("Collider", 1),
+            MakeCodec<RigidBodyPool>("RigidBody", 1),
+            MakeCodec<PreviousTransformPool>("PreviousTransform", 1),
+            MakeCodec<ScriptPool>("Script", 1, nullptr, true),
+        };
+
+        // ---------- reading ----------
+        bool InRange(size_t fileSize, uint64_t offset, uint64_t bytes)
+        {
+            return offset <= fileSize && bytes <= fileSize - offset;
+        }
+
+        template <typename T>
+        T ReadAt(const std::byte* data, uint64_t offset)
+        {
+            T v;
+            std::memcpy(&v, data + offset, sizeof(T));
+            return v;
+        }
+
+        std::string PoolName(const PoolEntry& entry)
+        {
+            const auto end = std::find(entry.name.begin(), entry.name.end(), '\0');
+            return std::string(entry.name.begin(), end);
+        }
+
+        // ---------- writing ----------
+        class Writer
+        {
+        public:
+            explicit Writer(std::ofstream& out) : m_Out(out) {}
+
+            void Write(const void* data, size_t size)
+            {
+                m_Out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+                m_Pos += size;
+            }
+
+            void PadTo(uint64_t offset)
+            {
+                static constexpr std::array<char, kAlignment> zeros{};
+                while (m_Pos < offset)
+                    Write(zeros.data(), static_cast<size_t>(std::min<uint64_t>(offset - m_Pos, zeros.size())));
+            }
+
+            uint64_t Position() const { return m_Pos; }
+
+        private:
+            std::ofstream& m_Out;
+            uint64_t m_Pos = 0;
+        };
+    }
+
+    bool Scene::Save(const Registry& reg, const std::string& path)
+    {
+        const auto start = Clock::now();
+
+        SaveContext ctx;
+        ctx.reg = &reg;
+        const auto* scripts = reg.storage<ScriptComponent>();
+        if (scripts && !scripts->empty()) ctx.scripting = Scripting::Get();
+
+        // Scene indices follow the registry's live entities
+        const auto* entityStorage = reg.storage<entt::entity>();
+        const size_t entityCount = entityStorage ? entityStorage->free_list() : 0;
+        for (size_t i = 0; i < entityCount; ++i)
+        {
+            const auto id = static_cast<size_t>(entt::to_entity(entityStorage->data()[i]));
+            if (ctx.indexOf.size() <= id) ctx.indexOf.resize(id + 1, kNullIndex);
+            ctx.indexOf[id] = static_cast<uint32_t>(i);
+        }
+
+        std::vector<PoolData> pools(kPools.size());
+        for (size_t p = 0; p < kPools.size(); ++p)
+            kPools[p].save(reg, ctx, pools[p]);
+
+        if (ctx.unnamedScripts > 0)
+        {
+            std::cerr << "[ZED::Scene] " << ctx.unnamedScripts
+                      << " script(s) have no path in the active scripting module; their components load without a script\n";
+        }
+
+        // Lay out the file
+        FileHeader header{};
+        header.magic = kMagic;
+        header.version = kVersion;
+        header.entityCount = static_cast<uint32_t>(entityCount);
+        header.stringCount = static_cast<uint32_t>(ctx.strings.size());
+
+        uint64_t offset = Align(sizeof(FileHeader));
+        header.stringTableOffset = offset;
+        offset = Align(offset + ctx.strings.size() * sizeof(StringEntry));
+
+        std::vector<PoolEntry> entries;
+        std::vector<std::vector<ColumnEntry>> columns;
+        std::vector<const PoolData*> saved;
+        for (size_t p = 0; p < kPools.size(); ++p)
+        {
+            if (pools[p].count == 0) continue;
+
+            PoolEntry entry{};
+            std::strncpy(entry.name.data(), kPools[p].name, entry.name.size() - 1);
+            entry.version = kPools[p].version;
+            entry.count = pools[p].count;
+            entry.columnCount = kPools[p].columnCount;
+            entries.push_back(entry);
+            saved.push_back(&pools[p]);
+
+            std::vector<ColumnEntry> table(kPools[p].columnCount);
+            for (uint32_t k = 0; k < kPools[p].columnCount; ++k)
+                table[k].elementSize = kPools[p].columnSizes[k];
+            columns.push_back(std::move(table));
+        }
+        header.poolCount = static_cast<uint32_t>(entries.size());
+        header.poolTableOffset = offset;
+        offset = Align(offset + entries.size() * sizeof(PoolEntry));
+
+        for (size_t p = 0; p < entries.size(); ++p)
+        {
+            entries[p].columnTableOffset = offset;
+            offset = Align(offset + columns[p].size() * sizeof(ColumnEntry));
+        }
+
+        std::vector<StringEntry> strings(ctx.strings.size());
+        for (size_t s = 0; s < strings.size(); ++s)
+        {
+            strings[s].offset = offset;
+            strings[s].length = static_cast<uint32_t>(ctx.strings[s].size());
+            offset = Align(offset + strings[s].length);
+        }
+
+        for (size_t p = 0; p < entries.size(); ++p)
+        {
+            entries[p].entityOffset = offset;
+            offset = Align(offset + uint64_t(entries[p].count) * sizeof(uint32_t));
+            for (ColumnEntry& column : columns[p])
+            {
+                column.offset = offset;
+                offset = Align(offset + uint64_t(entries[p].count) * column.elementSize);
+            }
+        }
+        header.fileSize = offset;
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            std::cerr << "[ZED::Scene] Can't open " << path << " for writing\n";
+            return false;
+        }
+
+        Writer w(out);
+        w.Write(&header, sizeof(header));
+        w.PadTo(header.stringTableOffset);
+        w.Write(strings.data(), strings.size() * sizeof(StringEntry));
+        w.PadTo(header.poolTableOffset);
+        w.Write(entries.data(), entries.size() * sizeof(PoolEntry));
+        for (size_t p = 0; p < entries.size(); ++p)
+        {
+            w.PadTo(entries[p].columnTableOffset);
+            w.Write(columns[p].data(), columns[p].size() * sizeof(ColumnEntry));
+        }
+        for (size_t s = 0; s < strings.size(); ++s)
+        {
+            w.PadTo(strings[s].offset);
+            w.Write(ctx.strings[s].data(), ctx.strings[s].size());
+        }
+        for (size_t p = 0; p < entries.size(); ++p)
+        {
+            w.PadTo(entries[p].entityOffset);
+            w.Write(saved[p]->entities.data(), saved[p]->entities.size() * sizeof(uint32_t));
+            for (size_t k = 0; k < columns[p].size(); ++k)
+            {
+                w.PadTo(columns[p][k].offset);
+                w.Write(saved[p]->columns[k].data(), saved[p]->columns[k].size());
+            }
+        }
+        w.PadTo(header.fileSize);
+
+        if (!out)
+        {
+            std::cerr << "[ZED::Scene] Failed writing " << path << "\n";
+            return false;
+        }
+
+        std::cout << "[ZED::Scene] Saved " << path << ": " << entityCount << " entities, " << entries.size()
+                  << " pool(s), " << header.fileSize / 1024 << " KB in " << ElapsedMs(start) << " ms\n";
+        return true;
+    }
+
+    bool Scene::Load(Registry& reg, const std::string& path, std::vector<entt::entity>* created)
+    {
+        const auto start = Clock::now();
+
+        MappedFile file;
+        if (!file.Open(path))
+        {
+            std::cerr << "[ZED::Scene] Can't map " << path << "\n";
+            return false;
+        }
+
+        const std::byte* data = file.Data();
+        const size_t size = file.Size();
+        const auto fail = [&](const char* why)
+        {
+            std::cerr << "[ZED::Scene] " << path << ": " << why << "\n";
+            return false;
+        };
+
+        if (size < sizeof(FileHeader)) return fail("not a scene file");
+        const auto header = ReadAt<FileHeader>(data, 0);
+        if (header.magic != kMagic) return fail("not a scene file");
+        if (header.version != kVersion) return fail("unsupported scene version");
+        if (header.fileSize != size) return fail("truncated");
+        if (!InRange(size, header.stringTableOffset, uint64_t(header.stringCount) * sizeof(StringEntry)) ||
+            !InRange(size, header.poolTableOffset, uint64_t(header.poolCount) * sizeof(PoolEntry)))
+            return fail("corrupt tables");
+
+        // Validate everything before touching the registry
+        std::array<PoolView, kPools.size()> views{};
+        std::array<bool, kPools.size()> present{};
+        std::vector<bool> seen;
+
+        for (uint32_t p = 0; p < header.poolCount; ++p)
+        {
+            const auto entry = ReadAt<PoolEntry>(data, header.poolTableOffset + uint64_t(p) * sizeof(PoolEntry));
+            const std::string name = PoolName(entry);
+
+            const auto codec = std::find_if(kPools.begin(), kPools.end(), [&](const PoolCodec& c) { return name == c.name; });
+            if (codec == kPools.end())
+            {
+                std::cerr << "[ZED::Scene] " << path << ": skipping unknown pool '" << name << "'\n";
+                continue;
+            }
+
+            const size_t index = static_cast<size_t>(codec - kPools.begin());
+            if (present[index]) return fail("duplicate pool");
+            if (entry.version != codec->version || entry.columnCount != codec->columnCount)
+            {
+                std::cerr << "[ZED::Scene] " << path << ": skipping pool '" << name << "' saved with layout version "
+                          << entry.version << " (expected " << codec->version << ")\n";
+                continue;
+            }
+
+            if (!InRange(size, entry.entityOffset, uint64_t(entry.count) * sizeof(uint32_t)) ||
+                !InRange(size, entry.columnTableOffset, uint64_t(entry.columnCount) * sizeof(ColumnEntry)))
+                return fail("corrupt pool");
+
+            PoolView& view = views[index];
+            view.count = entry.count;
+            view.entities = data + entry.entityOffset;
+            view.columns.resize(entry.columnCount);
+            for (uint32_t k = 0; k < entry.columnCount; ++k)
+            {
+                const auto column = ReadAt<ColumnEntry>(data, entry.columnTableOffset + uint64_t(k) * sizeof(ColumnEntry));
+                if (column.elementSize != codec->columnSizes[k] ||
+                    !InRange(size, column.offset, uint64_t(entry.count) * column.elementSize))
+                    return fail("corrupt column");
+                view.columns[k] = data + column.offset;
+            }
+
+            // Every element must name a distinct scene entity, or insert() would hit a live one
+            seen.assign(header.entityCount, false);
+            for (uint32_t i = 0; i < entry.count; ++i)
+            {
+                const auto e = ReadAt<uint32_t>(view.entities, uint64_t(i) * sizeof(uint32_t));
+                if (e >= header.entityCount || seen[e]) return fail("bad entity index");
+                seen[e] = true;
+            }
+            present[index] = true;
+        }
+
+        // Resolve each script path once; the scripting module hands back its existing id for loaded paths
+        LoadContext ctx;
+        bool needsScripting = false;
+        for (size_t p = 0; p < kPools.size(); ++p) needsScripting |= present[p] && kPools[p].needsScripting;
+        IScripting* scripting = needsScripting ? Scripting::Get() : nullptr;
+        ctx.scripts.assign(header.stringCount, 0);
+        for (uint32_t s = 0; s < header.stringCount && scripting; ++s)
+        {
+            const auto entry = ReadAt<StringEntry>(data, header.stringTableOffset + uint64_t(s) * sizeof(StringEntry));
+            if (!InRange(size, entry.offset, entry.length)) return fail("corrupt string table");
+
+            const std::string script(reinterpret_cast<const char*>(data + entry.offset), entry.length);
+            ctx.scripts[s] = scripting->LoadBytecodeFile(script).value;
+        }
+
+        std::vector<entt::entity> local;
+        std::vector<entt::entity>& entities = created ? *created : local;
+        entities.assign(header.entityCount, entt::null);
+        reg.create(entities.begin(), entities.end());
+        ctx.entities = entities.data();
+        ctx.entityCount = header.entityCount;
+
+        size_t loaded = 0;
+        for (size_t p = 0; p < kPools.size(); ++p)
+        {
+            if (!present[p]) continue;
+            if (kPools[p].needsScripting && !scripting)
+            {
+                std::cerr << "[ZED::Scene] " << path << ": no scripting module, skipping " << views[p].count
+                          << " " << kPools[p].name << " component(s)\n";
+                continue;
+            }
+
+            kPools[p].load(reg, views[p], ctx);
+            if (kPools[p].afterLoad) kPools[p].afterLoad(reg);
+            ++loaded;
+        }
+
+        std::cout << "[ZED::Scene] Loaded " << path << ": " << header.entityCount << " entities, " << loaded
+                  << " pool(s) in " << ElapsedMs(start) << " ms\n";
+        return true;
+    }
+}
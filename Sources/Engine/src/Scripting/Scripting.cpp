@@ -3,7 +3,11 @@
  */
 
 #include "Engine/Scripting/Scripting.h"
+
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
+#include <vector>
 
 namespace ZED
 {
@@ -22,5 +26,51 @@ namespace ZED
         }
         return s_Impl;
     }
-}
 
+    void Scripting::ReportTopScripts(std::ostream& out, size_t count)
+    {
+        if (!s_Impl || !s_Impl->IsProfiling()) return;
+
+        std::vector<ScriptStats> scripts;
+        s_Impl->GetScriptStats(scripts);
+        if (scripts.empty()) return;
+
+        const auto cost = [](const ScriptStats& s) { return s.updateMs + s.eventMs + s.gcMs; };
+        std::sort(scripts.begin(), scripts.end(), [&](const ScriptStats& a, const ScriptStats& b) { return cost(a) > cost(b); });
+
+        double totalMs = 0.0;
+        for (const auto& s : scripts)
+            totalMs += cost(s);
+
+        const double frames = static_cast<double>(std::max<uint64_t>(1, s_Impl->GetProfiledFrames()));
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(3);
+
+        out << "[ZED::Scripting] Top " << std::min(count, scripts.size()) << " of " << scripts.size() << " scripts over "
+            << s_Impl->GetProfiledFrames() << " frames (" << totalMs / frames << " ms/frame in scripts)\n";
+
+        std::vector<ScriptStats> instances;
+        for (size_t i = 0; i < std::min(count, scripts.size()); ++i)
+        {
+            const ScriptStats& s = scripts[i];
+            out << "  " << i + 1 << ". " << s.name << ": " << cost(s) / frames << " ms/frame ("
+                << (totalMs > 0.0 ? 100.0 * cost(s) / totalMs : 0.0) << "%), " << s.instances << " instance(s) | update "
+                << s.updateCalls << " call(s) " << s.updateMs << " ms | event " << s.eventCalls << " call(s) " << s.eventMs
+                << " ms | " << static_cast<double>(s.bytesAllocated) / 1024.0 / frames << " KB/frame allocated, "
+                << s.heapBytes / 1024 << " KB held | " << s.gcSteps << " GC step(s) " << s.gcMs << " ms\n";
+
+            s_Impl->GetInstanceStats(s.id, instances);
+            const auto worst = std::max_element(instances.begin(), instances.end(),
+                                                [&](const ScriptStats& a, const ScriptStats& b) { return cost(a) < cost(b); });
+            if (worst != instances.end() && instances.size() > 1)
+            {
+                out << "     heaviest instance: entity " << worst->entity << ", " << cost(*worst) / frames << " ms/frame, "
+                    << static_cast<double>(worst->bytesAllocated) / 1024.0 / frames << " KB/frame\n";
+            }
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
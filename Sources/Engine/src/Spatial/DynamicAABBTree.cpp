@@ -0,0 +1,371 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Spatial/DynamicAABBTree.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ZED
+{
+    DynamicAABBTree::DynamicAABBTree(float margin)
+        : m_Margin(margin)
+    {
+    }
+
+    int32_t DynamicAABBTree::AllocateNode()
+    {
+        if (m_FreeList == kNullNode)
+        {
+            m_Nodes.emplace_back();
+            return static_cast<int32_t>(m_Nodes.size() - 1);
+        }
+
+        const int32_t id = m_FreeList;
+        m_FreeList = m_Nodes[id].parent;
+        m_Nodes[id] = Node{};
+        return id;
+    }
+
+    void DynamicAABBTree::FreeNode(int32_t id)
+    {
+        m_Nodes[id].parent = m_FreeList;
+        m_Nodes[id].child1 = kNullNode;
+        m_Nodes[id].child2 = kNullNode;
+        m_Nodes[id].height = -1;
+        m_FreeList = id;
+    }
+
+    int32_t DynamicAABBTree::CreateProxy(const AABB& box, uint32_t userData)
+    {
+        const int32_t id = AllocateNode();
+        Node& node = m_Nodes[id];
+        node.box = AABB{ box.min - Vec3(m_Margin), box.max + Vec3(m_Margin) };
+        node.userData = userData;
+        node.height = 0;
+
+        InsertLeaf(id);
+        ++m_ProxyCount;
+        return id;
+    }
+
+    void DynamicAABBTree::DestroyProxy(int32_t proxy)
+    {
+        assert(proxy >= 0 && proxy < static_cast<int32_t>(m_Nodes.size()) && m_Nodes[proxy].IsLeaf());
+
+        RemoveLeaf(proxy);
+        FreeNode(proxy);
+        --m_ProxyCount;
+    }
+
+    bool DynamicAABBTree::MoveProxy(int32_t proxy, const AABB& box)
+    {
+        if (m_Nodes[proxy].box.Contains(box)) return false;
+
+        RemoveLeaf(proxy);
+        m_Nodes[proxy].box = AABB{ box.min - Vec3(m_Margin), box.max + Vec3(m_Margin) };
+        InsertLeaf(proxy);
+        return true;
+    }
+
+    void DynamicAABBTree::SetProxyBounds(int32_t proxy, const AABB& box)
+    {
+        m_Nodes[proxy].box = box;
+    }
+
+    void DynamicAABBTree::Clear()
+    {
+        m_Nodes.clear();
+        m_Root = kNullNode;
+        m_FreeList = kNullNode;
+        m_ProxyCount = 0;
+    }
+
+    void DynamicAABBTree::InsertLeaf(int32_t leaf)
+    {
+        if (m_Root == kNullNode)
+        {
+            m_Root = leaf;
+            m_Nodes[leaf].parent = kNullNode;
+            return;
+        }
+
+        // Descend towards the cheapest sibling (surface area heuristic)
+        const AABB leafBox = m_Nodes[leaf].box;
+        int32_t index = m_Root;
+        while (!m_Nodes[index].IsLeaf())
+        {
+            const Node& node = m_Nodes[index];
+            const float area = node.box.SurfaceArea();
+            const float combinedArea = AABB::Union(node.box, leafBox).SurfaceArea();
+
+            // Cost of making a new parent for this node and the leaf, and the
+            // minimum cost of pushing the leaf further down
+            const float cost = 2.0f * combinedArea;
+            const float inheritance = 2.0f * (combinedArea - area);
+
+            auto childCost = [&](int32_t child)
+            {
+                const Node& c = m_Nodes[child];
+                const float unionArea = AABB::Union(c.box, leafBox).SurfaceArea();
+                return c.IsLeaf() ? unionArea + inheritance
+                                  : unionArea - c.box.SurfaceArea() + inheritance;
+            };
+
+            const float cost1 = childCost(node.child1);
+            const float cost2 = childCost(node.child2);
+
+            if (cost < cost1 && cost < cost2) break;
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        const int32_t sibling = index;
+        const int32_t oldParent = m_Nodes[sibling].parent;
+        const int32_t newParent = AllocateNode();
+
+        Node& parent = m_Nodes[newParent];
+        parent.parent = oldParent;
+        parent.box = AABB::Union(leafBox, m_Nodes[sibling].box);
+        parent.height = m_Nodes[sibling].height + 1;
+        parent.child1 = sibling;
+        parent.child2 = leaf;
+
+        if (oldParent != kNullNode)
+        {
+            if (m_Nodes[oldParent].child1 == sibling) m_Nodes[oldParent].child1 = newParent;
+            else m_Nodes[oldParent].child2 = newParent;
+        }
+        else
+        {
+            m_Root = newParent;
+        }
+
+        m_Nodes[sibling].parent = newParent;
+        m_Nodes[leaf].parent = newParent;
+
+        FixUpwards(m_Nodes[leaf].parent);
+    }
+
+    void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+    {
+        if (leaf == m_Root)
+        {
+            m_Root = kNullNode;
+            return;
+        }
+
+        const int32_t parent = m_Nodes[leaf].parent;
+        const int32_t grandParent = m_Nodes[parent].parent;
+        const int32_t sibling = m_Nodes[parent].child1 == leaf ? m_Nodes[parent].child2 : m_Nodes[parent].child1;
+
+        // The sibling takes the parent's place
+        if (grandParent != kNullNode)
+        {
+            if (m_Nodes[grandParent].child1 == parent) m_Nodes[grandParent].child1 = sibling;
+            else m_Nodes[grandParent].child2 = sibling;
+            m_Nodes[sibling].parent = grandParent;
+            FreeNode(parent);
+
+            FixUpwards(grandParent);
+        }
+        else
+        {
+            m_Root = sibling;
+            m_Nodes[sibling].parent = kNullNode;
+            FreeNode(parent);
+        }
+    }
+
+    void DynamicAABBTree::FixUpwards(int32_t id)
+    {
+        while (id != kNullNode)
+        {
+            id = Balance(id);
+
+            Node& node = m_Nodes[id];
+            const Node& c1 = m_Nodes[node.child1];
+            const Node& c2 = m_Nodes[node.child2];
+            node.height = 1 + std::max(c1.height, c2.height);
+            node.box = AABB::Union(c1.box, c2.box);
+
+            id = node.parent;
+        }
+    }
+
+    int32_t DynamicAABBTree::Balance(int32_t iA)
+    {
+        Node& A = m_Nodes[iA];
+        if (A.IsLeaf() || A.height < 2) return iA;
+
+        const int32_t iB = A.child1;
+        const int32_t iC = A.child2;
+        Node& B = m_Nodes[iB];
+        Node& C = m_Nodes[iC];
+
+        const int32_t balance = C.height - B.height;
+
+        // Promote the taller child: it becomes the subtree root and A takes one of its children.
+        // Which grandchild A keeps is the shorter one, so the new subtree is as flat as possible.
+        auto rotate = [&](int32_t iUp, int32_t iStay, bool upIsChild2)
+        {
+            Node& up = m_Nodes[iUp];
+            const int32_t iF = up.child1;
+            const int32_t iG = up.child2;
+            Node& F = m_Nodes[iF];
+            Node& G = m_Nodes[iG];
+
+            up.child1 = iA;
+            up.parent = A.parent;
+            A.parent = iUp;
+
+            if (up.parent != kNullNode)
+            {
+                if (m_Nodes[up.parent].child1 == iA) m_Nodes[up.parent].child1 = iUp;
+                else m_Nodes[up.parent].child2 = iUp;
+            }
+            else
+            {
+                m_Root = iUp;
+            }
+
+            const Node& stay = m_Nodes[iStay];
+            const bool keepF = F.height > G.height;
+            const int32_t iKeep = keepF ? iF : iG;   // stays under up
+            const int32_t iMove = keepF ? iG : iF;   // moves under A
+
+            up.child2 = iKeep;
+            if (upIsChild2) A.child2 = iMove;
+            else A.child1 = iMove;
+            m_Nodes[iMove].parent = iA;
+
+            A.box = AABB::Union(stay.box, m_Nodes[iMove].box);
+            A.height = 1 + std::max(stay.height, m_Nodes[iMove].height);
+            up.box = AABB::Union(A.box, m_Nodes[iKeep].box);
+            up.height = 1 + std::max(A.height, m_Nodes[iKeep].height);
+        };
+
+        if (balance > 1)
+        {
+            rotate(iC, iB, true);
+            return iC;
+        }
+        if (balance < -1)
+        {
+            rotate(iB, iC, false);
+            return iB;
+        }
+        return iA;
+    }
+
+    void DynamicAABBTree::Refit()
+    {
+        if (m_Root == kNullNode) return;
+
+        // Iterative post-order walk: children are finished before their parent
+        std::vector<int32_t> stack;
+        std::vector<int32_t> order;
+        order.reserve(m_Nodes.size());
+        stack.push_back(m_Root);
+        while (!stack.empty())
+        {
+            const int32_t id = stack.back();
+            stack.pop_back();
+
+            const Node& node = m_Nodes[id];
+            if (node.IsLeaf()) continue;
+
+            order.push_back(id);
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+        {
+            Node& node = m_Nodes[*it];
+            node.box = AABB::Union(m_Nodes[node.child1].box, m_Nodes[node.child2].box);
+        }
+    }
+
+    void DynamicAABBTree::Rebuild()
+    {
+        if (m_ProxyCount == 0) return;
+
+        std::vector<int32_t> leaves;
+        leaves.reserve(m_ProxyCount);
+        for (int32_t i = 0; i < static_cast<int32_t>(m_Nodes.size()); ++i)
+        {
+            Node& node = m_Nodes[i];
+            if (node.height < 0) continue;
+
+            if (node.IsLeaf())
+            {
+                node.parent = kNullNode;
+                leaves.push_back(i);
+            }
+            else
+            {
+                FreeNode(i);
+            }
+        }
+
+        m_Root = BuildTopDown(leaves.data(), static_cast<int32_t>(leaves.size()));
+        m_Nodes[m_Root].parent = kNullNode;
+    }
+
+    int32_t DynamicAABBTree::BuildTopDown(int32_t* leaves, int32_t count)
+    {
+        if (count == 1) return leaves[0];
+
+        // Split at the median centroid along the widest axis of the centroid bounds
+        Vec3 cmin = m_Nodes[leaves[0]].box.Center();
+        Vec3 cmax = cmin;
+        for (int32_t i = 1; i < count; ++i)
+        {
+            const Vec3 c = m_Nodes[leaves[i]].box.Center();
+            cmin = glm::min(cmin, c);
+            cmax = glm::max(cmax, c);
+        }
+
+        const Vec3 extent = cmax - cmin;
+        const int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+        const int32_t half = count / 2;
+        std::nth_element(leaves, leaves + half, leaves + count, [&](int32_t a, int32_t b)
+        {
+            const AABB& ba = m_Nodes[a].box;
+            const AABB& bb = m_Nodes[b].box;
+            return ba.min[axis] + ba.max[axis] < bb.min[axis] + bb.max[axis];
+        });
+
+        const int32_t child1 = BuildTopDown(leaves, half);
+        const int32_t child2 = BuildTopDown(leaves + half, count - half);
+
+        // Allocate after recursing; AllocateNode may grow m_Nodes
+        const int32_t id = AllocateNode();
+        Node& node = m_Nodes[id];
+        node.child1 = child1;
+        node.child2 = child2;
+        node.box = AABB::Union(m_Nodes[child1].box, m_Nodes[child2].box);
+        node.height = 1 + std::max(m_Nodes[child1].height, m_Nodes[child2].height);
+        m_Nodes[child1].parent = id;
+        m_Nodes[child2].parent = id;
+        return id;
+    }
+
+    float DynamicAABBTree::GetAreaRatio() const
+    {
+        if (m_Root == kNullNode) return 0.0f;
+
+        const float rootArea = m_Nodes[m_Root].box.SurfaceArea();
+        if (rootArea <= 0.0f) return 0.0f;
+
+        float total = 0.0f;
+        for (const Node& node : m_Nodes)
+        {
+            if (node.height > 0)
+                total += node.box.SurfaceArea();
+        }
+        return total / rootArea;
+    }
+}
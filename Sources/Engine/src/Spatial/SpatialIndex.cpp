@@ -0,0 +1,218 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Spatial/SpatialIndex.h"
+#include "Engine/ECS/Components/BoundsComponent.h"
+#include "Engine/ECS/Components/HierarchyComponent.h"
+#include "Engine/ECS/Components/WorldMatrixComponent.h"
+
+namespace ZED
+{
+    namespace
+    {
+        // Fat-AABB margin; a unit cube can drift this far before its leaf is re-inserted
+        constexpr float kFatMargin = 0.25f;
+
+        bool SphereOverlapsBox(const Vec4& s, const AABB& box)
+        {
+            const Vec3 c(s);
+            const Vec3 closest = glm::clamp(c, box.min, box.max);
+            const Vec3 d = c - closest;
+            return glm::dot(d, d) <= s.w * s.w;
+        }
+    }
+
+    struct SpatialIndex::IndexState
+    {
+        DynamicAABBTree tree{ kFatMargin };
+
+        // Proxy per entity index, kNullNode when the entity is not in the tree
+        std::vector<int32_t> proxyOf;
+
+        // Exact world sphere per proxy id (xyz = center, w = radius)
+        std::vector<Vec4> spheres;
+
+        // Entities touched since the last Update(); may contain duplicates and dead entities
+        std::vector<entt::entity> moved;
+
+        int32_t& ProxySlot(entt::entity e)
+        {
+            const auto index = static_cast<size_t>(entt::to_entity(e));
+            if (index >= proxyOf.size())
+                proxyOf.resize(index + 1, DynamicAABBTree::kNullNode);
+            return proxyOf[index];
+        }
+    };
+
+    SpatialIndex::IndexState& SpatialIndex::GetState(Registry& r)
+    {
+        // Created on first use; returns the existing one afterwards
+        return r.ctx().emplace<IndexState>();
+    }
+
+    const SpatialIndex::IndexState* SpatialIndex::FindState(const Registry& r)
+    {
+        return r.ctx().find<IndexState>();
+    }
+
+    void SpatialIndex::connect(Registry& r)
+    {
+        // Every transform edit goes through MarkDirty(), and new transforms are tagged on creation
+        r.on_construct<TransformDirty>().connect<&SpatialIndex::onMoved>();
+        r.on_construct<BoundsComponent>().connect<&SpatialIndex::onMoved>();
+        r.on_update   <BoundsComponent>().connect<&SpatialIndex::onMoved>();
+        r.on_destroy  <BoundsComponent>().connect<&SpatialIndex::onMoved>();
+        r.on_destroy  <WorldMatrixComponent>().connect<&SpatialIndex::onDestroy>();
+    }
+
+    void SpatialIndex::onMoved(Registry& r, entt::entity e)
+    {
+        GetState(r).moved.push_back(e);
+    }
+
+    void SpatialIndex::onDestroy(Registry& r, entt::entity e)
+    {
+        IndexState& state = GetState(r);
+        int32_t& proxy = state.ProxySlot(e);
+        if (proxy == DynamicAABBTree::kNullNode) return;
+
+        state.tree.DestroyProxy(proxy);
+        proxy = DynamicAABBTree::kNullNode;
+    }
+
+    void SpatialIndex::Update(Registry& r)
+    {
+        IndexState& state = GetState(r);
+        if (state.moved.empty()) return;
+
+        const auto& worlds = r.storage<WorldMatrixComponent>();
+        const auto& bounds = r.storage<BoundsComponent>();
+
+        auto refresh = [&](entt::entity e)
+        {
+            if (!worlds.contains(e)) return;
+
+            const Vec4 sphere = ComputeWorldSphere(worlds.get(e).matrix, bounds.contains(e) ? &bounds.get(e) : nullptr);
+            const AABB box = AABB::FromSphere(Vec3(sphere), sphere.w);
+
+            int32_t& proxy = state.ProxySlot(e);
+            if (proxy == DynamicAABBTree::kNullNode)
+                proxy = state.tree.CreateProxy(box, entt::to_integral(e));
+            else
+                state.tree.MoveProxy(proxy, box);
+
+            if (static_cast<size_t>(proxy) >= state.spheres.size())
+                state.spheres.resize(static_cast<size_t>(proxy) + 1);
+            state.spheres[proxy] = sphere;
+        };
+
+        for (const entt::entity e : state.moved)
+            refresh(e);
+
+        // Children of moved parents are not tagged; propagation flags them instead.
+        // The flags are current right after UpdateWorldMatrices(); stale ones only cost a no-op refresh.
+        for (auto [e, h] : r.view<HierarchyComponent>().each())
+        {
+            if (h.worldChanged)
+                refresh(e);
+        }
+
+        state.moved.clear();
+    }
+
+    void SpatialIndex::QueryAABB(const Registry& r, const AABB& box, std::vector<entt::entity>& out)
+    {
+        out.clear();
+        const IndexState* state = FindState(r);
+        if (!state) return;
+
+        state->tree.Query(box, [&](int32_t proxy)
+        {
+            if (SphereOverlapsBox(state->spheres[proxy], box))
+                out.push_back(static_cast<entt::entity>(state->tree.GetUserData(proxy)));
+            return true;
+        });
+    }
+
+    void SpatialIndex::QuerySphere(const Registry& r, const Vec3& center, float radius, std::vector<entt::entity>& out)
+    {
+        out.clear();
+        const IndexState* state = FindState(r);
+        if (!state) return;
+
+        state->tree.Query(AABB::FromSphere(center, radius), [&](int32_t proxy)
+        {
+            const Vec4& s = state->spheres[proxy];
+            const Vec3 d = Vec3(s) - center;
+            const float reach = radius + s.w;
+            if (glm::dot(d, d) <= reach * reach)
+                out.push_back(static_cast<entt::entity>(state->tree.GetUserData(proxy)));
+            return true;
+        });
+    }
+
+    void SpatialIndex::QueryFrustum(const Registry& r, const Frustum& frustum, std::vector<entt::entity>& out)
+    {
+        out.clear();
+        const IndexState* state = FindState(r);
+        if (!state) return;
+
+        state->tree.QueryPlanes(frustum.planes, 6, [&](int32_t proxy)
+        {
+            const Vec4& s = state->spheres[proxy];
+            if (frustum.IntersectsSphere(Vec3(s), s.w))
+                out.push_back(static_cast<entt::entity>(state->tree.GetUserData(proxy)));
+            return true;
+        });
+    }
+
+    entt::entity SpatialIndex::Raycast(const Registry& r, const Vec3& origin, const Vec3& direction, float maxDistance, float* outDistance)
+    {
+        const IndexState* state = FindState(r);
+        if (!state) return entt::null;
+
+        const float len = glm::length(direction);
+        if (len <= 0.0f) return entt::null;
+        const Vec3 dir = direction / len;
+
+        entt::entity hit = entt::null;
+        float best = maxDistance;
+
+        state->tree.Raycast(origin, dir, maxDistance, [&](int32_t proxy, float maxT)
+        {
+            // Ray/sphere: |o + t*d - c|^2 = r^2 with |d| = 1
+            const Vec4& s = state->spheres[proxy];
+            const Vec3 oc = origin - Vec3(s);
+            const float b = glm::dot(oc, dir);
+            const float c = glm::dot(oc, oc) - s.w * s.w;
+            const float disc = b * b - c;
+            if (disc < 0.0f) return -1.0f;
+
+            // Starting inside counts as a hit at 0, which also ends the walk
+            const float t = c <= 0.0f ? 0.0f : -b - std::sqrt(disc);
+            if (t < 0.0f || t >= maxT) return -1.0f;
+
+            hit = static_cast<entt::entity>(state->tree.GetUserData(proxy));
+            best = t;
+            return t;
+        });
+
+        if (outDistance && hit != entt::null) *outDistance = best;
+        return hit;
+    }
+
+    const DynamicAABBTree& SpatialIndex::GetTree(Registry& r)
+    {
+        return GetState(r).tree;
+    }
+
+    void SpatialIndex::Clear(Registry& r)
+    {
+        IndexState& state = GetState(r);
+        state.tree.Clear();
+        state.proxyOf.clear();
+        state.spheres.clear();
+        state.moved.clear();
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Time/FixedTimestep.h"
+#include "Engine/Config/Config.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ZED
+{
+    double FixedTimestep::s_step = 1.0 / 60.0;
+    uint32_t FixedTimestep::s_maxCatchUpSteps = 4;
+    double FixedTimestep::s_accumulator = 0.0;
+    uint64_t FixedTimestep::s_tick = 0;
+    double FixedTimestep::s_dropped = 0.0;
+    bool FixedTimestep::s_lockstep = false;
+
+    void FixedTimestep::InitFromConfig()
+    {
+        const auto& ini = Config::Get();
+        const double step = ini.GetDoubleValue("Time", "FixedTimeStep", 1.0 / 60.0);
+        const long maxSteps = ini.GetLongValue("Time", "MaxCatchUpSteps", 4);
+
+        Configure(step, maxSteps > 0 ? static_cast<uint32_t>(maxSteps) : 1u);
+    }
+
+    void FixedTimestep::Configure(double step, uint32_t maxCatchUpSteps)
+    {
+        s_step = step > 0.0 ? step : 1.0 / 60.0;
+        s_maxCatchUpSteps = std::max(1u, maxCatchUpSteps);
+        s_accumulator = 0.0;
+        s_tick = 0;
+        s_dropped = 0.0;
+    }
+
+    uint32_t FixedTimestep::Advance(double frameDeltaTime)
+    {
+        if (s_lockstep)
+        {
+            ++s_tick;
+            return 1;
+        }
+
+        s_accumulator += std::max(0.0, frameDeltaTime);
+
+        const double due = std::floor(s_accumulator / s_step);
+        const uint32_t steps = static_cast<uint32_t>(std::min(due, static_cast<double>(s_maxCatchUpSteps)));
+        s_accumulator -= steps * s_step;
+
+        // Past the limit, keep only the partial step so alpha stays meaningful
+        if (s_accumulator >= s_step)
+        {
+            const double keep = std::fmod(s_accumulator, s_step);
+            s_dropped += s_accumulator - keep;
+            s_accumulator = keep;
+        }
+
+        s_tick += steps;
+        return steps;
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Engine/Time/FramePacer.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <cmath>
+#include <thread>
+
+namespace ZED
+{
+    namespace
+    {
+        using Seconds = std::chrono::duration<double>;
+
+        double s_targetFps = 0.0;
+        FramePacer::Clock::duration s_frameTime{ 0 };
+        FramePacer::Clock::time_point s_nextFrame{};
+        double s_lastWait = 0.0;
+
+        // Running mean/variance of how long a 1 ms sleep really takes. Exponentially weighted,
+        // so it follows changes such as the OS timer resolution being raised by another process.
+        double s_sleepMean = 0.002;
+        double s_sleepVar = 0.0;
+        constexpr double kSmoothing = 0.05;
+
+        void RecordSleep(double observed)
+        {
+            const double delta = observed - s_sleepMean;
+            s_sleepMean += kSmoothing * delta;
+            s_sleepVar = (1.0 - kSmoothing) * (s_sleepVar + kSmoothing * delta * delta);
+        }
+    }
+
+    void FramePacer::InitFromConfig()
+    {
+        SetTargetFrameRate(Config::Get().GetDoubleValue("Time", "TargetFrameRate", 0.0));
+    }
+
+    void FramePacer::SetTargetFrameRate(double framesPerSecond)
+    {
+        s_targetFps = framesPerSecond > 0.0 ? framesPerSecond : 0.0;
+        s_frameTime = s_targetFps > 0.0
+            ? std::chrono::duration_cast<Clock::duration>(Seconds(1.0 / s_targetFps))
+            : Clock::duration::zero();
+        s_nextFrame = Clock::time_point{};
+    }
+
+    double FramePacer::GetTargetFrameRate()
+    {
+        return s_targetFps;
+    }
+
+    void FramePacer::Wait()
+    {
+        s_lastWait = 0.0;
+        if (s_frameTime == Clock::duration::zero()) return;
+
+        ZED_PROFILE_SCOPE("FramePacer::Wait");
+
+        const Clock::time_point start = Clock::now();
+
+        // First frame, or the last one ran long: start a fresh slot instead of rushing to catch up
+        if (s_nextFrame == Clock::time_point{} || start >= s_nextFrame)
+        {
+            s_nextFrame = start + s_frameTime;
+            return;
+        }
+
+        const Clock::time_point target = s_nextFrame;
+        Clock::time_point now = start;
+
+        // Coarse: sleep while a worst-case-ish sleep still lands before the target
+        while (Seconds(target - now).count() > s_sleepMean + std::sqrt(s_sleepVar))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            const Clock::time_point woke = Clock::now();
+            RecordSleep(Seconds(woke - now).count());
+            now = woke;
+        }
+
+        // Fine: spin out the remainder
+        while (now < target)
+        {
+            std::this_thread::yield();
+            now = Clock::now();
+        }
+
+        s_lastWait = Seconds(now - start).count();
+
+        // Slots are laid back to back, so small overshoots don't accumulate into drift
+        s_nextFrame = target + s_frameTime;
+    }
+
+    double FramePacer::GetLastWaitTime()
+    {
+        return s_lastWait;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef INPUTLOG_H
+#define INPUTLOG_H
+
+#pragma once
+
+#include "Engine/Events/Event.h"
+#include "Engine/Interfaces/Input/IInput.h"
+#include "Engine/IO/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ZED
+{
+    // Keys IsKeyDown() is recorded for, Key::Unknown up to the last gamepad axis
+    inline constexpr size_t kKeyCount = static_cast<size_t>(Key::GamepadAxisRightTrigger) + 1;
+
+    // Everything one frame's input produced
+    struct InputFrame
+    {
+        double deltaTime = 0.0;                 // Time::GetDeltaTime() for the frame
+        std::vector<InputEvent> inputs;         // passed to the event callback, in order
+        std::vector<Event> events;              // input events the event system dispatched, in order
+        std::vector<std::pair<Key, bool>> keys; // IsKeyDown() changes once the frame was polled
+
+        bool Empty() const { return inputs.empty() && events.empty() && keys.empty(); }
+
+        void Clear()
+        {
+            deltaTime = 0.0;
+            inputs.clear();
+            events.clear();
+            keys.clear();
+        }
+    };
+
+    /**
+     * Session logs (.zinp): a 16-byte header, then one record per frame in frame order. A
+     * record is a 16-byte frame header (delta time and three counts) followed by 12 bytes per
+     * input event, 20 per event-system event and 2 per key state change, so a frame in which
+     * nothing happened costs 16 bytes. Files are little-endian.
+     */
+    class ZEDENGINE_API InputLogWriter
+    {
+    public:
+        static constexpr uint32_t kVersion = 1;
+
+        ~InputLogWriter();
+
+        // Create path, replacing any log open in this writer; false when it can't be written
+        bool Open(const std::string& path);
+
+        // Append the next frame
+        void Write(const InputFrame& frame);
+
+        // Write the frame count into the header and close the file
+        void Close();
+
+        bool IsOpen() const { return m_file.is_open(); }
+        uint64_t GetFrameCount() const { return m_frames; }
+
+    private:
+        std::ofstream m_file;
+        std::vector<std::byte> m_buffer;
+        uint64_t m_frames = 0;
+    };
+
+    // Reads a log straight out of a mapping, one frame at a time
+    class ZEDENGINE_API InputLogReader
+    {
+    public:
+        // Map and validate path. A log whose recording never finished (no frame count in the
+        // header, or a torn last frame) opens with the frames that are complete.
+        bool Open(const std::string& path);
+        void Close();
+
+        // Decode the next frame into out; false past the last one
+        bool Next(InputFrame& out);
+
+        // Back to the first frame
+        void Rewind();
+
+        bool IsOpen() const { return m_file.IsOpen(); }
+        uint64_t GetFrameCount() const { return m_frameCount; }
+        uint64_t GetFramesRead() const { return m_framesRead; }
+
+    private:
+        MappedFile m_file;
+        size_t m_offset = 0;
+        uint64_t m_frameCount = 0;
+        uint64_t m_framesRead = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef RECORDINGINPUT_H
+#define RECORDINGINPUT_H
+
+#pragma once
+
+#include "Input-Replay/InputLog.h"
+#include "Engine/Interfaces/Input/IInput.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ZED
+{
+    /**
+     * Wraps another input module (SDLInput, usually) and writes everything it produces to an
+     * input log, one record per PollEvents(): the frame's delta time, the events handed to the
+     * callback, the input events the event system dispatched that frame, and which keys
+     * IsKeyDown() reports changed. The wrapped module keeps doing the actual work.
+     *
+     * Dispatched events are collected through the event system's dispatch sink, so they
+     * include input events any module posted, in the order handlers saw them. A frame's
+     * record is written by the next PollEvents(), after the frame's Dispatch(), or on Close().
+     */
+    class ZEDENGINE_API RecordingInput : public IInput
+    {
+    public:
+        explicit RecordingInput(IInput* inner);
+        ~RecordingInput() override;
+
+        // Start writing to path; the wrapped module must already be initialised
+        bool Open(const std::string& path);
+
+        // Write the last frame and finish the log
+        void Close();
+
+        bool Init() override;
+        void PollEvents() override;
+        void SetEventCallback(const std::function<void(const InputEvent&)>& callback) override;
+        bool IsKeyDown(Key key) const override;
+        void AttachToNativeWindow(void* native_handle) override;
+
+    private:
+        IInput* m_inner = nullptr;
+        std::function<void(const InputEvent&)> m_callback;
+
+        InputLogWriter m_log;
+        InputFrame m_frame;
+        bool m_framePending = false;
+
+        std::vector<Event> m_dispatched; // every event dispatched since the last poll
+        std::vector<uint8_t> m_keys; // IsKeyDown() as of the last poll, indexed by Key
+
+        // Write the pending frame, with the input events among those dispatched since
+        void FlushFrame();
+    };
+}
+
+#endif
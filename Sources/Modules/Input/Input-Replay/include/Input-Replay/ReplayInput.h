@@ -0,0 +1,65 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef REPLAYINPUT_H
+#define REPLAYINPUT_H
+
+#pragma once
+
+#include "Input-Replay/InputLog.h"
+#include "Engine/Interfaces/Input/IInput.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ZED
+{
+    /**
+     * Plays an input log back as if its devices were attached. Each PollEvents() is the next
+     * recorded frame: its events go to the callback, its dispatched events are posted deferred
+     * (so they are dispatched that same frame, as they were when recorded) and IsKeyDown()
+     * reports the recorded key state. Past the last frame nothing is produced and the keys
+     * stay as they were.
+     *
+     * A ReplayTime moves to the next frame in Time::Update(), before input is polled, so the
+     * clock and the input come from the same record; without one, PollEvents() does it.
+     */
+    class ZEDENGINE_API ReplayInput : public IInput
+    {
+    public:
+        ReplayInput();
+
+        // Replay path from the first frame; false (and nothing to replay) when it can't be read
+        bool Open(const std::string& path);
+
+        // Load the next frame; false past the last one
+        bool Advance();
+
+        // Delta time of the frame loaded by the last Advance()
+        double GetDeltaTime() const { return m_frame.deltaTime; }
+
+        bool IsOpen() const { return m_log.IsOpen(); }
+        bool IsFinished() const { return m_finished; }
+        uint64_t GetFrameCount() const { return m_log.GetFrameCount(); }
+
+        // Opens [InputReplay] File unless a log is open already
+        bool Init() override;
+        void PollEvents() override;
+        void SetEventCallback(const std::function<void(const InputEvent&)>& callback) override;
+        bool IsKeyDown(Key key) const override;
+        void AttachToNativeWindow(void* native_handle) override;
+
+    private:
+        InputLogReader m_log;
+        InputFrame m_frame;
+        bool m_advanced = false; // Advance() already ran for the frame being polled
+        bool m_finished = false;
+
+        std::function<void(const InputEvent&)> m_callback;
+        std::vector<uint8_t> m_keys; // indexed by Key
+    };
+}
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef REPLAYTIME_H
+#define REPLAYTIME_H
+
+#pragma once
+
+#include "Engine/ITime.h"
+
+namespace ZED
+{
+    class ReplayInput;
+
+    /**
+     * Clock that replays the delta times of a recorded session, so the fixed timestep takes
+     * the same steps on the same frames as it did while recording. Past the end of the log
+     * every frame repeats the last delta. Sleep() returns immediately, like HeadlessTime.
+     */
+    class ZEDENGINE_API ReplayTime : public ITime
+    {
+    public:
+        explicit ReplayTime(ReplayInput& input);
+
+        void Sleep(unsigned int milliseconds) override;
+        void Update() override;
+        double GetDeltaTime() const override;
+        double GetElapsedTime() const override;
+
+    private:
+        ReplayInput& m_input;
+        double m_deltaTime = 0.0;
+        double m_elapsedTime = 0.0;
+    };
+}
+
+#endif
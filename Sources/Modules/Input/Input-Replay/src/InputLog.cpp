@@ -0,0 +1,242 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Input-Replay/InputLog.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+
+namespace ZED
+{
+    namespace
+    {
+        // ---------- file layout ----------
+        // [FileHeader] then per frame [FrameHeader][InputRecord...][EventRecord...][uint16 key...]
+        // A key entry is the Key's value, with the top bit set when it went down.
+        constexpr std::array<char, 4> kMagic{ 'Z', 'I', 'N', 'P' };
+        constexpr uint16_t kKeyDownBit = 0x8000;
+
+        struct FileHeader
+        {
+            std::array<char, 4> magic;
+            uint32_t version;
+            uint64_t frameCount; // 0 while recording
+        };
+
+        struct FrameHeader
+        {
+            double deltaTime;
+            uint16_t inputCount;
+            uint16_t eventCount;
+            uint16_t keyCount;
+            uint16_t reserved;
+        };
+
+        struct InputRecord
+        {
+            uint8_t type;
+            uint8_t reserved;
+            uint16_t key;
+            int32_t x;
+            int32_t y;
+        };
+
+        struct EventRecord
+        {
+            uint8_t type;
+            std::array<uint8_t, 3> reserved;
+            int32_t a;
+            int32_t b;
+            int32_t c;
+            int32_t d;
+        };
+
+        static_assert(sizeof(FileHeader) == 16 && sizeof(FrameHeader) == 16 && sizeof(InputRecord) == 12 && sizeof(EventRecord) == 20);
+        static_assert(kKeyCount < kKeyDownBit, "Key values must leave the top bit of a key entry free");
+
+        size_t FramePayload(const FrameHeader& h)
+        {
+            return h.inputCount * sizeof(InputRecord) + h.eventCount * sizeof(EventRecord) + h.keyCount * sizeof(uint16_t);
+        }
+
+        template <typename T>
+        void Append(std::vector<std::byte>& out, const T& value)
+        {
+            const size_t at = out.size();
+            out.resize(at + sizeof(T));
+            std::memcpy(out.data() + at, &value, sizeof(T));
+        }
+
+        // Records sit at any offset in the mapping, so they are copied out rather than cast
+        template <typename T>
+        T Load(const std::byte* at)
+        {
+            T value;
+            std::memcpy(&value, at, sizeof(T));
+            return value;
+        }
+    }
+
+    // ---------- InputLogWriter ----------
+
+    InputLogWriter::~InputLogWriter()
+    {
+        Close();
+    }
+
+    bool InputLogWriter::Open(const std::string& path)
+    {
+        Close();
+
+        m_file.open(path, std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!m_file)
+        {
+            std::cerr << "[ZED::InputLog] Can't create " << path << "\n";
+            return false;
+        }
+
+        const FileHeader header{ kMagic, kVersion, 0 };
+        m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_frames = 0;
+        return true;
+    }
+
+    void InputLogWriter::Write(const InputFrame& frame)
+    {
+        if (!m_file.is_open()) return;
+
+        // Counts are 16 bits; nothing polls anywhere near that many events in one frame
+        const uint16_t inputCount = static_cast<uint16_t>(std::min<size_t>(frame.inputs.size(), UINT16_MAX));
+        const uint16_t eventCount = static_cast<uint16_t>(std::min<size_t>(frame.events.size(), UINT16_MAX));
+        const uint16_t keyCount = static_cast<uint16_t>(std::min<size_t>(frame.keys.size(), UINT16_MAX));
+
+        m_buffer.clear();
+        Append(m_buffer, FrameHeader{ frame.deltaTime, inputCount, eventCount, keyCount, 0 });
+        for (uint16_t i = 0; i < inputCount; ++i)
+        {
+            const InputEvent& e = frame.inputs[i];
+            Append(m_buffer, InputRecord{ static_cast<uint8_t>(e.type), 0, static_cast<uint16_t>(e.key), e.mouseX, e.mouseY });
+        }
+        for (uint16_t i = 0; i < eventCount; ++i)
+        {
+            const Event& e = frame.events[i];
+            Append(m_buffer, EventRecord{ static_cast<uint8_t>(e.type), {}, e.a, e.b, e.c, e.d });
+        }
+        for (uint16_t i = 0; i < keyCount; ++i)
+        {
+            const auto& [key, down] = frame.keys[i];
+            Append(m_buffer, static_cast<uint16_t>(static_cast<uint16_t>(key) | (down ? kKeyDownBit : 0)));
+        }
+
+        m_file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+        ++m_frames;
+    }
+
+    void InputLogWriter::Close()
+    {
+        if (!m_file.is_open()) return;
+
+        const FileHeader header{ kMagic, kVersion, m_frames };
+        m_file.seekp(0);
+        m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_file.close();
+    }
+
+    // ---------- InputLogReader ----------
+
+    bool InputLogReader::Open(const std::string& path)
+    {
+        Close();
+
+        if (!m_file.Open(path))
+        {
+            std::cerr << "[ZED::InputLog] Can't open " << path << "\n";
+            return false;
+        }
+
+        const std::byte* data = m_file.Data();
+        const size_t size = m_file.Size();
+        if (size < sizeof(FileHeader))
+        {
+            std::cerr << "[ZED::InputLog] " << path << " is not an input log\n";
+            Close();
+            return false;
+        }
+
+        const auto header = Load<FileHeader>(data);
+        if (header.magic != kMagic || header.version != InputLogWriter::kVersion)
+        {
+            std::cerr << "[ZED::InputLog] " << path << " is not an input log of version " << InputLogWriter::kVersion << "\n";
+            Close();
+            return false;
+        }
+
+        // Walk the frame headers once, so a torn recording stops at its last complete frame
+        uint64_t frames = 0;
+        size_t offset = sizeof(FileHeader);
+        while (offset + sizeof(FrameHeader) <= size)
+        {
+            const size_t end = offset + sizeof(FrameHeader) + FramePayload(Load<FrameHeader>(data + offset));
+            if (end > size) break;
+            offset = end;
+            ++frames;
+        }
+
+        if (header.frameCount == 0 && frames > 0)
+            std::cerr << "[ZED::InputLog] " << path << " was not closed by its recorder; replaying " << frames << " frames\n";
+        else if (frames < header.frameCount)
+            std::cerr << "[ZED::InputLog] " << path << " is truncated: " << frames << " of " << header.frameCount << " frames\n";
+
+        m_frameCount = frames;
+        Rewind();
+        return true;
+    }
+
+    void InputLogReader::Close()
+    {
+        m_file.Close();
+        m_offset = 0;
+        m_frameCount = 0;
+        m_framesRead = 0;
+    }
+
+    bool InputLogReader::Next(InputFrame& out)
+    {
+        out.Clear();
+        if (m_framesRead >= m_frameCount) return false;
+
+        const std::byte* at = m_file.Data() + m_offset;
+        const auto header = Load<FrameHeader>(at);
+        at += sizeof(FrameHeader);
+        out.deltaTime = header.deltaTime;
+
+        for (uint16_t i = 0; i < header.inputCount; ++i, at += sizeof(InputRecord))
+        {
+            const auto r = Load<InputRecord>(at);
+            out.inputs.push_back(InputEvent{ static_cast<InputEventType>(r.type), static_cast<Key>(r.key), r.x, r.y });
+        }
+        for (uint16_t i = 0; i < header.eventCount; ++i, at += sizeof(EventRecord))
+        {
+            const auto r = Load<EventRecord>(at);
+            out.events.push_back(Event{ static_cast<EventType>(r.type), r.a, r.b, r.c, r.d });
+        }
+        for (uint16_t i = 0; i < header.keyCount; ++i, at += sizeof(uint16_t))
+        {
+            const auto k = Load<uint16_t>(at);
+            out.keys.emplace_back(static_cast<Key>(k & ~kKeyDownBit), (k & kKeyDownBit) != 0);
+        }
+
+        m_offset = static_cast<size_t>(at - m_file.Data());
+        ++m_framesRead;
+        return true;
+    }
+
+    void InputLogReader::Rewind()
+    {
+        m_offset = sizeof(FileHeader);
+        m_framesRead = 0;
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Input-Replay/RecordingInput.h"
+#include "Input-Replay/ReplayInput.h"
+#include "Input-Replay/ReplayTime.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Input/Input.h"
+#include "Engine/Interfaces/Input/IInput.h"
+#include "Engine/ITime.h"
+#include "Engine/Module/ModuleLoader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+typedef void (*RegisterInputFunc)();
+
+namespace
+{
+    // One player, shared by the input and the clock so both read the same frame
+    ZED::ReplayInput& Player()
+    {
+        static ZED::ReplayInput player;
+        return player;
+    }
+
+    bool IsRecording()
+    {
+        std::string mode = ZED::Config::Get().GetValue("InputReplay", "Mode", "Play");
+        std::transform(mode.begin(), mode.end(), mode.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return mode == "record";
+    }
+
+    void RegisterRecorder()
+    {
+        const auto& ini = ZED::Config::Get();
+        const std::string source = ini.GetValue("InputReplay", "Source", "");
+        if (source.empty() || !ZED::Module::ModuleLoader::LoadModule("InputReplaySource", source))
+        {
+            std::cerr << "[ZED::RecordingInput] No [InputReplay] Source input module to record\n";
+            return;
+        }
+
+        auto registerSource = (RegisterInputFunc)
+            ZED::Module::ModuleLoader::GetFunction("InputReplaySource", "RegisterInput");
+        if (!registerSource)
+        {
+            std::cerr << "[ZED::RecordingInput] RegisterInput not found in " << source << "\n";
+            return;
+        }
+
+        // The source registers itself as usual; the recorder then takes its place in front of it
+        registerSource();
+        ZED::IInput* inner = ZED::Input::GetInput();
+        if (!inner) return;
+
+        static ZED::RecordingInput recorder(inner);
+        if (!recorder.Open(ini.GetValue("InputReplay", "File", "session.zinp")))
+            return;
+
+        recorder.Init();
+        ZED::Input::SetInputImplementation(&recorder);
+    }
+}
+
+// [InputReplay] Mode=Record wraps the Source module, Mode=Play replays File
+extern "C" ZEDENGINE_API void RegisterInput()
+{
+    if (IsRecording())
+    {
+        RegisterRecorder();
+        return;
+    }
+
+    Player().Init();
+    ZED::Input::SetInputImplementation(&Player());
+}
+
+// Recorded frame times, for playback; a recording session keeps its usual Time module
+extern "C" ZEDENGINE_API void RegisterTime()
+{
+    if (IsRecording())
+    {
+        std::cerr << "[ZED::ReplayTime] Only replays; use another Time module while recording\n";
+        return;
+    }
+
+    static ZED::ReplayTime replayTime(Player());
+    Player().Init();
+    ZED::SetTimeImplementation(&replayTime);
+}
+
+// Replay path as both the input and the clock, whatever the INI says. Returns the number of
+// recorded frames, or -1 when the log can't be read.
+extern "C" ZEDENGINE_API int64_t RegisterReplay(const char* path)
+{
+    if (!Player().Open(path))
+        return -1;
+
+    static ZED::ReplayTime replayTime(Player());
+    ZED::SetTimeImplementation(&replayTime);
+    ZED::Input::SetInputImplementation(&Player());
+    return static_cast<int64_t>(Player().GetFrameCount());
+}
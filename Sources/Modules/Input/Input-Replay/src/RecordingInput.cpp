@@ -0,0 +1,113 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Input-Replay/RecordingInput.h"
+#include "Engine/Events/EventSystem.h"
+#include "Engine/Profiler/Profiler.h"
+#include "Engine/Time.h"
+
+#include <iostream>
+
+namespace ZED
+{
+    RecordingInput::RecordingInput(IInput* inner)
+        : m_inner(inner)
+        , m_keys(kKeyCount, 0)
+    {
+    }
+
+    RecordingInput::~RecordingInput()
+    {
+        Close();
+    }
+
+    bool RecordingInput::Open(const std::string& path)
+    {
+        if (!m_log.Open(path)) return false;
+
+        m_frame.Clear();
+        m_framePending = false;
+        std::cout << "[ZED::RecordingInput] Recording input to " << path << "\n";
+        return true;
+    }
+
+    void RecordingInput::Close()
+    {
+        if (!m_log.IsOpen()) return;
+
+        FlushFrame();
+        EventSystem::Get().SetDispatchSink(nullptr);
+
+        std::cout << "[ZED::RecordingInput] Recorded " << m_log.GetFrameCount() << " frames\n";
+        m_log.Close();
+    }
+
+    bool RecordingInput::Init()
+    {
+        if (!m_inner) return false;
+
+        m_inner->SetEventCallback([this](const InputEvent& e)
+        {
+            m_frame.inputs.push_back(e);
+            if (m_callback) m_callback(e);
+        });
+
+        if (m_log.IsOpen())
+            EventSystem::Get().SetDispatchSink(&m_dispatched);
+        return true;
+    }
+
+    void RecordingInput::PollEvents()
+    {
+        ZED_PROFILE_SCOPE("RecordingInput::PollEvents");
+
+        // The previous frame's events have been dispatched by now
+        FlushFrame();
+        m_frame.Clear();
+        m_frame.deltaTime = Time::GetDeltaTime();
+
+        m_inner->PollEvents();
+
+        for (size_t k = 1; k < kKeyCount; ++k)
+        {
+            const bool down = m_inner->IsKeyDown(static_cast<Key>(k));
+            if (down != (m_keys[k] != 0))
+            {
+                m_keys[k] = down ? 1 : 0;
+                m_frame.keys.emplace_back(static_cast<Key>(k), down);
+            }
+        }
+        m_framePending = m_log.IsOpen();
+    }
+
+    void RecordingInput::FlushFrame()
+    {
+        // Input events only, whoever posted them; window events aren't part of a session
+        for (const Event& e : m_dispatched)
+        {
+            if (e.type >= EventType::KeyDown && e.type <= EventType::DeviceDisconnected)
+                m_frame.events.push_back(e);
+        }
+        m_dispatched.clear();
+
+        if (m_framePending)
+            m_log.Write(m_frame);
+        m_framePending = false;
+    }
+
+    void RecordingInput::SetEventCallback(const std::function<void(const InputEvent&)>& callback)
+    {
+        m_callback = callback;
+    }
+
+    bool RecordingInput::IsKeyDown(Key key) const
+    {
+        return m_inner->IsKeyDown(key);
+    }
+
+    void RecordingInput::AttachToNativeWindow(void* native_handle)
+    {
+        m_inner->AttachToNativeWindow(native_handle);
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Input-Replay/ReplayInput.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Events/EventSystem.h"
+#include "Engine/Profiler/Profiler.h"
+
+#include <iostream>
+
+namespace ZED
+{
+    ReplayInput::ReplayInput()
+        : m_keys(kKeyCount, 0)
+    {
+    }
+
+    bool ReplayInput::Open(const std::string& path)
+    {
+        m_frame.Clear();
+        m_advanced = false;
+        m_finished = false;
+        m_keys.assign(kKeyCount, 0);
+
+        if (!m_log.Open(path))
+        {
+            m_finished = true;
+            return false;
+        }
+
+        std::cout << "[ZED::ReplayInput] Replaying " << m_log.GetFrameCount() << " frames from " << path << "\n";
+        return true;
+    }
+
+    bool ReplayInput::Advance()
+    {
+        m_advanced = true;
+        if (m_log.Next(m_frame))
+            return true;
+
+        if (!m_finished && m_log.IsOpen())
+            std::cout << "[ZED::ReplayInput] End of the recorded session after " << m_log.GetFramesRead() << " frames\n";
+        m_finished = true;
+        return false;
+    }
+
+    bool ReplayInput::Init()
+    {
+        if (m_log.IsOpen()) return true;
+
+        const std::string path = Config::Get().GetValue("InputReplay", "File", "");
+        if (path.empty())
+        {
+            std::cerr << "[ZED::ReplayInput] No [InputReplay] File to replay\n";
+            m_finished = true;
+            return false;
+        }
+        return Open(path);
+    }
+
+    void ReplayInput::PollEvents()
+    {
+        ZED_PROFILE_SCOPE("ReplayInput::PollEvents");
+
+        if (!m_advanced)
+            Advance();
+        m_advanced = false;
+
+        for (const InputEvent& e : m_frame.inputs)
+        {
+            if (m_callback) m_callback(e);
+        }
+
+        // Deferred, like the input modules post them, so they are dispatched this frame
+        for (const Event& e : m_frame.events)
+            EventSystem::Get().PostDeferred(e);
+
+        for (const auto& [key, down] : m_frame.keys)
+        {
+            const size_t index = static_cast<size_t>(key);
+            if (index < m_keys.size())
+                m_keys[index] = down ? 1 : 0;
+        }
+    }
+
+    void ReplayInput::SetEventCallback(const std::function<void(const InputEvent&)>& callback)
+    {
+        m_callback = callback;
+    }
+
+    bool ReplayInput::IsKeyDown(Key key) const
+    {
+        const size_t index = static_cast<size_t>(key);
+        return index < m_keys.size() && m_keys[index] != 0;
+    }
+
+    void ReplayInput::AttachToNativeWindow(void*)
+    {
+    }
+}
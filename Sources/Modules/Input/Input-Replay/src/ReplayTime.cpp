@@ -0,0 +1,36 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Input-Replay/ReplayTime.h"
+#include "Input-Replay/ReplayInput.h"
+
+namespace ZED
+{
+    ReplayTime::ReplayTime(ReplayInput& input)
+        : m_input(input)
+        , m_deltaTime(1.0 / 60.0) // until the first recorded frame
+    {
+    }
+
+    void ReplayTime::Sleep(unsigned int)
+    {
+    }
+
+    void ReplayTime::Update()
+    {
+        if (m_input.Advance())
+            m_deltaTime = m_input.GetDeltaTime();
+        m_elapsedTime += m_deltaTime;
+    }
+
+    double ReplayTime::GetDeltaTime() const
+    {
+        return m_deltaTime;
+    }
+
+    double ReplayTime::GetElapsedTime() const
+    {
+        return m_elapsedTime;
+    }
+}
@@ -5,6 +5,7 @@
 #include "Input-SDL3/SDLInput.h"
 #include "Engine/Events/EventSystem.h"
 #include "Engine/Events/Event.h"
+#include "Engine/Profiler/Profiler.h"
 #include <iostream>
 #include <algorithm>
 
@@ -103,6 +104,8 @@ namespace ZED
 
     void SDLInput::PollEvents()
     {
+        ZED_PROFILE_SCOPE("SDLInput::PollEvents");
+
         // Pump SDL to update internal keyboard/mouse/gamepad state.  We do not
         // call SDL_PollEvent here; the window module handles that.
         SDL_PumpEvents();
@@ -150,12 +153,6 @@ namespace ZED
             float relY = 0.0f;
             Uint32 buttons = SDL_GetRelativeMouseState(&relX, &relY);
 
-            // DEBUG: Print to see if we're getting deltas
-            if (relX != 0.0f || relY != 0.0f)
-            {
-                std::cout << "[SDLInput] Relative mouse delta: X=" << relX << ", Y=" << relY << std::endl;
-            }
-
             // Always post the deltas (even if 0,0) - SDL_GetRelativeMouseState resets the accumulator
             InputEvent ie{};
             ie.type   = InputEventType::MouseMove;
@@ -168,12 +165,6 @@ namespace ZED
             ev.c    = static_cast<int>(relX);  // Delta X
             ev.d    = static_cast<int>(relY);  // Delta Y
 
-            // DEBUG: Print when posting event
-            if (relX != 0.0f || relY != 0.0f)
-            {
-                std::cout << "[SDLInput] Posting MouseMove event: c=" << ev.c << ", d=" << ev.d << std::endl;
-            }
-
             EventSystem::Get().PostDeferred(ev);
         }
         else
@@ -0,0 +1,59 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef BULLETPHYSICS_H
+#define BULLETPHYSICS_H
+
+#pragma once
+
+#include "Engine/Interfaces/Physics/IPhysics.h"
+
+#include <memory>
+
+namespace ZED
+{
+    /**
+     * IPhysics on Bullet's btDiscreteDynamicsWorld.
+     *
+     * Bullet is built without BT_THREADSAFE, so it steps on the calling thread and
+     * [Physics] Threads is ignored. Every dynamic body has a motion state that records
+     * itself when Bullet syncs it after a step; Bullet skips sleeping bodies there, so
+     * GetActivePoses() only visits what actually moved.
+     */
+    class ZEDENGINE_API BulletPhysics : public IPhysics
+    {
+    public:
+        BulletPhysics();
+        ~BulletPhysics() override;
+
+        bool Init() override;
+        void Shutdown() override;
+
+        const char* GetName() const override { return "Bullet"; }
+
+        void CreateBodies(std::span<const PhysicsBodyDesc> descs, std::span<PhysicsBodyHandle> outHandles) override;
+        void DestroyBody(PhysicsBodyHandle handle) override;
+        PhysicsJointHandle CreatePointJoint(PhysicsBodyHandle a, PhysicsBodyHandle b, const Vec3& worldPivot) override;
+        void DestroyJoint(PhysicsJointHandle handle) override;
+        void MoveKinematic(PhysicsBodyHandle handle, const Vec3& position, const Quat& rotation, float dt) override;
+        void SetGravity(const Vec3& gravity) override;
+
+        void Step(float dt) override;
+        void GetActivePoses(std::vector<PhysicsBodyPose>& out) override;
+        void GetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<PhysicsBodyState> out) const override;
+        void SetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<const PhysicsBodyState> states) override;
+        bool CastRay(const Vec3& origin, const Vec3& direction, float maxDistance, PhysicsRayHit& outHit) const override;
+
+        PhysicsStats GetStats() const override;
+
+    private:
+        // Bullet types stay out of this header
+        struct State;
+        std::unique_ptr<State> m_state;
+
+        PhysicsStats m_stats;
+    };
+}
+
+#endif
@@ -0,0 +1,526 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Physics-Bullet/BulletPhysics.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Physics/Physics.h"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+
+// Defined in btRigidBody.cpp; how long a body has to stay slow before it may sleep
+extern btScalar gDeactivationTime;
+
+namespace ZED
+{
+    namespace
+    {
+        // Bullet allocator hook that counts live bytes for PhysicsStats::memoryBytes.
+        // Bullet builds its aligned allocations on top of this one, so one pair covers everything.
+        std::atomic<size_t> s_liveBytes{ 0 };
+        bool s_allocatorInstalled = false;
+
+        void* TrackedAllocate(size_t size)
+        {
+            auto* raw = static_cast<size_t*>(std::malloc(size + 16));
+            if (!raw) return nullptr;
+
+            raw[0] = size;
+            s_liveBytes.fetch_add(size, std::memory_order_relaxed);
+            return reinterpret_cast<char*>(raw) + 16;
+        }
+
+        void TrackedFree(void* block)
+        {
+            if (!block) return;
+
+            auto* raw = reinterpret_cast<size_t*>(static_cast<char*>(block) - 16);
+            s_liveBytes.fetch_sub(raw[0], std::memory_order_relaxed);
+            std::free(raw);
+        }
+
+        // Bodies Bullet synced since the last GetActivePoses()
+        struct SyncList
+        {
+            std::vector<uint32_t> moved;
+            uint32_t syncedThisStep = 0;
+        };
+
+        // Bullet calls setWorldTransform only for awake dynamic bodies after each step, and reads
+        // getWorldTransform for kinematic bodies before it, so this is both the dirty list and
+        // the kinematic target.
+        ATTRIBUTE_ALIGNED16(struct) BodyMotionState : public btMotionState
+        {
+            BT_DECLARE_ALIGNED_ALLOCATOR();
+
+            btTransform transform;
+            SyncList* sync = nullptr;
+            uint32_t slot = 0;
+            bool queued = false;
+
+            void getWorldTransform(btTransform& out) const override { out = transform; }
+
+            void setWorldTransform(const btTransform& in) override
+            {
+                transform = in;
+                ++sync->syncedThisStep;
+                if (!queued)
+                {
+                    queued = true;
+                    sync->moved.push_back(slot);
+                }
+            }
+        };
+
+        // Identical colliders (a pile of the same box) share one shape
+        struct ShapeKey
+        {
+            ColliderShape shape;
+            float a, b, c;
+
+            bool operator==(const ShapeKey&) const = default;
+        };
+
+        struct ShapeKeyHash
+        {
+            size_t operator()(const ShapeKey& k) const
+            {
+                size_t h = std::hash<float>()(k.a);
+                h = h * 31 + std::hash<float>()(k.b);
+                h = h * 31 + std::hash<float>()(k.c);
+                return h * 31 + static_cast<size_t>(k.shape);
+            }
+        };
+
+        inline btVector3 ToBullet(const Vec3& v) { return btVector3(v.x, v.y, v.z); }
+        inline btQuaternion ToBullet(const Quat& q) { return btQuaternion(q.x, q.y, q.z, q.w); }
+        inline Vec3 FromBullet(const btVector3& v) { return Vec3(v.x(), v.y(), v.z()); }
+    }
+
+    struct BulletPhysics::State
+    {
+        struct BodySlot
+        {
+            std::unique_ptr<BodyMotionState> motion;
+            std::unique_ptr<btRigidBody> body;
+        };
+
+        std::unique_ptr<btDefaultCollisionConfiguration> collisionConfig;
+        std::unique_ptr<btCollisionDispatcher> dispatcher;
+        std::unique_ptr<btBroadphaseInterface> broadphase;
+        std::unique_ptr<btSequentialImpulseConstraintSolver> solver;
+        std::unique_ptr<btDiscreteDynamicsWorld> world;
+
+        std::unordered_map<ShapeKey, std::unique_ptr<btCollisionShape>, ShapeKeyHash> shapes;
+
+        // Body handle = slot index; empty slots are reused through freeBodies
+        std::vector<BodySlot> bodies;
+        std::vector<PhysicsBodyHandle> freeBodies;
+        uint32_t bodyCount = 0;
+
+        // Joint handle = slot index; null slots are reused through freeJoints
+        std::vector<std::unique_ptr<btTypedConstraint>> joints;
+        std::vector<PhysicsJointHandle> freeJoints;
+        uint32_t jointCount = 0;
+
+        SyncList sync;
+
+        ~State()
+        {
+            // The world doesn't own what was added to it
+            for (auto& joint : joints)
+                if (joint) world->removeConstraint(joint.get());
+            for (auto& slot : bodies)
+                if (slot.body) world->removeRigidBody(slot.body.get());
+            joints.clear();
+            bodies.clear();
+            world.reset();
+        }
+
+        btRigidBody* GetBody(PhysicsBodyHandle handle) const
+        {
+            return handle < bodies.size() ? bodies[handle].body.get() : nullptr;
+        }
+
+        void RemoveJoint(PhysicsJointHandle handle)
+        {
+            world->removeConstraint(joints[handle].get());
+            joints[handle].reset();
+            freeJoints.push_back(handle);
+            --jointCount;
+        }
+
+        btCollisionShape* GetShape(const ColliderComponent& col, const Vec3& scale)
+        {
+            const Vec3 s = glm::abs(scale);
+
+            ShapeKey key{ col.shape, 0.0f, 0.0f, 0.0f };
+            switch (col.shape)
+            {
+            case ColliderShape::Box:
+            {
+                const Vec3 he = col.halfExtents * s;
+                key.a = he.x; key.b = he.y; key.c = he.z;
+                break;
+            }
+            case ColliderShape::Sphere:
+                key.a = col.radius * std::max({ s.x, s.y, s.z });
+                break;
+            case ColliderShape::Capsule:
+                key.a = col.radius * std::max(s.x, s.z);
+                key.b = col.halfHeight * s.y;
+                break;
+            }
+
+            auto it = shapes.find(key);
+            if (it != shapes.end()) return it->second.get();
+
+            std::unique_ptr<btCollisionShape> shape;
+            switch (col.shape)
+            {
+            case ColliderShape::Box:
+            {
+                // Bullet keeps the margin inside the box, but it can't be thicker than the box
+                auto box = std::make_unique<btBoxShape>(btVector3(key.a, key.b, key.c));
+                box->setMargin(std::min({ box->getMargin(), key.a, key.b, key.c }));
+                shape = std::move(box);
+                break;
+            }
+            case ColliderShape::Sphere:
+                shape = std::make_unique<btSphereShape>(key.a);
+                break;
+            case ColliderShape::Capsule:
+                shape = std::make_unique<btCapsuleShape>(key.a, key.b * 2.0f);
+                break;
+            }
+
+            btCollisionShape* raw = shape.get();
+            shapes.emplace(key, std::move(shape));
+            return raw;
+        }
+    };
+
+    BulletPhysics::BulletPhysics() = default;
+
+    BulletPhysics::~BulletPhysics()
+    {
+        Shutdown();
+
+        // Component destroy hooks may still run after the backend is gone
+        if (Physics::Get() == this)
+            Physics::SetImplementation(nullptr);
+    }
+
+    bool BulletPhysics::Init()
+    {
+        if (m_state) return true;
+
+        // Must be in place before Bullet allocates anything; never swapped back
+        if (!s_allocatorInstalled)
+        {
+            btAlignedAllocSetCustom(TrackedAllocate, TrackedFree);
+            s_allocatorInstalled = true;
+        }
+
+        const auto& ini = Config::Get();
+        const long threads = ini.GetLongValue("Physics", "Threads", 0);
+        const long solverIterations = ini.GetLongValue("Physics", "SolverIterations", 10);
+
+        // Jolt lets bodies sleep after 0.5 s at rest; use the same so both backends settle alike
+        gDeactivationTime = btScalar(ini.GetDoubleValue("Physics", "TimeBeforeSleep", 0.5));
+
+        m_state = std::make_unique<State>();
+        m_state->collisionConfig = std::make_unique<btDefaultCollisionConfiguration>();
+        m_state->dispatcher = std::make_unique<btCollisionDispatcher>(m_state->collisionConfig.get());
+        m_state->broadphase = std::make_unique<btDbvtBroadphase>();
+        m_state->solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+        m_state->world = std::make_unique<btDiscreteDynamicsWorld>(m_state->dispatcher.get(), m_state->broadphase.get(),
+                                                                   m_state->solver.get(), m_state->collisionConfig.get());
+        m_state->world->getSolverInfo().m_numIterations = static_cast<int>(std::max(1L, solverIterations));
+
+        const Vec3 gravity(static_cast<float>(ini.GetDoubleValue("Physics", "GravityX", 0.0)),
+                           static_cast<float>(ini.GetDoubleValue("Physics", "GravityY", -9.81)),
+                           static_cast<float>(ini.GetDoubleValue("Physics", "GravityZ", 0.0)));
+        SetGravity(gravity);
+
+        m_stats = PhysicsStats{};
+        std::cout << "[ZED::BulletPhysics] Initialized (single-threaded";
+        if (threads > 0) std::cout << ", [Physics] Threads=" << threads << " ignored";
+        std::cout << ", " << m_state->world->getSolverInfo().m_numIterations << " solver iterations)\n";
+        return true;
+    }
+
+    void BulletPhysics::Shutdown()
+    {
+        if (!m_state) return;
+
+        m_state.reset();
+        std::cout << "[ZED::BulletPhysics] Shutdown after " << m_stats.steps << " step(s)\n";
+    }
+
+    void BulletPhysics::CreateBodies(std::span<const PhysicsBodyDesc> descs, std::span<PhysicsBodyHandle> outHandles)
+    {
+        if (!m_state) return;
+
+        for (size_t i = 0; i < descs.size(); ++i)
+        {
+            const PhysicsBodyDesc& desc = descs[i];
+            btCollisionShape* shape = m_state->GetShape(desc.collider, desc.scale);
+
+            PhysicsBodyHandle handle;
+            if (m_state->freeBodies.empty())
+            {
+                handle = static_cast<PhysicsBodyHandle>(m_state->bodies.size());
+                m_state->bodies.emplace_back();
+            }
+            else
+            {
+                handle = m_state->freeBodies.back();
+                m_state->freeBodies.pop_back();
+            }
+            State::BodySlot& slot = m_state->bodies[handle];
+
+            slot.motion = std::make_unique<BodyMotionState>();
+            slot.motion->transform = btTransform(ToBullet(glm::normalize(desc.rotation)), ToBullet(desc.position));
+            slot.motion->sync = &m_state->sync;
+            slot.motion->slot = handle;
+
+            const bool dynamic = desc.body.motion == BodyMotion::Dynamic;
+            const btScalar mass = dynamic ? (desc.body.mass > 0.0f ? desc.body.mass : 1.0f) : 0.0f;
+            btVector3 inertia(0.0f, 0.0f, 0.0f);
+            if (dynamic)
+                shape->calculateLocalInertia(mass, inertia);
+
+            btRigidBody::btRigidBodyConstructionInfo info(mass, slot.motion.get(), shape, inertia);
+            info.m_friction = desc.body.friction;
+            info.m_restitution = desc.body.restitution;
+            info.m_linearDamping = desc.body.linearDamping;
+            info.m_angularDamping = desc.body.angularDamping;
+
+            slot.body = std::make_unique<btRigidBody>(info);
+            btRigidBody* body = slot.body.get();
+            body->setUserIndex(static_cast<int>(desc.entity));
+
+            if (desc.body.motion == BodyMotion::Kinematic)
+            {
+                body->setCollisionFlags(body->getCollisionFlags() | btCollisionObject::CF_KINEMATIC_OBJECT);
+                body->setActivationState(DISABLE_DEACTIVATION);
+            }
+            else if (dynamic)
+            {
+                body->setLinearVelocity(ToBullet(desc.body.linearVelocity));
+                body->setAngularVelocity(ToBullet(desc.body.angularVelocity));
+                if (!desc.body.allowSleep)
+                    body->setActivationState(DISABLE_DEACTIVATION);
+            }
+
+            m_state->world->addRigidBody(body);
+            ++m_state->bodyCount;
+            outHandles[i] = handle;
+        }
+    }
+
+    void BulletPhysics::DestroyBody(PhysicsBodyHandle handle)
+    {
+        if (!m_state) return;
+
+        btRigidBody* body = m_state->GetBody(handle);
+        if (!body) return;
+
+        if (m_state->jointCount > 0)
+        {
+            for (PhysicsJointHandle j = 0; j < m_state->joints.size(); ++j)
+            {
+                const btTypedConstraint* joint = m_state->joints[j].get();
+                if (joint && (&joint->getRigidBodyA() == body || &joint->getRigidBodyB() == body))
+                    m_state->RemoveJoint(j);
+            }
+        }
+
+        m_state->world->removeRigidBody(body);
+
+        // A stale entry in the sync list is skipped because the slot is no longer queued
+        State::BodySlot& slot = m_state->bodies[handle];
+        slot.body.reset();
+        slot.motion.reset();
+        m_state->freeBodies.push_back(handle);
+        --m_state->bodyCount;
+    }
+
+    PhysicsJointHandle BulletPhysics::CreatePointJoint(PhysicsBodyHandle a, PhysicsBodyHandle b, const Vec3& worldPivot)
+    {
+        if (!m_state) return kInvalidPhysicsJoint;
+
+        btRigidBody* bodyA = m_state->GetBody(a);
+        btRigidBody* bodyB = m_state->GetBody(b);
+        if (!bodyA || !bodyB) return kInvalidPhysicsJoint;
+
+        const btVector3 pivot = ToBullet(worldPivot);
+        auto joint = std::make_unique<btPoint2PointConstraint>(*bodyA, *bodyB,
+                                                               bodyA->getCenterOfMassTransform().inverse() * pivot,
+                                                               bodyB->getCenterOfMassTransform().inverse() * pivot);
+
+        // Linked bodies keep colliding with each other, as they do in Jolt
+        m_state->world->addConstraint(joint.get(), false);
+
+        PhysicsJointHandle handle;
+        if (m_state->freeJoints.empty())
+        {
+            handle = static_cast<PhysicsJointHandle>(m_state->joints.size());
+            m_state->joints.push_back(std::move(joint));
+        }
+        else
+        {
+            handle = m_state->freeJoints.back();
+            m_state->freeJoints.pop_back();
+            m_state->joints[handle] = std::move(joint);
+        }
+        ++m_state->jointCount;
+        return handle;
+    }
+
+    void BulletPhysics::DestroyJoint(PhysicsJointHandle handle)
+    {
+        if (!m_state || handle >= m_state->joints.size() || !m_state->joints[handle]) return;
+        m_state->RemoveJoint(handle);
+    }
+
+    void BulletPhysics::MoveKinematic(PhysicsBodyHandle handle, const Vec3& position, const Quat& rotation, float)
+    {
+        if (!m_state || !m_state->GetBody(handle)) return;
+
+        // Bullet derives the kinematic velocity from this target when it next steps
+        m_state->bodies[handle].motion->transform = btTransform(ToBullet(glm::normalize(rotation)), ToBullet(position));
+    }
+
+    void BulletPhysics::SetGravity(const Vec3& gravity)
+    {
+        if (m_state) m_state->world->setGravity(ToBullet(gravity));
+    }
+
+    void BulletPhysics::Step(float dt)
+    {
+        if (!m_state) return;
+
+        m_state->sync.syncedThisStep = 0;
+
+        // No internal sub-stepping or interpolation; PhysicsSystem owns the fixed step
+        const auto start = std::chrono::steady_clock::now();
+        m_state->world->stepSimulation(dt, 0);
+        m_stats.lastStepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        m_stats.activeBodies = m_state->sync.syncedThisStep;
+        ++m_stats.steps;
+    }
+
+    void BulletPhysics::GetActivePoses(std::vector<PhysicsBodyPose>& out)
+    {
+        out.clear();
+        if (!m_state) return;
+
+        out.reserve(m_state->sync.moved.size());
+        for (const uint32_t handle : m_state->sync.moved)
+        {
+            State::BodySlot& slot = m_state->bodies[handle];
+            if (!slot.motion || !slot.motion->queued) continue;
+            slot.motion->queued = false;
+
+            const btTransform& t = slot.motion->transform;
+            const btQuaternion q = t.getRotation();
+
+            PhysicsBodyPose& pose = out.emplace_back();
+            pose.entity = static_cast<uint32_t>(slot.body->getUserIndex());
+            pose.position = FromBullet(t.getOrigin());
+            pose.rotation = Quat(q.w(), q.x(), q.y(), q.z());
+        }
+        m_state->sync.moved.clear();
+    }
+
+    void BulletPhysics::GetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<PhysicsBodyState> out) const
+    {
+        if (!m_state) return;
+
+        for (size_t i = 0; i < handles.size() && i < out.size(); ++i)
+        {
+            const btRigidBody* body = m_state->GetBody(handles[i]);
+            if (!body) continue;
+
+            const btTransform& t = body->getWorldTransform();
+            const btQuaternion q = t.getRotation();
+
+            PhysicsBodyState& state = out[i];
+            state.position = FromBullet(t.getOrigin());
+            state.rotation = Quat(q.w(), q.x(), q.y(), q.z());
+            state.linearVelocity = FromBullet(body->getLinearVelocity());
+            state.angularVelocity = FromBullet(body->getAngularVelocity());
+        }
+    }
+
+    void BulletPhysics::SetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<const PhysicsBodyState> states)
+    {
+        if (!m_state) return;
+
+        for (size_t i = 0; i < handles.size() && i < states.size(); ++i)
+        {
+            btRigidBody* body = m_state->GetBody(handles[i]);
+            if (!body) continue;
+
+            const PhysicsBodyState& state = states[i];
+            const btTransform t(ToBullet(glm::normalize(state.rotation)), ToBullet(state.position));
+
+            // The motion state doubles as the kinematic target, so it has to move with the body
+            body->setWorldTransform(t);
+            body->setInterpolationWorldTransform(t);
+            m_state->bodies[handles[i]].motion->transform = t;
+
+            if (body->isStaticObject()) continue;
+
+            body->setLinearVelocity(ToBullet(state.linearVelocity));
+            body->setAngularVelocity(ToBullet(state.angularVelocity));
+            body->setInterpolationLinearVelocity(ToBullet(state.linearVelocity));
+            body->setInterpolationAngularVelocity(ToBullet(state.angularVelocity));
+            body->clearForces();
+
+            if (glm::dot(state.linearVelocity, state.linearVelocity) > 0.0f || glm::dot(state.angularVelocity, state.angularVelocity) > 0.0f)
+                body->activate(true);
+        }
+    }
+
+    bool BulletPhysics::CastRay(const Vec3& origin, const Vec3& direction, float maxDistance, PhysicsRayHit& outHit) const
+    {
+        if (!m_state) return false;
+
+        const float len = glm::length(direction);
+        if (len <= 0.0f) return false;
+
+        const btVector3 from = ToBullet(origin);
+        const btVector3 to = ToBullet(origin + direction / len * maxDistance);
+        btCollisionWorld::ClosestRayResultCallback result(from, to);
+        m_state->world->rayTest(from, to, result);
+        if (!result.hasHit()) return false;
+
+        outHit.entity = static_cast<uint32_t>(result.m_collisionObject->getUserIndex());
+        outHit.distance = result.m_closestHitFraction * maxDistance;
+        outHit.position = FromBullet(result.m_hitPointWorld);
+        outHit.normal = FromBullet(result.m_hitNormalWorld.normalized());
+        return true;
+    }
+
+    PhysicsStats BulletPhysics::GetStats() const
+    {
+        PhysicsStats stats = m_stats;
+        if (m_state)
+        {
+            stats.bodies = m_state->bodyCount;
+            stats.joints = m_state->jointCount;
+        }
+        stats.memoryBytes = s_liveBytes.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
@@ -0,0 +1,16 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Physics-Bullet/BulletPhysics.h"
+#include "Engine/Physics/Physics.h"
+
+extern "C"
+{
+    ZEDENGINE_API ZED::IPhysics* CreatePhysics()
+    {
+        auto* impl = new ZED::BulletPhysics();
+        ZED::Physics::SetImplementation(impl);
+        return impl;
+    }
+}
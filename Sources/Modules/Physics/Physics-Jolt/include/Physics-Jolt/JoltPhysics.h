@@ -0,0 +1,62 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef JOLTPHYSICS_H
+#define JOLTPHYSICS_H
+
+#pragma once
+
+#include "Engine/Interfaces/Physics/IPhysics.h"
+
+#include <memory>
+
+namespace ZED
+{
+    /**
+     * IPhysics on Jolt Physics.
+     *
+     * Jolt runs on its own JobSystemThreadPool sized by [Physics] Threads, so physics
+     * steps don't queue behind engine jobs. Bodies carry their entity id as user data,
+     * and GetActivePoses() walks Jolt's active body list without taking body locks,
+     * which is safe because it is only called between steps.
+     *
+     * Unverified: Thirdparty/jolt lacks Jolt/Core/Core.h and this backend has not been run on a
+     * stock Jolt build. See Bench-Physics for the open stacking issue.
+     */
+    class ZEDENGINE_API JoltPhysics : public IPhysics
+    {
+    public:
+        JoltPhysics();
+        ~JoltPhysics() override;
+
+        bool Init() override;
+        void Shutdown() override;
+
+        const char* GetName() const override { return "Jolt"; }
+
+        void CreateBodies(std::span<const PhysicsBodyDesc> descs, std::span<PhysicsBodyHandle> outHandles) override;
+        void DestroyBody(PhysicsBodyHandle handle) override;
+        PhysicsJointHandle CreatePointJoint(PhysicsBodyHandle a, PhysicsBodyHandle b, const Vec3& worldPivot) override;
+        void DestroyJoint(PhysicsJointHandle handle) override;
+        void MoveKinematic(PhysicsBodyHandle handle, const Vec3& position, const Quat& rotation, float dt) override;
+        void SetGravity(const Vec3& gravity) override;
+
+        void Step(float dt) override;
+        void GetActivePoses(std::vector<PhysicsBodyPose>& out) override;
+        void GetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<PhysicsBodyState> out) const override;
+        void SetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<const PhysicsBodyState> states) override;
+        bool CastRay(const Vec3& origin, const Vec3& direction, float maxDistance, PhysicsRayHit& outHit) const override;
+
+        PhysicsStats GetStats() const override;
+
+    private:
+        // Jolt types stay out of this header; modules including it don't need Jolt's defines
+        struct State;
+        std::unique_ptr<State> m_state;
+
+        PhysicsStats m_stats;
+    };
+}
+
+#endif
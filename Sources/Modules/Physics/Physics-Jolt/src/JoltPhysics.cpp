@@ -0,0 +1,590 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Physics-Jolt/JoltPhysics.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Physics/Physics.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/RegisterTypes.h>
+#include <Jolt/Core/Factory.h>
+#include <Jolt/Core/TempAllocator.h>
+#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Physics/PhysicsSettings.h>
+#include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/Collision/Shape/CapsuleShape.h>
+#include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/Body/BodyLock.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Constraints/PointConstraint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+
+namespace ZED
+{
+    namespace
+    {
+        // Static geometry only needs to be tested against moving bodies
+        namespace Layers
+        {
+            constexpr JPH::ObjectLayer NonMoving = 0;
+            constexpr JPH::ObjectLayer Moving = 1;
+            constexpr JPH::ObjectLayer Count = 2;
+        }
+
+        namespace BroadPhaseLayers
+        {
+            constexpr JPH::BroadPhaseLayer NonMoving(0);
+            constexpr JPH::BroadPhaseLayer Moving(1);
+            constexpr JPH::uint Count = 2;
+        }
+
+        class BroadPhaseLayerMap final : public JPH::BroadPhaseLayerInterface
+        {
+        public:
+            JPH::uint GetNumBroadPhaseLayers() const override { return BroadPhaseLayers::Count; }
+
+            JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer layer) const override
+            {
+                return layer == Layers::NonMoving ? BroadPhaseLayers::NonMoving : BroadPhaseLayers::Moving;
+            }
+
+        #if defined(JPH_EXTERNAL_PROFILE) || defined(JPH_PROFILE_ENABLED)
+            const char* GetBroadPhaseLayerName(JPH::BroadPhaseLayer layer) const override
+            {
+                return layer == BroadPhaseLayers::NonMoving ? "NonMoving" : "Moving";
+            }
+        #endif
+        };
+
+        class ObjectVsBroadPhaseFilter final : public JPH::ObjectVsBroadPhaseLayerFilter
+        {
+        public:
+            bool ShouldCollide(JPH::ObjectLayer layer, JPH::BroadPhaseLayer bpLayer) const override
+            {
+                return layer == Layers::Moving || bpLayer == BroadPhaseLayers::Moving;
+            }
+        };
+
+        class ObjectPairFilter final : public JPH::ObjectLayerPairFilter
+        {
+        public:
+            bool ShouldCollide(JPH::ObjectLayer a, JPH::ObjectLayer b) const override
+            {
+                return a == Layers::Moving || b == Layers::Moving;
+            }
+        };
+
+        void TraceImpl(const char* fmt, ...)
+        {
+            va_list args;
+            va_start(args, fmt);
+            char buffer[1024];
+            vsnprintf(buffer, sizeof(buffer), fmt, args);
+            va_end(args);
+            std::cout << "[ZED::JoltPhysics] " << buffer << "\n";
+        }
+
+    #ifdef JPH_ENABLE_ASSERTS
+        bool AssertFailedImpl(const char* expression, const char* message, const char* file, JPH::uint line)
+        {
+            std::cerr << "[ZED::JoltPhysics] " << file << ":" << line << ": (" << expression << ") "
+                      << (message ? message : "") << "\n";
+            return true; // break into the debugger
+        }
+    #endif
+
+        // Jolt allocator hooks that count live bytes for PhysicsStats::memoryBytes.
+        // Every block carries its size and the raw malloc pointer in the 16 bytes before it.
+        std::atomic<size_t> s_liveBytes{ 0 };
+
+        void* TrackedAlignedAllocate(size_t size, size_t alignment)
+        {
+            alignment = std::max<size_t>(alignment, 16);
+            void* raw = std::malloc(size + alignment + 16);
+            if (!raw) return nullptr;
+
+            const uintptr_t user = (reinterpret_cast<uintptr_t>(raw) + 16 + alignment - 1) & ~(uintptr_t)(alignment - 1);
+            reinterpret_cast<void**>(user)[-2] = raw;
+            reinterpret_cast<size_t*>(user)[-1] = size;
+            s_liveBytes.fetch_add(size, std::memory_order_relaxed);
+            return reinterpret_cast<void*>(user);
+        }
+
+        void TrackedFree(void* block)
+        {
+            if (!block) return;
+            s_liveBytes.fetch_sub(static_cast<size_t*>(block)[-1], std::memory_order_relaxed);
+            std::free(static_cast<void**>(block)[-2]);
+        }
+
+        void* TrackedAllocate(size_t size)
+        {
+            return TrackedAlignedAllocate(size, 16);
+        }
+
+        void* TrackedReallocate(void* block, size_t oldSize, size_t newSize)
+        {
+            void* moved = TrackedAllocate(newSize);
+            if (moved && block)
+                std::memcpy(moved, block, std::min(oldSize, newSize));
+            TrackedFree(block);
+            return moved;
+        }
+
+        // Identical colliders (a pile of the same box) share one shape
+        struct ShapeKey
+        {
+            ColliderShape shape;
+            float a, b, c;
+
+            bool operator==(const ShapeKey&) const = default;
+        };
+
+        struct ShapeKeyHash
+        {
+            size_t operator()(const ShapeKey& k) const
+            {
+                size_t h = std::hash<float>()(k.a);
+                h = h * 31 + std::hash<float>()(k.b);
+                h = h * 31 + std::hash<float>()(k.c);
+                return h * 31 + static_cast<size_t>(k.shape);
+            }
+        };
+
+        // Registration is process-wide; keep it alive as long as any JoltPhysics is initialized
+        int s_joltUsers = 0;
+
+        inline JPH::Vec3 ToJolt(const Vec3& v) { return JPH::Vec3(v.x, v.y, v.z); }
+        inline JPH::Quat ToJolt(const Quat& q) { return JPH::Quat(q.x, q.y, q.z, q.w); }
+    }
+
+    struct JoltPhysics::State
+    {
+        std::unique_ptr<JPH::TempAllocatorImpl> tempAllocator;
+        std::unique_ptr<JPH::JobSystemThreadPool> jobSystem;
+
+        BroadPhaseLayerMap broadPhaseLayers;
+        ObjectVsBroadPhaseFilter objectVsBroadPhase;
+        ObjectPairFilter objectPairs;
+        JPH::PhysicsSystem system;
+
+        std::unordered_map<ShapeKey, JPH::ShapeRefC, ShapeKeyHash> shapes;
+        JPH::BodyIDVector addBatch;
+        bool broadPhaseDirty = false;
+
+        // Joint handle = slot index; null slots are reused through freeJoints
+        std::vector<JPH::Ref<JPH::TwoBodyConstraint>> joints;
+        std::vector<PhysicsJointHandle> freeJoints;
+        uint32_t jointCount = 0;
+
+        void RemoveJoint(PhysicsJointHandle handle)
+        {
+            system.RemoveConstraint(joints[handle]);
+            joints[handle] = nullptr;
+            freeJoints.push_back(handle);
+            --jointCount;
+        }
+
+        JPH::ShapeRefC GetShape(const ColliderComponent& col, const Vec3& scale)
+        {
+            const Vec3 s = glm::abs(scale);
+
+            ShapeKey key{ col.shape, 0.0f, 0.0f, 0.0f };
+            switch (col.shape)
+            {
+            case ColliderShape::Box:
+            {
+                const Vec3 he = col.halfExtents * s;
+                key.a = he.x; key.b = he.y; key.c = he.z;
+                break;
+            }
+            case ColliderShape::Sphere:
+                key.a = col.radius * std::max({ s.x, s.y, s.z });
+                break;
+            case ColliderShape::Capsule:
+                key.a = col.radius * std::max(s.x, s.z);
+                key.b = col.halfHeight * s.y;
+                break;
+            }
+
+            auto it = shapes.find(key);
+            if (it != shapes.end()) return it->second;
+
+            JPH::ShapeRefC shape;
+            switch (col.shape)
+            {
+            case ColliderShape::Box:
+            {
+                // Jolt needs the convex radius to fit inside the box
+                const float minHalf = std::min({ key.a, key.b, key.c });
+                shape = new JPH::BoxShape(JPH::Vec3(key.a, key.b, key.c), std::min(JPH::cDefaultConvexRadius, minHalf));
+                break;
+            }
+            case ColliderShape::Sphere:
+                shape = new JPH::SphereShape(key.a);
+                break;
+            case ColliderShape::Capsule:
+                shape = new JPH::CapsuleShape(key.b, key.a);
+                break;
+            }
+
+            shapes.emplace(key, shape);
+            return shape;
+        }
+    };
+
+    JoltPhysics::JoltPhysics() = default;
+
+    JoltPhysics::~JoltPhysics()
+    {
+        Shutdown();
+
+        // Component destroy hooks may still run after the backend is gone
+        if (Physics::Get() == this)
+            Physics::SetImplementation(nullptr);
+    }
+
+    bool JoltPhysics::Init()
+    {
+        if (m_state) return true;
+
+        if (s_joltUsers++ == 0)
+        {
+            JPH::Allocate = TrackedAllocate;
+            JPH::Reallocate = TrackedReallocate;
+            JPH::Free = TrackedFree;
+            JPH::AlignedAllocate = TrackedAlignedAllocate;
+            JPH::AlignedFree = TrackedFree;
+            JPH::Trace = TraceImpl;
+            JPH_IF_ENABLE_ASSERTS(JPH::AssertFailed = AssertFailedImpl;)
+            JPH::Factory::sInstance = new JPH::Factory();
+            JPH::RegisterTypes();
+        }
+
+        const auto& ini = Config::Get();
+        const long threads = ini.GetLongValue("Physics", "Threads", 0);
+        const long maxBodies = ini.GetLongValue("Physics", "MaxBodies", 65536);
+        const long maxBodyPairs = ini.GetLongValue("Physics", "MaxBodyPairs", 65536);
+        const long maxContacts = ini.GetLongValue("Physics", "MaxContactConstraints", 65536);
+        long tempMB = ini.GetLongValue("Physics", "TempAllocatorMB", 0);
+
+        // The contact constraint buffer (~1 KB per constraint) comes out of the per-step temp allocator
+        if (tempMB <= 0)
+            tempMB = 16 + maxContacts / 1024;
+
+        int workerCount = static_cast<int>(threads);
+        if (workerCount <= 0)
+        {
+            const unsigned hw = std::thread::hardware_concurrency();
+            workerCount = hw > 1 ? static_cast<int>(hw) - 1 : 0;
+        }
+
+        m_state = std::make_unique<State>();
+        m_state->tempAllocator = std::make_unique<JPH::TempAllocatorImpl>(static_cast<size_t>(tempMB) * 1024 * 1024);
+        m_state->jobSystem = std::make_unique<JPH::JobSystemThreadPool>(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, workerCount);
+
+        m_state->system.Init(static_cast<JPH::uint>(maxBodies), 0,
+                             static_cast<JPH::uint>(maxBodyPairs), static_cast<JPH::uint>(maxContacts),
+                             m_state->broadPhaseLayers, m_state->objectVsBroadPhase, m_state->objectPairs);
+
+        const Vec3 gravity(static_cast<float>(ini.GetDoubleValue("Physics", "GravityX", 0.0)),
+                           static_cast<float>(ini.GetDoubleValue("Physics", "GravityY", -9.81)),
+                           static_cast<float>(ini.GetDoubleValue("Physics", "GravityZ", 0.0)));
+        SetGravity(gravity);
+
+        JPH::PhysicsSettings settings = m_state->system.GetPhysicsSettings();
+        settings.mNumVelocitySteps = static_cast<JPH::uint>(std::max(1L, ini.GetLongValue("Physics", "SolverIterations", 10)));
+        settings.mTimeBeforeSleep = static_cast<float>(ini.GetDoubleValue("Physics", "TimeBeforeSleep", 0.5));
+        m_state->system.SetPhysicsSettings(settings);
+
+        m_stats = PhysicsStats{};
+        std::cout << "[ZED::JoltPhysics] Initialized (" << workerCount << " worker thread(s), " << maxBodies << " max bodies)\n";
+        return true;
+    }
+
+    void JoltPhysics::Shutdown()
+    {
+        if (!m_state) return;
+
+        // Bodies still in the system are destroyed with it
+        m_state.reset();
+
+        if (--s_joltUsers == 0)
+        {
+            JPH::UnregisterTypes();
+            delete JPH::Factory::sInstance;
+            JPH::Factory::sInstance = nullptr;
+        }
+
+        std::cout << "[ZED::JoltPhysics] Shutdown after " << m_stats.steps << " step(s)\n";
+    }
+
+    void JoltPhysics::CreateBodies(std::span<const PhysicsBodyDesc> descs, std::span<PhysicsBodyHandle> outHandles)
+    {
+        if (!m_state) return;
+
+        JPH::BodyInterface& bodies = m_state->system.GetBodyInterface();
+        JPH::BodyIDVector& batch = m_state->addBatch;
+        batch.clear();
+
+        for (size_t i = 0; i < descs.size(); ++i)
+        {
+            const PhysicsBodyDesc& desc = descs[i];
+            outHandles[i] = kInvalidPhysicsBody;
+
+            JPH::EMotionType motion = JPH::EMotionType::Dynamic;
+            if (desc.body.motion == BodyMotion::Static) motion = JPH::EMotionType::Static;
+            else if (desc.body.motion == BodyMotion::Kinematic) motion = JPH::EMotionType::Kinematic;
+
+            JPH::BodyCreationSettings settings(m_state->GetShape(desc.collider, desc.scale),
+                                               JPH::RVec3(desc.position.x, desc.position.y, desc.position.z),
+                                               ToJolt(glm::normalize(desc.rotation)), motion,
+                                               motion == JPH::EMotionType::Static ? Layers::NonMoving : Layers::Moving);
+
+            settings.mUserData = desc.entity;
+            settings.mFriction = desc.body.friction;
+            settings.mRestitution = desc.body.restitution;
+            settings.mLinearDamping = desc.body.linearDamping;
+            settings.mAngularDamping = desc.body.angularDamping;
+            settings.mAllowSleeping = desc.body.allowSleep;
+            settings.mLinearVelocity = ToJolt(desc.body.linearVelocity);
+            settings.mAngularVelocity = ToJolt(desc.body.angularVelocity);
+
+            if (motion == JPH::EMotionType::Dynamic && desc.body.mass > 0.0f)
+            {
+                settings.mOverrideMassProperties = JPH::EOverrideMassProperties::CalculateInertia;
+                settings.mMassPropertiesOverride.mMass = desc.body.mass;
+            }
+
+            JPH::Body* body = bodies.CreateBody(settings);
+            if (!body)
+            {
+                std::cerr << "[ZED::JoltPhysics] Out of bodies (raise [Physics] MaxBodies)\n";
+                break;
+            }
+
+            batch.push_back(body->GetID());
+            outHandles[i] = body->GetID().GetIndexAndSequenceNumber();
+        }
+
+        if (batch.empty()) return;
+
+        // One broadphase insertion for the whole batch instead of one per body
+        const int count = static_cast<int>(batch.size());
+        JPH::BodyInterface::AddState state = bodies.AddBodiesPrepare(batch.data(), count);
+        bodies.AddBodiesFinalize(batch.data(), count, state, JPH::EActivation::Activate);
+        m_state->broadPhaseDirty = true;
+    }
+
+    void JoltPhysics::DestroyBody(PhysicsBodyHandle handle)
+    {
+        if (!m_state || handle == kInvalidPhysicsBody) return;
+
+        JPH::BodyInterface& bodies = m_state->system.GetBodyInterface();
+        const JPH::BodyID id(handle);
+
+        // Constraints keep raw body pointers, so they have to go first
+        if (m_state->jointCount > 0)
+        {
+            for (PhysicsJointHandle j = 0; j < m_state->joints.size(); ++j)
+            {
+                const JPH::TwoBodyConstraint* joint = m_state->joints[j];
+                if (joint && (joint->GetBody1()->GetID() == id || joint->GetBody2()->GetID() == id))
+                    m_state->RemoveJoint(j);
+            }
+        }
+
+        if (bodies.IsAdded(id))
+            bodies.RemoveBody(id);
+        bodies.DestroyBody(id);
+    }
+
+    PhysicsJointHandle JoltPhysics::CreatePointJoint(PhysicsBodyHandle a, PhysicsBodyHandle b, const Vec3& worldPivot)
+    {
+        if (!m_state || a == kInvalidPhysicsBody || b == kInvalidPhysicsBody) return kInvalidPhysicsJoint;
+
+        JPH::PointConstraintSettings settings;
+        settings.mSpace = JPH::EConstraintSpace::WorldSpace;
+        settings.mPoint1 = settings.mPoint2 = JPH::RVec3(worldPivot.x, worldPivot.y, worldPivot.z);
+
+        JPH::TwoBodyConstraint* joint = m_state->system.GetBodyInterface().CreateConstraint(&settings, JPH::BodyID(a), JPH::BodyID(b));
+        if (!joint) return kInvalidPhysicsJoint;
+        m_state->system.AddConstraint(joint);
+
+        PhysicsJointHandle handle;
+        if (m_state->freeJoints.empty())
+        {
+            handle = static_cast<PhysicsJointHandle>(m_state->joints.size());
+            m_state->joints.emplace_back(joint);
+        }
+        else
+        {
+            handle = m_state->freeJoints.back();
+            m_state->freeJoints.pop_back();
+            m_state->joints[handle] = joint;
+        }
+        ++m_state->jointCount;
+        return handle;
+    }
+
+    void JoltPhysics::DestroyJoint(PhysicsJointHandle handle)
+    {
+        if (!m_state || handle >= m_state->joints.size() || !m_state->joints[handle]) return;
+        m_state->RemoveJoint(handle);
+    }
+
+    void JoltPhysics::MoveKinematic(PhysicsBodyHandle handle, const Vec3& position, const Quat& rotation, float dt)
+    {
+        if (!m_state || handle == kInvalidPhysicsBody) return;
+
+        m_state->system.GetBodyInterface().MoveKinematic(JPH::BodyID(handle),
+                                                         JPH::RVec3(position.x, position.y, position.z),
+                                                         ToJolt(glm::normalize(rotation)), dt);
+    }
+
+    void JoltPhysics::SetGravity(const Vec3& gravity)
+    {
+        if (m_state) m_state->system.SetGravity(ToJolt(gravity));
+    }
+
+    void JoltPhysics::Step(float dt)
+    {
+        if (!m_state) return;
+
+        // Large batches land in an unbalanced tree; rebuild it once before stepping
+        if (m_state->broadPhaseDirty)
+        {
+            m_state->system.OptimizeBroadPhase();
+            m_state->broadPhaseDirty = false;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const JPH::EPhysicsUpdateError error = m_state->system.Update(dt, 1, m_state->tempAllocator.get(), m_state->jobSystem.get());
+        m_stats.lastStepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        ++m_stats.steps;
+
+        if (error != JPH::EPhysicsUpdateError::None)
+            std::cerr << "[ZED::JoltPhysics] Step reported error flags " << static_cast<uint32_t>(error) << " (raise the [Physics] limits)\n";
+    }
+
+    void JoltPhysics::GetActivePoses(std::vector<PhysicsBodyPose>& out)
+    {
+        out.clear();
+        if (!m_state) return;
+
+        const JPH::PhysicsSystem& system = m_state->system;
+        const JPH::uint32 count = system.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+        const JPH::BodyID* active = system.GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
+        const JPH::BodyLockInterfaceNoLock& locks = system.GetBodyLockInterfaceNoLock();
+
+        out.resize(count);
+        for (JPH::uint32 i = 0; i < count; ++i)
+        {
+            const JPH::Body* body = locks.TryGetBody(active[i]);
+            const JPH::RVec3 p = body->GetPosition();
+            const JPH::Quat q = body->GetRotation();
+
+            PhysicsBodyPose& pose = out[i];
+            pose.entity = static_cast<uint32_t>(body->GetUserData());
+            pose.position = Vec3(static_cast<float>(p.GetX()), static_cast<float>(p.GetY()), static_cast<float>(p.GetZ()));
+            pose.rotation = Quat(q.GetW(), q.GetX(), q.GetY(), q.GetZ());
+        }
+    }
+
+    void JoltPhysics::GetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<PhysicsBodyState> out) const
+    {
+        if (!m_state) return;
+
+        // Between steps nothing else touches the bodies, so skip the per-body locks
+        const JPH::BodyLockInterfaceNoLock& locks = m_state->system.GetBodyLockInterfaceNoLock();
+        for (size_t i = 0; i < handles.size() && i < out.size(); ++i)
+        {
+            if (handles[i] == kInvalidPhysicsBody) continue;
+
+            const JPH::Body* body = locks.TryGetBody(JPH::BodyID(handles[i]));
+            if (!body) continue;
+
+            const JPH::RVec3 p = body->GetPosition();
+            const JPH::Quat q = body->GetRotation();
+            const JPH::Vec3 v = body->GetLinearVelocity();
+            const JPH::Vec3 w = body->GetAngularVelocity();
+
+            PhysicsBodyState& state = out[i];
+            state.position = Vec3(static_cast<float>(p.GetX()), static_cast<float>(p.GetY()), static_cast<float>(p.GetZ()));
+            state.rotation = Quat(q.GetW(), q.GetX(), q.GetY(), q.GetZ());
+            state.linearVelocity = Vec3(v.GetX(), v.GetY(), v.GetZ());
+            state.angularVelocity = Vec3(w.GetX(), w.GetY(), w.GetZ());
+        }
+    }
+
+    void JoltPhysics::SetBodyStates(std::span<const PhysicsBodyHandle> handles, std::span<const PhysicsBodyState> states)
+    {
+        if (!m_state) return;
+
+        JPH::BodyInterface& bodies = m_state->system.GetBodyInterface();
+        for (size_t i = 0; i < handles.size() && i < states.size(); ++i)
+        {
+            if (handles[i] == kInvalidPhysicsBody) continue;
+
+            const PhysicsBodyState& state = states[i];
+            bodies.SetPositionRotationAndVelocity(JPH::BodyID(handles[i]),
+                                                  JPH::RVec3(state.position.x, state.position.y, state.position.z),
+                                                  ToJolt(glm::normalize(state.rotation)),
+                                                  ToJolt(state.linearVelocity), ToJolt(state.angularVelocity));
+        }
+    }
+
+    bool JoltPhysics::CastRay(const Vec3& origin, const Vec3& direction, float maxDistance, PhysicsRayHit& outHit) const
+    {
+        if (!m_state) return false;
+
+        const float len = glm::length(direction);
+        if (len <= 0.0f) return false;
+        const Vec3 dir = direction / len;
+
+        // Jolt's ray length is the direction vector; the hit comes back as a fraction of it
+        const JPH::RRayCast ray(JPH::RVec3(origin.x, origin.y, origin.z), ToJolt(dir * maxDistance));
+        JPH::RayCastResult result;
+        if (!m_state->system.GetNarrowPhaseQuery().CastRay(ray, result))
+            return false;
+
+        const JPH::BodyLockRead lock(m_state->system.GetBodyLockInterfaceNoLock(), result.mBodyID);
+        if (!lock.Succeeded()) return false;
+
+        const JPH::RVec3 point = ray.GetPointOnRay(result.mFraction);
+        const JPH::Vec3 normal = lock.GetBody().GetWorldSpaceSurfaceNormal(result.mSubShapeID2, point);
+
+        outHit.entity = static_cast<uint32_t>(lock.GetBody().GetUserData());
+        outHit.distance = result.mFraction * maxDistance;
+        outHit.position = Vec3(static_cast<float>(point.GetX()), static_cast<float>(point.GetY()), static_cast<float>(point.GetZ()));
+        outHit.normal = Vec3(normal.GetX(), normal.GetY(), normal.GetZ());
+        return true;
+    }
+
+    PhysicsStats JoltPhysics::GetStats() const
+    {
+        PhysicsStats stats = m_stats;
+        if (m_state)
+        {
+            stats.bodies = m_state->system.GetNumBodies();
+            stats.activeBodies = m_state->system.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+            stats.joints = m_state->jointCount;
+        }
+        stats.memoryBytes = s_liveBytes.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
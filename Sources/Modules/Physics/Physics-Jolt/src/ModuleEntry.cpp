@@ -0,0 +1,16 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Physics-Jolt/JoltPhysics.h"
+#include "Engine/Physics/Physics.h"
+
+extern "C"
+{
+    ZEDENGINE_API ZED::IPhysics* CreatePhysics()
+    {
+        auto* impl = new ZED::JoltPhysics();
+        ZED::Physics::SetImplementation(impl);
+        return impl;
+    }
+}
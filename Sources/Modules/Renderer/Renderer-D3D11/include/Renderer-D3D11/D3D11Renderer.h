@@ -31,6 +31,7 @@ namespace ZED
 
         void BeginFrame(float r, float g, float b, float a, const Mat4& view, const Mat4& proj) override;
         void DrawCube(const Mat4& model) override;
+        void DrawCubes(std::span<const Mat4> models) override;
         //void DrawTestCube(float timeSeconds) override;
         void EndFrame() override;
 
@@ -43,6 +44,9 @@ namespace ZED
         bool CreatePipeline();
         bool CreateCubeGeometry();
 
+        // Grow the per-instance vertex buffer so it holds at least 'count' matrices
+        bool EnsureInstanceCapacity(UINT count);
+
         // Shader compile helper (instance method)
         bool CompileShader(const char* source, const char* entry, const char* target, Microsoft::WRL::ComPtr<ID3DBlob>& outBlob);
 
@@ -66,6 +70,11 @@ namespace ZED
         Microsoft::WRL::ComPtr<ID3D11PixelShader> m_ps;
         Microsoft::WRL::ComPtr<ID3D11InputLayout> m_layout;
 
+        // Instanced variant: model matrix comes from vertex buffer slot 1 instead of b1
+        Microsoft::WRL::ComPtr<ID3D11VertexShader> m_vsInstanced;
+        Microsoft::WRL::ComPtr<ID3D11InputLayout> m_layoutInstanced;
+        bool m_instancedBound = false;
+
         // Constant buffers
         struct CBFrame { float view[16]; float proj[16]; };
         struct CBObject { float model[16]; };
@@ -80,6 +89,10 @@ namespace ZED
         Microsoft::WRL::ComPtr<ID3D11Buffer> m_vb;
         Microsoft::WRL::ComPtr<ID3D11Buffer> m_ib;
         UINT m_indexCount = 0;
+
+        // Dynamic per-instance model matrices, rewritten with WRITE_DISCARD for every DrawCubes batch
+        Microsoft::WRL::ComPtr<ID3D11Buffer> m_instanceVB;
+        UINT m_instanceCapacity = 0;
     };
 }
 
@@ -3,6 +3,7 @@
  */
 
 #include "Renderer-D3D11/D3D11Renderer.h"
+#include <algorithm>
 #include <cstring>
 #include <cmath>
 #include <iostream>
@@ -50,6 +51,46 @@ VSOut main(VSIn input)
 }
 )";
 
+	// Same as kVS, but the model matrix is streamed per instance (four columns, slot 1)
+	static const char* kVSInstanced = R"(
+cbuffer CBFrame  : register(b0)
+{
+	float4x4 u_View;
+	float4x4 u_Proj;
+};
+
+struct VSIn
+{
+	float3 pos    : POSITION;
+	float3 col    : COLOR;
+	float4 model0 : MODEL0;
+	float4 model1 : MODEL1;
+	float4 model2 : MODEL2;
+	float4 model3 : MODEL3;
+};
+
+struct VSOut
+{
+	float4 pos : SV_Position;
+	float3 col : COLOR;
+};
+
+VSOut main(VSIn input)
+{
+	VSOut o;
+	// Columns arrive in GLM order, so M * p is a weighted sum of them
+	float4 wpos = input.model0 * input.pos.x + input.model1 * input.pos.y + input.model2 * input.pos.z + input.model3;
+	float4 vpos = mul(u_View, wpos);
+	o.pos = mul(u_Proj, vpos);
+	o.col = input.col;
+	return o;
+}
+)";
+
+	// Instances the buffer starts with; it grows by doubling after that
+	static constexpr UINT kInitialInstanceCapacity = 1024;
+	static_assert(sizeof(ZED::Mat4) == sizeof(float) * 16, "Instance stream expects tightly packed 4x4 float matrices");
+
 	static const char* kPS = R"(
 struct PSIn
 {
@@ -156,12 +197,21 @@ float4 main(PSIn input) : SV_Target
 		m_context->VSSetShader(m_vs.Get(), nullptr, 0);
 		m_context->PSSetShader(m_ps.Get(), nullptr, 0);
 		m_context->VSSetConstantBuffers(0, 1, m_cbFrame.GetAddressOf()); // b0
+		m_instancedBound = false;
 	}
 
 	void D3D11Renderer::DrawCube(const ZED::Mat4& model)
 	{
 		if (!m_context) return;
 
+		// A DrawCubes batch earlier in the frame left the instanced pipeline bound
+		if (m_instancedBound)
+		{
+			m_context->IASetInputLayout(m_layout.Get());
+			m_context->VSSetShader(m_vs.Get(), nullptr, 0);
+			m_instancedBound = false;
+		}
+
 		// Upload object constants
 		if (m_cbObject)
 		{
@@ -187,6 +237,70 @@ float4 main(PSIn input) : SV_Target
 		m_context->DrawIndexed(m_indexCount, 0, 0);
 	}
 
+	void D3D11Renderer::DrawCubes(std::span<const ZED::Mat4> models)
+	{
+		if (!m_context || models.empty()) return;
+
+		const UINT count = static_cast<UINT>(models.size());
+		if (!EnsureInstanceCapacity(count))
+		{
+			// Could not grow the instance buffer, fall back to one draw per cube
+			IRenderer::DrawCubes(models);
+			return;
+		}
+
+		// One upload for the whole batch
+		D3D11_MAPPED_SUBRESOURCE mapped{};
+		if (FAILED(m_context->Map(m_instanceVB.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+			return;
+		std::memcpy(mapped.pData, models.data(), sizeof(ZED::Mat4) * count);
+		m_context->Unmap(m_instanceVB.Get(), 0);
+
+		if (!m_instancedBound)
+		{
+			m_context->IASetInputLayout(m_layoutInstanced.Get());
+			m_context->VSSetShader(m_vsInstanced.Get(), nullptr, 0);
+			m_instancedBound = true;
+		}
+
+		// Slot 0: cube vertices, slot 1: per-instance model matrices
+		ID3D11Buffer* buffers[2] = { m_vb.Get(), m_instanceVB.Get() };
+		UINT strides[2] = { sizeof(float) * 6, sizeof(ZED::Mat4) };
+		UINT offsets[2] = { 0, 0 };
+		m_context->IASetVertexBuffers(0, 2, buffers, strides, offsets);
+		m_context->IASetIndexBuffer(m_ib.Get(), DXGI_FORMAT_R32_UINT, 0);
+
+		m_context->DrawIndexedInstanced(m_indexCount, count, 0, 0, 0);
+	}
+
+	bool D3D11Renderer::EnsureInstanceCapacity(UINT count)
+	{
+		if (m_instanceVB && count <= m_instanceCapacity)
+			return true;
+
+		UINT capacity = std::max(m_instanceCapacity, kInitialInstanceCapacity);
+		while (capacity < count)
+			capacity *= 2;
+
+		D3D11_BUFFER_DESC bd{};
+		bd.ByteWidth = static_cast<UINT>(sizeof(ZED::Mat4)) * capacity;
+		bd.Usage = D3D11_USAGE_DYNAMIC;
+		bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		ComPtr<ID3D11Buffer> buffer;
+		HRESULT hr = m_device->CreateBuffer(&bd, nullptr, buffer.GetAddressOf());
+		if (FAILED(hr))
+		{
+			std::cerr << "[D3D11Renderer] CreateBuffer(instances) failed: 0x" << std::hex << hr << std::dec << "\n";
+			return false;
+		}
+
+		m_instanceVB = buffer;
+		m_instanceCapacity = capacity;
+		return true;
+	}
+
 	void D3D11Renderer::EndFrame()
 	{
 		if (m_swapChain)
@@ -207,8 +321,12 @@ float4 main(PSIn input) : SV_Target
 
 		m_vb.Reset();
 		m_ib.Reset();
+		m_instanceVB.Reset();
+		m_instanceCapacity = 0;
 		m_layout.Reset();
+		m_layoutInstanced.Reset();
 		m_vs.Reset();
+		m_vsInstanced.Reset();
 		m_ps.Reset();
 		m_cbFrame.Reset();
 		m_cbObject.Reset();
@@ -369,6 +487,25 @@ float4 main(PSIn input) : SV_Target
 		if (FAILED(m_device->CreateInputLayout(il, 2, vsb->GetBufferPointer(), vsb->GetBufferSize(), m_layout.GetAddressOf())))
 			return false;
 
+		// Instanced pipeline: same vertex stream plus one mat4 per instance in slot 1
+		ComPtr<ID3DBlob> vsib;
+		if (!CompileShader(kVSInstanced, "main", "vs_5_0", vsib))
+			return false;
+		if (FAILED(m_device->CreateVertexShader(vsib->GetBufferPointer(), vsib->GetBufferSize(), nullptr, m_vsInstanced.GetAddressOf())))
+			return false;
+
+		D3D11_INPUT_ELEMENT_DESC ili[] =
+		{
+			{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,	 0, 0,								D3D11_INPUT_PER_VERTEX_DATA,	0 },
+			{ "COLOR",	 0, DXGI_FORMAT_R32G32B32_FLOAT,	 0, sizeof(float)*3,					D3D11_INPUT_PER_VERTEX_DATA,	0 },
+			{ "MODEL",	 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0,								D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "MODEL",	 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, sizeof(float)*4,					D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "MODEL",	 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, sizeof(float)*8,					D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "MODEL",	 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, sizeof(float)*12,				D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		};
+		if (FAILED(m_device->CreateInputLayout(ili, 6, vsib->GetBufferPointer(), vsib->GetBufferSize(), m_layoutInstanced.GetAddressOf())))
+			return false;
+
 		// Constant buffers
 		{
 			D3D11_BUFFER_DESC bd{};
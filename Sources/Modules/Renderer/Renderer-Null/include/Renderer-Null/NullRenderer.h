@@ -0,0 +1,76 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef NULLRENDERER_H
+#define NULLRENDERER_H
+
+#pragma once
+
+#include "Engine/Interfaces/Renderer/IRenderer.h"
+#include "Engine/Math/Math.h"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace ZED
+{
+    // Counters gathered by the null renderer; nothing is ever submitted to a GPU
+    struct NullRenderStats
+    {
+        uint64_t frames = 0;
+        uint64_t drawCalls = 0;        // total over all frames; an instanced batch is one call
+        uint64_t instancedBatches = 0; // DrawCubes() submissions
+        uint64_t submissions = 0;      // SubmitBatches() calls (one per flushed RenderQueue)
+        uint64_t unsortedBatches = 0;  // batches whose state key went backwards within a submission
+        uint64_t instances = 0;        // cubes drawn, whichever path submitted them
+        uint32_t frameDrawCalls = 0;   // draws in the frame currently being recorded
+        uint32_t frameInstances = 0;
+        uint32_t lastFrameDrawCalls = 0;
+        uint32_t lastFrameInstances = 0;
+        uint32_t peakFrameDrawCalls = 0;
+    };
+
+    /**
+     * IRenderer that records what would have been drawn instead of drawing it.
+     * Used for dedicated servers, CI and benchmarks where there is no window
+     * or graphics device. Init() accepts a null native handle.
+     */
+    class ZEDENGINE_API NullRenderer : public IRenderer
+    {
+    public:
+        bool Init(void* nativeHandle, int width, int height) override;
+        void Resize(int width, int height) override;
+
+        void BeginFrame(float r, float g, float b, float a, const Mat4& view, const Mat4& proj) override;
+        void DrawCube(const Mat4& model) override;
+        void DrawCubes(std::span<const Mat4> models) override;
+        void SubmitBatches(std::span<const RenderBatch> batches) override;
+        void EndFrame() override;
+
+        void Shutdown() override;
+
+        const NullRenderStats& GetStats() const { return m_stats; }
+
+        // State key and instance count of every batch in the most recent SubmitBatches() call
+        struct RecordedBatch
+        {
+            uint64_t stateKey = 0;
+            uint32_t instances = 0;
+        };
+        const std::vector<RecordedBatch>& GetLastSubmission() const { return m_lastSubmission; }
+
+    private:
+        NullRenderStats m_stats;
+        std::vector<RecordedBatch> m_lastSubmission;
+
+        int m_width = 0;
+        int m_height = 0;
+        bool m_inFrame = false;
+
+        std::chrono::steady_clock::time_point m_startTime;
+    };
+}
+
+#endif
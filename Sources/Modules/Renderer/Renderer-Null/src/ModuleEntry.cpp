@@ -0,0 +1,16 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Renderer-Null/NullRenderer.h"
+#include "Engine/Renderer/Renderer.h"
+
+extern "C"
+{
+    ZEDENGINE_API ZED::IRenderer* CreateRenderer()
+    {
+        auto* impl = new ZED::NullRenderer();
+        ZED::Renderer::SetImplementation(impl);
+        return impl;
+    }
+}
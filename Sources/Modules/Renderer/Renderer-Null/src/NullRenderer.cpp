@@ -0,0 +1,109 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Renderer-Null/NullRenderer.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace ZED
+{
+    bool NullRenderer::Init(void*, int width, int height)
+    {
+        m_width = width;
+        m_height = height;
+        m_stats = {};
+        m_startTime = std::chrono::steady_clock::now();
+
+        std::cout << "[ZED::NullRenderer] Initialized (" << width << "x" << height << ", no output)\n";
+        return true;
+    }
+
+    void NullRenderer::Resize(int width, int height)
+    {
+        m_width = width;
+        m_height = height;
+    }
+
+    void NullRenderer::BeginFrame(float, float, float, float, const Mat4&, const Mat4&)
+    {
+        if (m_inFrame)
+        {
+            std::cerr << "[ZED::NullRenderer] BeginFrame called twice without EndFrame\n";
+        }
+
+        m_inFrame = true;
+        m_stats.frameDrawCalls = 0;
+        m_stats.frameInstances = 0;
+    }
+
+    void NullRenderer::DrawCube(const Mat4&)
+    {
+        ++m_stats.frameDrawCalls;
+        ++m_stats.frameInstances;
+        ++m_stats.drawCalls;
+        ++m_stats.instances;
+    }
+
+    void NullRenderer::DrawCubes(std::span<const Mat4> models)
+    {
+        if (models.empty()) return;
+
+        const auto count = static_cast<uint32_t>(models.size());
+        ++m_stats.frameDrawCalls;
+        m_stats.frameInstances += count;
+        ++m_stats.drawCalls;
+        ++m_stats.instancedBatches;
+        m_stats.instances += count;
+    }
+
+    void NullRenderer::SubmitBatches(std::span<const RenderBatch> batches)
+    {
+        ++m_stats.submissions;
+        m_lastSubmission.clear();
+
+        for (size_t i = 0; i < batches.size(); ++i)
+        {
+            const RenderBatch& batch = batches[i];
+            if (i > 0 && batch.stateKey < batches[i - 1].stateKey)
+            {
+                ++m_stats.unsortedBatches;
+            }
+
+            m_lastSubmission.push_back({ batch.stateKey, static_cast<uint32_t>(batch.models.size()) });
+        }
+
+        // Count the draws the same way a backend without a batch override would issue them
+        IRenderer::SubmitBatches(batches);
+    }
+
+    void NullRenderer::EndFrame()
+    {
+        m_inFrame = false;
+        ++m_stats.frames;
+        m_stats.lastFrameDrawCalls = m_stats.frameDrawCalls;
+        m_stats.lastFrameInstances = m_stats.frameInstances;
+        m_stats.peakFrameDrawCalls = std::max(m_stats.peakFrameDrawCalls, m_stats.frameDrawCalls);
+    }
+
+    void NullRenderer::Shutdown()
+    {
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+        const double frames = static_cast<double>(m_stats.frames);
+
+        std::cout << "[ZED::NullRenderer] " << m_stats.frames << " frames, "
+                  << m_stats.drawCalls << " draw calls ("
+                  << (m_stats.frames ? static_cast<double>(m_stats.drawCalls) / frames : 0.0) << " avg, "
+                  << m_stats.peakFrameDrawCalls << " peak per frame), "
+                  << m_stats.instancedBatches << " instanced batches, "
+                  << m_stats.submissions << " queue submissions, "
+                  << m_stats.instances << " cubes, "
+                  << (seconds > 0.0 ? frames / seconds : 0.0) << " frames/s over " << seconds << " s\n";
+
+        if (m_stats.unsortedBatches > 0)
+        {
+            std::cerr << "[ZED::NullRenderer] " << m_stats.unsortedBatches << " batches were submitted out of sort order\n";
+        }
+    }
+}
@@ -7,11 +7,15 @@
 
 #pragma once
 
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <filesystem>
 #include <vector>
 #include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <thread>
 extern "C"
 {
 #include "lua.h"
@@ -24,6 +28,7 @@ extern "C"
 #endif
 
 #include "Engine/Interfaces/Scripting/IScripting.h"
+#include "Script-Luau/ScriptFileWatcher.h"
 
 namespace ZED
 {
@@ -34,27 +39,69 @@ namespace ZED
         void Shutdown() override;
 
         ScriptId LoadBytecodeFile(const std::string& path) override;
+        std::string GetScriptPath(ScriptId id) const override;
 
         void Start (ScriptId id, Entity e) override;
         void Stop  (ScriptId id, Entity e) override;
         void Update(ScriptId id, Entity e, double dt) override;
+        void UpdateBatch(ScriptId id, std::span<const Entity> entities, double dt) override;
 
         void PushEvent(int type, int a=0, int b=0, int c=0, int d=0) override;
 
-        void EnableHotReload(bool enabled) override { hotReload = enabled; }
+        // Applies reloads reported by the file watcher since the last frame
+        void BeginFrame() override;
+
+        void EnableHotReload(bool enabled) override;
+
+        bool IsProfiling() const override { return profiling; }
+        uint64_t GetProfiledFrames() const override { return profiledFrames; }
+        void GetScriptStats(std::vector<ScriptStats>& out) const override;
+        void GetInstanceStats(ScriptId id, std::vector<ScriptStats>& out) const override;
+        void ResetStats() override;
 
     private:
-        struct ScriptDef
+        // Profiling totals, for a script (all instances) and for each instance
+        struct Counters
         {
-            std::string path;
-            std::filesystem::file_time_type lastWrite{};
+            uint64_t updateCalls = 0, eventCalls = 0;
+            double updateSeconds = 0.0, eventSeconds = 0.0;
+            uint64_t bytesAllocated = 0;
+            uint64_t gcSteps = 0;
+            double gcSeconds = 0.0;
         };
 
         struct Instance
         {
-            lua_State* L = nullptr;   // isolated state per (script, entity)
+            lua_State* L = nullptr;   // own state (isolated mode) or a thread of the root state (shared mode)
             int tableRef  = LUA_NOREF;
-            bool hasStart = false, hasUpdate = false, hasDestroy = false, hasEvent = false;
+            int threadRef = LUA_NOREF; // shared VM: keeps the thread alive in the root state
+
+            // Hook functions resolved once at load, LUA_NOREF when the script doesn't define one
+            int startRef = LUA_NOREF, updateRef = LUA_NOREF, updateBatchRef = LUA_NOREF;
+            int destroyRef = LUA_NOREF, eventRef = LUA_NOREF;
+
+            Counters counters;
+        };
+
+        struct ScriptDef
+        {
+            std::string path;
+            int memcat = 0;           // Luau memory category its instances allocate under
+            int chunkRef = LUA_NOREF; // shared VM: chunk loaded once into the root state, run per instance
+            std::vector<char> bytecode; // isolated VMs: read once, loaded into each instance's state
+
+            // Whether the script defines OnUpdateBatch, taken from the first instance's hooks
+            bool batchHookKnown = false;
+            bool hasBatchHook = false;
+
+            // Script-level instance (no entity) that owns OnUpdateBatch; created on the first
+            // UpdateBatch() of a script that defines it
+            Instance batch;
+            bool batchLoaded = false;
+            int entityListRef = LUA_NOREF; // array handed to OnUpdateBatch, reused every frame
+            int entityListSize = 0;
+
+            Counters counters;
         };
 
         // key = (scriptId << 32) | entity
@@ -63,20 +110,95 @@ namespace ZED
             return (id.value << 32ull) | static_cast<uint64_t>(e);
         }
 
-        bool loadIntoNewState(const ScriptDef& def, Instance& out);
+        bool pushChunk(lua_State* L, const std::vector<char>& bc, const std::string& path);
+        bool loadIntoNewState(ScriptDef& def, Instance& out);
+        bool loadIntoThread(ScriptDef& def, Instance& out);
+        bool loadChunk(ScriptDef& def);
+        bool runChunk(Instance& out);
+        void releaseInstance(Instance& inst);
+        void releaseBatch(ScriptDef& def);
         void detectHooks(Instance& inst);
+        void compileNative(lua_State* L, const std::string& path);
+        void callUpdate(ScriptDef& def, Instance& inst, double dt);
+        void reloadScript(ScriptId id, ScriptDef& def);
+
+        // Plain values of a self table, carried across a hot reload
+        struct SavedField
+        {
+            std::string key;
+            int type = LUA_TNIL;
+            double number = 0.0;
+            float vec[3] = {};
+            std::string text;
+        };
+        static void saveFields(const Instance& inst, std::vector<SavedField>& out);
+        static void restoreFields(const Instance& inst, const std::vector<SavedField>& fields);
+        void reportStats() const;
+
+        // Profiling hooks are installed on every VM created through here
+        lua_State* newState();
+        // lua_Alloc charging every VM page and large block to MemoryTag::Scripting
+        static void* allocate(void* ud, void* ptr, size_t osize, size_t nsize);
+        static void interrupt(lua_State* L, int gc);
+        void chargeAllocations();
+        void sampleStack(lua_State* L);
+        void writeSamples() const;
+        static int memoryCategory(ScriptId id);
+
+        // Who allocations, GC steps and samples are charged to while a script runs
+        struct Attribution
+        {
+            lua_State* L = nullptr;
+            const ScriptDef* def = nullptr;
+            Counters* script = nullptr;
+            Counters* instance = nullptr;
+        };
+        enum class CallKind { Other, Update, Event };
+        class ProfileScope;
 
         // storage
         uint64_t nextScriptId = 1;
         std::unordered_map<uint64_t, ScriptDef> scripts;            // by ScriptId
         std::unordered_map<uint64_t, Instance>  instances;          // by (ScriptId, Entity)
 
+        bool initialized = false;
         bool hotReload = true;
+        ScriptFileWatcher watcher; // reports changed bytecode files off the main thread
+
+        // [Scripting] SharedVM: one root state with a sandboxed thread per instance
+        // instead of a full lua_State per (script, entity)
+        bool sharedVM = true;
+        lua_State* root = nullptr;
+
+        // [Scripting] NativeCodegen: compile loaded chunks to machine code with Luau.CodeGen
+        enum class NativeMode { Off = 0, Annotated = 1, All = 2 }; // Annotated = only scripts marked --!native
+        NativeMode nativeMode = NativeMode::Off;
+
+        // [Scripting] Profile: time OnUpdate/OnEvent and count allocations and GC steps per script
+        bool profiling = false;
+        uint64_t profiledFrames = 0;
+        Attribution current;
+        size_t heapMark = 0;       // VM heap size when allocations were last charged
+        double gcStepBegin = -1.0; // a GC step is bracketed by two interrupts; < 0 outside one
+
+        // [Scripting] ProfileSampleFile: a thread raises sampleRequested every sample interval and
+        // the next interrupt records the Luau call stack, folded for flamegraph tools
+        std::string sampleFile;
+        std::chrono::microseconds sampleInterval{ 1000 };
+        std::atomic<bool> sampleRequested{ false };
+        std::atomic<bool> samplerRunning{ false };
+        std::thread sampler;
+        std::unordered_map<std::string, uint64_t> samples;
+
+        // Spawn cost, reported on Shutdown
+        uint64_t spawnCount = 0;
+        double spawnSeconds = 0.0;
 
         // constants
         static constexpr const char* kChunkName   = "ZED/LuauChunk";
         static constexpr const char* kOnStart     = "OnStart";
         static constexpr const char* kOnUpdate    = "OnUpdate";
+        static constexpr const char* kOnUpdateBatch = "OnUpdateBatch";
         static constexpr const char* kOnDestroy   = "OnDestroy";
         static constexpr const char* kOnEvent     = "OnEvent";
     };
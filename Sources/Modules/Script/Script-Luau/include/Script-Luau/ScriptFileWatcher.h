@@ -0,0 +1,87 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef SCRIPTFILEWATCHER_H
+#define SCRIPTFILEWATCHER_H
+
+#pragma once
+
+#include "Engine/Containers/MPSCQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ZED
+{
+    /**
+     * Watches script bytecode files on a background thread and reports which
+     * scripts changed, so the main thread never touches the filesystem per frame.
+     *
+     * Uses inotify on the containing directories where available and falls back
+     * to polling each file's mtime elsewhere. Change notifications are pushed into
+     * a lock-free queue; the scripting module drains it once per frame.
+     */
+    class ScriptFileWatcher
+    {
+    public:
+        struct ReloadRequest
+        {
+            uint64_t script = 0; // ScriptId.value
+        };
+
+        ScriptFileWatcher() = default;
+        ~ScriptFileWatcher();
+
+        ScriptFileWatcher(const ScriptFileWatcher&) = delete;
+        ScriptFileWatcher& operator=(const ScriptFileWatcher&) = delete;
+
+        void Start();
+        void Stop();
+        bool IsRunning() const { return m_Running.load(std::memory_order_acquire); }
+
+        // Report changes to 'path' as reloads of 'script'. Safe to call while running.
+        void Watch(const std::string& path, uint64_t script);
+
+        // Main thread only. Returns false once nothing is pending.
+        bool PopReload(ReloadRequest& out) { return m_Queue.Pop(out); }
+
+    private:
+        struct WatchedFile
+        {
+            std::filesystem::path path; // absolute, normalised
+            uint64_t script = 0;
+            std::filesystem::file_time_type lastWrite{};
+        };
+
+        void Run();
+        void PollLoop();
+        bool NotifyLoop(); // false if the platform has no change notifications
+        void Publish(uint64_t script);
+        void FlushPending();
+        bool WaitFor(int ms);
+
+        // How often the fallback stats files, and how long a notify wait lasts before re-checking Stop()
+        static constexpr int kPollIntervalMs = 250;
+
+        std::mutex m_FilesMutex;
+        std::vector<WatchedFile> m_Files;
+        uint32_t m_FilesVersion = 0; // bumped by Watch() so the thread can pick up new directories
+
+        MPSCQueue<ReloadRequest, 256> m_Queue;
+        std::vector<uint64_t> m_Pending; // watcher thread only: requests that didn't fit in the queue
+
+        std::thread m_Thread;
+        std::atomic<bool> m_Running{false};
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCv;
+    };
+}
+
+#endif
@@ -8,17 +8,23 @@
 #include "Engine/ECS/Components/TransformComponent.h"
 #include "Engine/ECS/Components/CameraComponent.h"
 #include "Engine/ECS/Systems/TransformSystem.h"
+#include "Engine/Spatial/SpatialIndex.h"
 #include "Engine/Input/Input.h"
+#include "Engine/Determinism/Determinism.h"
 #include "Engine/Time.h"
+#include "Engine/Time/FixedTimestep.h"
 #include "Engine/Math/Math.h"
+#include <climits>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 namespace ZED
 {
     static_assert(sizeof(lua_Integer) >= sizeof(std::underlying_type_t<entt::entity>), "lua_Integer too small for entt::entity underlying type");
 
-    static bool validate_entity(lua_State* L, entt::entity e, entt::registry& reg, const char* ctx = "entity")
+    static bool validate_entity(lua_State* L, entt::entity e, Registry& reg, const char* ctx = "entity")
     {
         auto uid = static_cast<unsigned long long>(static_cast<std::underlying_type_t<entt::entity>>(e));
         //printf("[Luau-DBG] %s called with entt::entity underlying=%llu (ent value=%llu) registry_addr=%p\n",
@@ -41,6 +47,7 @@ namespace ZED
     static int lua_IsKeyDown(lua_State* L);
     static int lua_GetDeltaTime(lua_State* L);
     static int lua_GetElapsedTime(lua_State* L);
+    static int lua_GetFixedDeltaTime(lua_State* L);
     static int lua_TransformRotate(lua_State* L);
     static int lua_TransformTranslate(lua_State* L);
     static int lua_TransformScale(lua_State* L);
@@ -52,9 +59,62 @@ namespace ZED
     static int lua_Vec3Mul(lua_State* L);
     static int lua_Vec3Div(lua_State* L);
     static int lua_Vec3ToString(lua_State* L);
+    static int lua_TransformGet(lua_State* L);
+    static int lua_TransformHandleIndex(lua_State* L);
+    static int lua_TransformHandleNewIndex(lua_State* L);
+    static int lua_TransformHandleNamecall(lua_State* L);
+    static int lua_TransformHandleToString(lua_State* L);
+    static int lua_SpatialQueryRadius(lua_State* L);
+    static int lua_MathRandom(lua_State* L);
+    static int lua_MathRandomSeed(lua_State* L);
+
+    // --- Transform handles ---
+    // ZED.Transform.Get(entity) returns a tagged userdata holding only the entity id. Field reads
+    // and writes go straight to the TransformComponent in the registry and hand out Luau native
+    // vectors, so reading or writing a transform creates no tables and no garbage.
+    static constexpr int kTransformHandleTag = 1;
+
+    struct TransformHandle
+    {
+        entt::entity entity;
+    };
+
+    // Field and method names resolved to small integers when the string is interned, so
+    // __index/__namecall switch on an atom instead of comparing strings
+    enum LuauAtom : int16_t
+    {
+        kAtomPosition,
+        kAtomRotation,
+        kAtomScale,
+        kAtomEntity,
+        kAtomRotate,
+        kAtomTranslate,
+        kAtomSetPosition,
+        kAtomSetRotation,
+        kAtomSetScale,
+        kAtomCount
+    };
+
+    static const char* const kAtomNames[kAtomCount] = {
+        "position", "rotation", "scale", "entity",
+        "Rotate", "Translate", "SetPosition", "SetRotation", "SetScale",
+    };
+
+    static int16_t luau_useratom(const char* s, size_t l)
+    {
+        for (int16_t i = 0; i < kAtomCount; ++i)
+        {
+            if (strlen(kAtomNames[i]) == l && memcmp(kAtomNames[i], s, l) == 0)
+                return i;
+        }
+        return -1;
+    }
 
     void LuauBindings::Install(lua_State* L)
     {
+        // Strings created from here on carry their ZED atom
+        lua_callbacks(L)->useratom = luau_useratom;
+
         // Create ZED global table
         lua_newtable(L); // [ZED]
 
@@ -105,6 +165,10 @@ namespace ZED
         lua_pushcfunction(L, lua_GetElapsedTime, "GetElapsedTime");
         lua_settable(L, -3);
 
+        lua_pushstring(L, "GetFixedDeltaTime");
+        lua_pushcfunction(L, lua_GetFixedDeltaTime, "GetFixedDeltaTime");
+        lua_settable(L, -3);
+
         // --- Transform System Bindings ---
         lua_newtable(L); // [ZED, Transform]
         lua_pushstring(L, "Rotate");
@@ -116,8 +180,32 @@ namespace ZED
         lua_pushstring(L, "Scale");
         lua_pushcfunction(L, lua_TransformScale, "Transform.Scale");
         lua_settable(L, -3);
+        lua_pushstring(L, "Get");
+        lua_pushcfunction(L, lua_TransformGet, "Transform.Get");
+        lua_settable(L, -3);
         lua_setfield(L, -2, "Transform"); // ZED.Transform = {...}
 
+        // Transform handle metatable, bound to the userdata tag so creating a handle needs no lookup
+        lua_newtable(L); // [ZED, mt]
+        lua_pushcfunction(L, lua_TransformHandleIndex, "Transform.__index");
+        lua_setfield(L, -2, "__index");
+        lua_pushcfunction(L, lua_TransformHandleNewIndex, "Transform.__newindex");
+        lua_setfield(L, -2, "__newindex");
+        lua_pushcfunction(L, lua_TransformHandleNamecall, "Transform.__namecall");
+        lua_setfield(L, -2, "__namecall");
+        lua_pushcfunction(L, lua_TransformHandleToString, "Transform.__tostring");
+        lua_setfield(L, -2, "__tostring");
+        lua_pushstring(L, "ZED.Transform");
+        lua_setfield(L, -2, "__type");
+        lua_setreadonly(L, -1, true);
+        lua_setuserdatametatable(L, kTransformHandleTag); // pops mt
+
+        // --- Spatial Index Bindings ---
+        lua_newtable(L); // [ZED, Spatial]
+        lua_pushcfunction(L, lua_SpatialQueryRadius, "Spatial.QueryRadius");
+        lua_setfield(L, -2, "QueryRadius");
+        lua_setfield(L, -2, "Spatial"); // ZED.Spatial = {...}
+
         // --- Math: Vec3 ---
         lua_newtable(L); // [ZED, Vec3]
         lua_pushstring(L, "new");
@@ -152,6 +240,22 @@ namespace ZED
 
         // Set ZED as global
         lua_setglobal(L, "ZED"); // ZED = {...}
+
+        // Lockstep: math.random draws from the engine's seeded generator. Installed before the
+        // globals are frozen, so scripts resolve it like the original. Lockstep is checked per
+        // call, and the original (kept as an upvalue) runs when it's off, so it doesn't matter
+        // whether the VM was created before or after Determinism read its config.
+        lua_getglobal(L, "math");
+        if (lua_istable(L, -1))
+        {
+            lua_getfield(L, -1, "random");
+            lua_pushcclosure(L, lua_MathRandom, "random", 1);
+            lua_setfield(L, -2, "random");
+            lua_getfield(L, -1, "randomseed");
+            lua_pushcclosure(L, lua_MathRandomSeed, "randomseed", 1);
+            lua_setfield(L, -2, "randomseed");
+        }
+        lua_pop(L, 1);
     }
 
     // --- ECS Functions ---
@@ -171,11 +275,12 @@ namespace ZED
 
         const auto& tr = reg.get<TransformComponent>(ent);
 
-        lua_newtable(L); // result table
+        // Presized, so filling them in doesn't regrow the hash part
+        lua_createtable(L, 0, 3); // result table
 
         // position
         lua_pushstring(L, "position");
-        lua_newtable(L);
+        lua_createtable(L, 0, 3);
         lua_pushstring(L, "x"); lua_pushnumber(L, tr.position.x); lua_settable(L, -3);
         lua_pushstring(L, "y"); lua_pushnumber(L, tr.position.y); lua_settable(L, -3);
         lua_pushstring(L, "z"); lua_pushnumber(L, tr.position.z); lua_settable(L, -3);
@@ -183,7 +288,7 @@ namespace ZED
 
         // rotation
         lua_pushstring(L, "rotation");
-        lua_newtable(L);
+        lua_createtable(L, 0, 3);
         lua_pushstring(L, "x"); lua_pushnumber(L, tr.rotation.x); lua_settable(L, -3);
         lua_pushstring(L, "y"); lua_pushnumber(L, tr.rotation.y); lua_settable(L, -3);
         lua_pushstring(L, "z"); lua_pushnumber(L, tr.rotation.z); lua_settable(L, -3);
@@ -191,7 +296,7 @@ namespace ZED
 
         // scale
         lua_pushstring(L, "scale");
-        lua_newtable(L);
+        lua_createtable(L, 0, 3);
         lua_pushstring(L, "x"); lua_pushnumber(L, tr.scale.x); lua_settable(L, -3);
         lua_pushstring(L, "y"); lua_pushnumber(L, tr.scale.y); lua_settable(L, -3);
         lua_pushstring(L, "z"); lua_pushnumber(L, tr.scale.z); lua_settable(L, -3);
@@ -258,6 +363,7 @@ namespace ZED
             lua_pop(L, 1);
         }
 
+        TransformSystem::MarkDirty(reg, ent);
         return 0;
     }
 
@@ -277,7 +383,7 @@ namespace ZED
 
         const auto& cam = reg.get<CameraComponent>(ent);
 
-        lua_newtable(L);
+        lua_createtable(L, 0, 6);
         lua_pushstring(L, "fovRadians"); lua_pushnumber(L, cam.fovRadians); lua_settable(L, -3);
         lua_pushstring(L, "znear");     lua_pushnumber(L, cam.znear);     lua_settable(L, -3);
         lua_pushstring(L, "zfar");      lua_pushnumber(L, cam.zfar);      lua_settable(L, -3);
@@ -337,6 +443,14 @@ namespace ZED
     static int lua_IsKeyDown(lua_State* L)
     {
         int key = static_cast<int>(luaL_checkinteger(L, 1));
+
+        // Lockstep: the state recorded for this tick, not whatever the device says right now
+        if (Determinism::IsEnabled())
+        {
+            lua_pushboolean(L, Determinism::IsKeyDown(static_cast<Key>(key)) ? 1 : 0);
+            return 1;
+        }
+
         auto* input = Input::GetInput();
         if (!input)
         {
@@ -349,18 +463,83 @@ namespace ZED
     }
 
     // --- Time Functions ---
+    // Lockstep replaces wall-clock time with simulation time
     static int lua_GetDeltaTime(lua_State* L)
     {
-        lua_pushnumber(L, Time::GetDeltaTime());
+        lua_pushnumber(L, Determinism::IsEnabled() ? FixedTimestep::GetStep() : Time::GetDeltaTime());
         return 1;
     }
 
     static int lua_GetElapsedTime(lua_State* L)
     {
-        lua_pushnumber(L, Time::GetElapsedTime());
+        lua_pushnumber(L, Determinism::IsEnabled() ? static_cast<double>(Determinism::GetTick()) * FixedTimestep::GetStep()
+                                                   : Time::GetElapsedTime());
+        return 1;
+    }
+
+    // OnUpdate runs once per fixed step and is passed this, not the frame's delta
+    static int lua_GetFixedDeltaTime(lua_State* L)
+    {
+        lua_pushnumber(L, FixedTimestep::GetStep());
+        return 1;
+    }
+
+    // --- Math Functions ---
+    // Forwards the call's arguments to the library function the wrapper replaced (upvalue 1)
+    static int callOriginal(lua_State* L, int results)
+    {
+        lua_pushvalue(L, lua_upvalueindex(1));
+        lua_insert(L, 1);
+        lua_call(L, lua_gettop(L) - 1, results);
+        return results;
+    }
+
+    // Same arguments, ranges and errors as Luau's math.random, drawing 32 bits per integer
+    static int lua_MathRandom(lua_State* L)
+    {
+        if (!Determinism::IsEnabled())
+            return callOriginal(L, 1);
+
+        switch (lua_gettop(L))
+        {
+            case 0:
+                lua_pushnumber(L, Determinism::RandomUnit());
+                break;
+            case 1:
+            {
+                const int u = luaL_checkinteger(L, 1);
+                luaL_argcheck(L, 1 <= u, 1, "interval is empty");
+                const uint64_t x = uint64_t(u) * static_cast<uint32_t>(Determinism::NextRandom() >> 32);
+                lua_pushinteger(L, static_cast<int>(1 + (x >> 32)));
+                break;
+            }
+            case 2:
+            {
+                const int l = luaL_checkinteger(L, 1);
+                const int u = luaL_checkinteger(L, 2);
+                luaL_argcheck(L, l <= u, 2, "interval is empty");
+
+                const uint32_t ul = uint32_t(u) - uint32_t(l);
+                luaL_argcheck(L, ul < UINT_MAX, 2, "interval is too large");
+                const uint64_t x = uint64_t(ul + 1) * static_cast<uint32_t>(Determinism::NextRandom() >> 32);
+                lua_pushinteger(L, static_cast<int>(l + (x >> 32)));
+                break;
+            }
+            default:
+                luaL_error(L, "wrong number of arguments");
+        }
         return 1;
     }
 
+    static int lua_MathRandomSeed(lua_State* L)
+    {
+        if (!Determinism::IsEnabled())
+            return callOriginal(L, 0);
+
+        Determinism::Seed(static_cast<uint64_t>(static_cast<int64_t>(luaL_checkinteger(L, 1))));
+        return 0;
+    }
+
     // --- Transform System Functions ---
     static int lua_TransformRotate(lua_State* L)
     {
@@ -572,4 +751,167 @@ namespace ZED
         lua_pushstring(L, buf);
         return 1;
     }
-}
\ No newline at end of file
+
+    // --- Transform Handle Functions ---
+    static void pushVec3(lua_State* L, const Vec3& v)
+    {
+#if LUA_VECTOR_SIZE == 4
+        lua_pushvector(L, v.x, v.y, v.z, 0.0f);
+#else
+        lua_pushvector(L, v.x, v.y, v.z);
+#endif
+    }
+
+    // Accepts a native vector, a ZED.Vec3 or three numbers starting at idx
+    static Vec3 checkVec3Arg(lua_State* L, int idx)
+    {
+        if (const float* v = lua_tovector(L, idx))
+            return Vec3(v[0], v[1], v[2]);
+        if (lua_isuserdata(L, idx))
+            return *static_cast<Vec3*>(luaL_checkudata(L, idx, "ZED.Vec3"));
+
+        return Vec3(static_cast<float>(luaL_checknumber(L, idx)),
+                    static_cast<float>(luaL_checknumber(L, idx + 1)),
+                    static_cast<float>(luaL_checknumber(L, idx + 2)));
+    }
+
+    static int atomOf(const char* s, int atom)
+    {
+        // Strings interned before Install() ran have no atom; resolve those by name
+        return (atom >= 0 && atom < kAtomCount) ? atom : luau_useratom(s, strlen(s));
+    }
+
+    static TransformHandle* checkTransformHandle(lua_State* L, int idx)
+    {
+        auto* h = static_cast<TransformHandle*>(lua_touserdatatagged(L, idx, kTransformHandleTag));
+        if (!h) luaL_typeerror(L, idx, "ZED.Transform");
+        return h;
+    }
+
+    static TransformComponent& resolveTransform(lua_State* L, const TransformHandle* h)
+    {
+        auto& transforms = ECS::ECS::Registry().storage<TransformComponent>();
+        if (!transforms.contains(h->entity))
+        {
+            auto eid = static_cast<unsigned long long>(static_cast<std::underlying_type_t<entt::entity>>(h->entity));
+            luaL_error(L, "Transform: entity %llu has no TransformComponent", eid);
+        }
+        return transforms.get(h->entity);
+    }
+
+    static int lua_TransformGet(lua_State* L)
+    {
+        lua_Integer entId = luaL_checkinteger(L, 1);
+        entt::entity ent = static_cast<entt::entity>(static_cast<std::underlying_type_t<entt::entity>>(entId));
+        auto& reg = ECS::ECS::Registry();
+
+        if (!validate_entity(L, ent, reg, "Transform.Get")) return 0;
+        if (!reg.all_of<TransformComponent>(ent))
+        {
+            lua_pushnil(L);
+            return 1;
+        }
+
+        // Cache the handle (e.g. in OnStart) rather than calling Get every frame
+        auto* h = static_cast<TransformHandle*>(lua_newuserdatataggedwithmetatable(L, sizeof(TransformHandle), kTransformHandleTag));
+        h->entity = ent;
+        return 1;
+    }
+
+    static int lua_TransformHandleIndex(lua_State* L)
+    {
+        const TransformHandle* h = checkTransformHandle(L, 1);
+        int atom = -1;
+        const char* key = lua_tostringatom(L, 2, &atom);
+        if (!key) luaL_error(L, "Transform: field name must be a string");
+
+        switch (atomOf(key, atom))
+        {
+        case kAtomPosition: pushVec3(L, resolveTransform(L, h).position); return 1;
+        case kAtomRotation: pushVec3(L, resolveTransform(L, h).rotation); return 1;
+        case kAtomScale:    pushVec3(L, resolveTransform(L, h).scale);    return 1;
+        case kAtomEntity:
+            lua_pushinteger(L, static_cast<lua_Integer>(static_cast<std::underlying_type_t<entt::entity>>(h->entity)));
+            return 1;
+        default:
+            luaL_error(L, "Transform has no field '%s'", key);
+        }
+        return 0;
+    }
+
+    static int lua_TransformHandleNewIndex(lua_State* L)
+    {
+        const TransformHandle* h = checkTransformHandle(L, 1);
+        int atom = -1;
+        const char* key = lua_tostringatom(L, 2, &atom);
+        if (!key) luaL_error(L, "Transform: field name must be a string");
+
+        TransformComponent& tr = resolveTransform(L, h);
+        switch (atomOf(key, atom))
+        {
+        case kAtomPosition: tr.position = checkVec3Arg(L, 3); break;
+        case kAtomRotation: tr.rotation = checkVec3Arg(L, 3); break;
+        case kAtomScale:    tr.scale    = checkVec3Arg(L, 3); break;
+        default:
+            luaL_error(L, "Transform field '%s' is not writable", key);
+        }
+
+        TransformSystem::MarkDirty(ECS::ECS::Registry(), h->entity);
+        return 0;
+    }
+
+    static int lua_TransformHandleNamecall(lua_State* L)
+    {
+        const TransformHandle* h = checkTransformHandle(L, 1);
+        int atom = -1;
+        const char* name = lua_namecallatom(L, &atom);
+        if (!name) luaL_error(L, "Transform: bad method call");
+
+        TransformComponent& tr = resolveTransform(L, h);
+        switch (atomOf(name, atom))
+        {
+        case kAtomRotate:      tr.rotation += checkVec3Arg(L, 2); break;
+        case kAtomTranslate:   tr.position += checkVec3Arg(L, 2); break;
+        case kAtomSetPosition: tr.position  = checkVec3Arg(L, 2); break;
+        case kAtomSetRotation: tr.rotation  = checkVec3Arg(L, 2); break;
+        case kAtomSetScale:    tr.scale     = checkVec3Arg(L, 2); break;
+        default:
+            luaL_error(L, "Transform has no method '%s'", name);
+        }
+
+        TransformSystem::MarkDirty(ECS::ECS::Registry(), h->entity);
+        return 0;
+    }
+
+    static int lua_TransformHandleToString(lua_State* L)
+    {
+        const TransformHandle* h = checkTransformHandle(L, 1);
+        char buf[48];
+        snprintf(buf, sizeof(buf), "Transform(%llu)",
+                 static_cast<unsigned long long>(static_cast<std::underlying_type_t<entt::entity>>(h->entity)));
+        lua_pushstring(L, buf);
+        return 1;
+    }
+
+    // --- Spatial Index Functions ---
+    // ZED.Spatial.QueryRadius(pos, radius) -> { entity, ... }
+    // pos is a vector, a ZED.Vec3 or three numbers; matches every entity whose bounding sphere
+    // touches the query sphere, as of the last SpatialIndex::Update()
+    static int lua_SpatialQueryRadius(lua_State* L)
+    {
+        const Vec3 center = checkVec3Arg(L, 1);
+        const int radiusIdx = lua_isnumber(L, 1) ? 4 : 2;
+        const float radius = static_cast<float>(luaL_checknumber(L, radiusIdx));
+
+        static std::vector<entt::entity> results;
+        SpatialIndex::QuerySphere(ECS::ECS::Registry(), center, radius, results);
+
+        lua_createtable(L, static_cast<int>(results.size()), 0);
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            lua_pushinteger(L, static_cast<lua_Integer>(static_cast<std::underlying_type_t<entt::entity>>(results[i])));
+            lua_rawseti(L, -2, static_cast<int>(i + 1));
+        }
+        return 1;
+    }
+}
@@ -4,6 +4,12 @@
 
 #include "Script-Luau/LuauScripting.h"
 #include "Script-Luau/LuauBindings.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Memory/Allocators.h"
+#include "Engine/Profiler/Profiler.h"
+#include "Luau/CodeGen.h"
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 
@@ -14,91 +20,236 @@ using namespace ZED;
 // ---------- helpers ----------
 static std::vector<char> readFile(const std::string& path)
 {
-    std::ifstream f(path, std::ios::binary);
+    // Size it first and read in one go rather than a byte at a time through istreambuf_iterator
+    std::ifstream f(path, std::ios::binary | std::ios::ate);
     if (!f) return {};
-    return std::vector<char>((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+
+    const std::streamsize size = f.tellg();
+    if (size <= 0) return {};
+
+    std::vector<char> data(static_cast<size_t>(size));
+    f.seekg(0);
+    if (!f.read(data.data(), size)) return {};
+    return data;
+}
+
+static double nowSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 
+// ---------- profiling ----------
+// Charges a call's time, and whatever it allocates, to a script and optionally one of its
+// instances. Scopes nest (an OnUpdate can push an event): the outer one is charged up to
+// the inner one's start and resumes when it ends.
+class LuauScripting::ProfileScope
+{
+public:
+    ProfileScope(LuauScripting& owner, lua_State* L, const ScriptDef& def, Counters* script, Counters* instance, CallKind kind)
+        : owner(owner), saved(owner.current), kind(kind), active(owner.profiling)
+    {
+        if (!active) return;
+
+        owner.chargeAllocations();
+        owner.current = { L, &def, script, instance };
+        owner.heapMark = L ? lua_totalbytes(L, -1) : 0;
+        begin = nowSeconds();
+    }
+
+    ~ProfileScope()
+    {
+        if (!active) return;
+
+        const double seconds = nowSeconds() - begin;
+        for (Counters* c : { owner.current.script, owner.current.instance })
+        {
+            if (!c) continue;
+            if (kind == CallKind::Update) { ++c->updateCalls; c->updateSeconds += seconds; }
+            else if (kind == CallKind::Event) { ++c->eventCalls; c->eventSeconds += seconds; }
+        }
+
+        owner.chargeAllocations();
+        owner.current = saved;
+        if (saved.L) owner.heapMark = lua_totalbytes(saved.L, -1);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    LuauScripting& owner;
+    Attribution saved;
+    CallKind kind;
+    bool active;
+    double begin = 0.0;
+};
+
 // ---------- IScripting ----------
 bool LuauScripting::Init()
 {
-    // Nothing global required yet, We can just install shared libs/bindings here later
+    // CreateScripting() initialises; a second call must not build another root VM
+    if (initialized) return true;
+    initialized = true;
+
+    if (hotReload)
+        watcher.Start();
+
+    const auto& ini = Config::Get();
+    sharedVM = ini.GetBoolValue("Scripting", "SharedVM", true);
+
+    profiling = ini.GetBoolValue("Scripting", "Profile", false);
+    sampleFile = ini.GetValue("Scripting", "ProfileSampleFile", "");
+    sampleInterval = std::chrono::microseconds(std::max(50L, ini.GetLongValue("Scripting", "ProfileSampleIntervalUs", 1000)));
+    if (!sampleFile.empty() && !sampler.joinable())
+    {
+        // Samples are charged to the running script, so sampling implies profiling
+        profiling = true;
+        samplerRunning = true;
+        sampler = std::thread([this]
+        {
+            while (samplerRunning.load(std::memory_order_relaxed))
+            {
+                std::this_thread::sleep_for(sampleInterval);
+                sampleRequested.store(true, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    const long native = ini.GetLongValue("Scripting", "NativeCodegen", 0);
+    nativeMode = native >= 2 ? NativeMode::All : native == 1 ? NativeMode::Annotated : NativeMode::Off;
+    if (nativeMode != NativeMode::Off && !Luau::CodeGen::isSupported())
+    {
+        std::cerr << "[Luau] Native codegen is not supported on this platform, interpreting scripts\n";
+        nativeMode = NativeMode::Off;
+    }
+
+    if (!sharedVM) return true;
+
+    // One VM for every script; libraries and bindings are installed once and then frozen
+    // so instances can read but not modify them
+    root = newState();
+    luaL_openlibs(root);
+    LuauBindings::Install(root);
+    luaL_sandbox(root);
+    if (nativeMode != NativeMode::Off)
+        Luau::CodeGen::create(root);
     return true;
 }
 
 void LuauScripting::Shutdown()
 {
+    watcher.Stop();
+    reportStats();
+
+    if (sampler.joinable())
+    {
+        samplerRunning = false;
+        sampler.join();
+        writeSamples();
+    }
+
     for (auto& kv : instances)
     {
         auto& inst = kv.second;
 
-        if (inst.hasDestroy)
+        if (inst.destroyRef != LUA_NOREF)
         {
-            lua_getref(inst.L, inst.tableRef);
-            lua_getfield(inst.L, -1, kOnDestroy);
-            lua_pushvalue(inst.L, -2); // self
+            lua_getref(inst.L, inst.destroyRef);
+            lua_getref(inst.L, inst.tableRef); // self
             if (lua_pcall(inst.L, 1, 0, 0) != 0)
             {
                 std::cerr << "[Luau] OnDestroy error during Shutdown: " << lua_tostring(inst.L, -1) << "\n";
                 lua_pop(inst.L, 1); // pop error
             }
-            lua_pop(inst.L, 1); // pop [self]
-        }
-
-        if (inst.tableRef != LUA_NOREF) {
-            lua_unref(inst.L, inst.tableRef);
-            inst.tableRef = LUA_NOREF;
         }
 
-        if (inst.L) { lua_close(inst.L); inst.L = nullptr; }
+        releaseInstance(inst);
     }
     instances.clear();
+
+    for (auto& kv : scripts)
+    {
+        releaseBatch(kv.second);
+        if (root && kv.second.chunkRef != LUA_NOREF)
+            lua_unref(root, kv.second.chunkRef);
+    }
     scripts.clear();
+
+    if (root) { lua_close(root); root = nullptr; }
+    initialized = false;
 }
 
 ScriptId LuauScripting::LoadBytecodeFile(const std::string& path)
 {
+    // Scenes and code may both ask for a script; keep one definition (and one watch) per file
+    for (const auto& [id, def] : scripts)
+    {
+        if (def.path == path)
+            return ScriptId{ id };
+    }
+
     ScriptId sid{ nextScriptId++ };
     ScriptDef def;
     def.path = path;
-    std::error_code ec; // don’t throw on missing during dev
-    def.lastWrite = std::filesystem::last_write_time(path, ec);
+    def.memcat = memoryCategory(sid);
+    watcher.Watch(path, sid.value);
 
     // Don’t instantiate yet do it when an entity asks for Start()
     scripts.emplace(sid.value, std::move(def));
     return sid;
 }
 
+std::string LuauScripting::GetScriptPath(ScriptId id) const
+{
+    auto it = scripts.find(id.value);
+    return it != scripts.end() ? it->second.path : std::string();
+}
+
 void LuauScripting::Start(ScriptId id, Entity e)
 {
     auto it = scripts.find(id.value);
     if (it == scripts.end()) return;
 
+    const auto spawnBegin = std::chrono::steady_clock::now();
+
+    // Loading and OnStart aren't timed, but what they allocate is charged to the script
+    ProfileScope scope(*this, sharedVM ? root : nullptr, it->second, &it->second.counters, nullptr, CallKind::Other);
+
     Instance inst;
-    if (!loadIntoNewState(it->second, inst))
+    const bool loaded = sharedVM ? loadIntoThread(it->second, inst) : loadIntoNewState(it->second, inst);
+    if (!loaded)
     {
         std::cerr << "[Luau] Failed to start script " << id.value << " for entity " << e << "\n";
+        releaseInstance(inst);
         return;
     }
 
+    ScriptDef& def = it->second;
+    if (!def.batchHookKnown)
+    {
+        def.batchHookKnown = true;
+        def.hasBatchHook = inst.updateBatchRef != LUA_NOREF;
+    }
+
     // attach entity id: self.entity = <uint32>
     lua_getref(inst.L, inst.tableRef);                  // [self]
     lua_pushinteger(inst.L, static_cast<lua_Integer>(e));
     lua_setfield(inst.L, -2, "entity");
     lua_pop(inst.L, 1);
 
+    ++spawnCount;
+    spawnSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - spawnBegin).count();
+
     // call OnStart(self) if present
-    if (inst.hasStart)
+    if (inst.startRef != LUA_NOREF)
     {
-        lua_getref(inst.L, inst.tableRef);              // [self]
-        lua_getfield(inst.L, -1, kOnStart);             // [self, fn]
-        lua_pushvalue(inst.L, -2);                      // [self, fn, self]
+        lua_getref(inst.L, inst.startRef);              // [fn]
+        lua_getref(inst.L, inst.tableRef);              // [fn, self]
         if (lua_pcall(inst.L, 1, 0, 0) != 0)
         {
             std::cerr << "[Luau] OnStart error: " << lua_tostring(inst.L, -1) << "\n";
             lua_pop(inst.L, 1); // pop error
         }
-        lua_pop(inst.L, 1); // pop [self]
     }
 
     instances.emplace(Key(id, e), std::move(inst));
@@ -112,66 +263,96 @@ void LuauScripting::Stop(ScriptId id, Entity e)
 
     Instance& inst = it->second;
 
-    if (inst.hasDestroy)
+    if (inst.destroyRef != LUA_NOREF)
     {
-        lua_getref(inst.L, inst.tableRef);
-        lua_getfield(inst.L, -1, kOnDestroy);
-        lua_pushvalue(inst.L, -2); // self
+        ScriptDef& def = scripts.at(id.value);
+        ProfileScope scope(*this, inst.L, def, &def.counters, nullptr, CallKind::Other);
+        lua_getref(inst.L, inst.destroyRef);
+        lua_getref(inst.L, inst.tableRef); // self
         if (lua_pcall(inst.L, 1, 0, 0) != 0)
         {
             std::cerr << "[Luau] OnDestroy error: " << lua_tostring(inst.L, -1) << "\n";
             lua_pop(inst.L, 1); // pop error
         }
-        lua_pop(inst.L, 1); // pop [self]
-    }
-
-    // Unref before closing
-    if (inst.tableRef != LUA_NOREF) {
-        lua_unref(inst.L, inst.tableRef);
-        inst.tableRef = LUA_NOREF;
     }
 
-    if (inst.L) { lua_close(inst.L); inst.L = nullptr; }
+    releaseInstance(inst);
     instances.erase(it);
 }
 
 void LuauScripting::Update(ScriptId id, Entity e, double dt)
 {
-    // Simple hot reload if bytecode mtime changed, rebuild just this instance
-    if (hotReload)
+    auto k = Key(id, e);
+    auto it = instances.find(k);
+    if (it == instances.end()) return;
+
+    callUpdate(scripts.at(id.value), it->second, dt);
+}
+
+void LuauScripting::UpdateBatch(ScriptId id, std::span<const Entity> entities, double dt)
+{
+    auto defIt = scripts.find(id.value);
+    if (defIt == scripts.end() || entities.empty()) return;
+    ScriptDef& def = defIt->second;
+    ZED_PROFILE_SCOPE(def.path.c_str());
+
+    // Only scripts that define the hook get a script-level instance; loading one runs the
+    // chunk's top-level code again, and in isolated mode costs a whole VM
+    if (def.hasBatchHook && !def.batchLoaded)
     {
-        auto defIt = scripts.find(id.value);
-        if (defIt != scripts.end())
+        def.batchLoaded = true;
+        const bool loaded = sharedVM ? loadIntoThread(def, def.batch) : loadIntoNewState(def, def.batch);
+        if (!loaded)
+            releaseInstance(def.batch);
+    }
+
+    // Scripts that opt in with OnUpdateBatch(self, entities, dt) get a single call for all entities
+    if (def.hasBatchHook && def.batch.updateBatchRef != LUA_NOREF)
+    {
+        lua_State* L = def.batch.L;
+        ProfileScope scope(*this, L, def, &def.counters, &def.batch.counters, CallKind::Update);
+        lua_getref(L, def.batch.updateBatchRef);
+        lua_getref(L, def.batch.tableRef); // self (script-level, not per entity)
+
+        // Reuse one array so a steady entity count makes no garbage; only valid during the call
+        if (def.entityListRef == LUA_NOREF)
         {
-            std::error_code ec;
-            auto nowWrite = std::filesystem::last_write_time(defIt->second.path, ec);
-            if (!ec && nowWrite != defIt->second.lastWrite)
-            {
-                // rebuild instance
-                Stop(id, e);
-                defIt->second.lastWrite = nowWrite;
-                Start(id, e);
-            }
+            lua_createtable(L, static_cast<int>(entities.size()), 0);
+            def.entityListRef = lua_ref(L, -1);
+        }
+        else
+        {
+            lua_getref(L, def.entityListRef);
         }
-    }
 
-    auto k = Key(id, e);
-    auto it = instances.find(k);
-    if (it == instances.end()) return;
+        const int count = static_cast<int>(entities.size());
+        for (int i = 0; i < count; ++i)
+        {
+            lua_pushinteger(L, static_cast<lua_Integer>(entities[i]));
+            lua_rawseti(L, -2, i + 1);
+        }
+        for (int i = count; i < def.entityListSize; ++i)
+        {
+            lua_pushnil(L);
+            lua_rawseti(L, -2, i + 1);
+        }
+        def.entityListSize = count;
 
-    Instance& inst = it->second;
-    if (!inst.hasUpdate) return;
+        lua_pushnumber(L, dt);
+        if (lua_pcall(L, 3, 0, 0) != 0)
+        {
+            std::cerr << "[Luau] OnUpdateBatch error: " << lua_tostring(L, -1) << "\n";
+            lua_pop(L, 1); // pop error
+        }
+        return;
+    }
 
-    lua_getref(inst.L, inst.tableRef);
-    lua_getfield(inst.L, -1, kOnUpdate);
-    lua_pushvalue(inst.L, -2);      // self
-    lua_pushnumber(inst.L, dt);
-    if (lua_pcall(inst.L, 2, 0, 0) != 0)
+    for (Entity e : entities)
     {
-        std::cerr << "[Luau] OnUpdate error: " << lua_tostring(inst.L, -1) << "\n";
-        lua_pop(inst.L, 1); // pop error
+        auto it = instances.find(Key(id, e));
+        if (it != instances.end())
+            callUpdate(def, it->second, dt);
     }
-    lua_pop(inst.L, 1); // pop [self]
 }
 
 void LuauScripting::PushEvent(int type, int a, int b, int c, int d)
@@ -180,11 +361,12 @@ void LuauScripting::PushEvent(int type, int a, int b, int c, int d)
     for (auto& kv : instances)
     {
         Instance& inst = kv.second;
-        if (!inst.hasEvent) continue;
+        if (inst.eventRef == LUA_NOREF) continue;
 
-        lua_getref(inst.L, inst.tableRef);
-        lua_getfield(inst.L, -1, kOnEvent);
-        lua_pushvalue(inst.L, -2);     // self
+        ScriptDef& def = scripts.at(kv.first >> 32ull);
+        ProfileScope scope(*this, inst.L, def, &def.counters, &inst.counters, CallKind::Event);
+        lua_getref(inst.L, inst.eventRef);
+        lua_getref(inst.L, inst.tableRef); // self
         lua_pushinteger(inst.L, type);
         lua_pushinteger(inst.L, a);
         lua_pushinteger(inst.L, b);
@@ -195,35 +377,96 @@ void LuauScripting::PushEvent(int type, int a, int b, int c, int d)
             std::cerr << "[Luau] OnEvent error: " << lua_tostring(inst.L, -1) << "\n";
             lua_pop(inst.L, 1); // pop error
         }
-        lua_pop(inst.L, 1); // pop [self]
     }
 }
 
 // ---------- internals ----------
-bool LuauScripting::loadIntoNewState(const ScriptDef& def, Instance& out)
+bool LuauScripting::pushChunk(lua_State* L, const std::vector<char>& bc, const std::string& path)
 {
-    auto bc = readFile(def.path);
     if (bc.empty())
+    {
+        std::cerr << "[Luau] Bytecode file empty: " << path << "\n";
+        return false;
+    }
+
+    // Luau: load bytecode directly from a buffer (no reader thunk)
+    if (luau_load(L, kChunkName, bc.data(), bc.size(), /*env*/0) != 0)
+    {
+        std::cerr << "[Luau] luau_load: " << lua_tostring(L, -1) << "\n";
+        lua_pop(L, 1); // pop error
+        return false;
+    }
+    return true;
+}
+
+bool LuauScripting::loadIntoNewState(ScriptDef& def, Instance& out)
+{
+    // Read once per script; every instance loads the same bytes into its own state
+    if (def.bytecode.empty())
+        def.bytecode = readFile(def.path);
+    if (def.bytecode.empty())
     {
         std::cerr << "[Luau] Bytecode file empty: " << def.path << "\n";
         return false;
     }
 
     // fresh state per instance
-    out.L = luaL_newstate();
+    out.L = newState();
+    lua_setmemcat(out.L, def.memcat);
     luaL_openlibs(out.L); // TODO: replace with curated libs for sandboxing
 
     // Install ZED engine bindings
     LuauBindings::Install(out.L);
+    if (nativeMode != NativeMode::Off)
+        Luau::CodeGen::create(out.L);
 
-    // Luau: load bytecode directly from a buffer (no reader thunk)
-    if (luau_load(out.L, kChunkName, bc.data(), bc.size(), /*env*/0) != 0)
-    {
-        std::cerr << "[Luau] luau_load: " << lua_tostring(out.L, -1) << "\n";
-        lua_pop(out.L, 1); // pop error
+    if (!pushChunk(out.L, def.bytecode, def.path))
         return false;
-    }
 
+    compileNative(out.L, def.path);
+    return runChunk(out);
+}
+
+bool LuauScripting::loadChunk(ScriptDef& def)
+{
+    if (def.chunkRef != LUA_NOREF) return true;
+
+    if (!pushChunk(root, readFile(def.path), def.path))
+        return false;
+
+    // Once per script: every instance's clone shares the same compiled prototypes
+    compileNative(root, def.path);
+
+    def.chunkRef = lua_ref(root, -1);
+    lua_pop(root, 1);
+    return true;
+}
+
+bool LuauScripting::loadIntoThread(ScriptDef& def, Instance& out)
+{
+    // Bytecode is read and loaded once per script, not once per entity
+    if (!loadChunk(def)) return false;
+
+    // The thread lives on the root state's stack until we anchor it with a ref
+    out.L = lua_newthread(root);
+    out.threadRef = lua_ref(root, -1);
+    lua_pop(root, 1);
+    lua_setmemcat(out.L, def.memcat);
+
+    // Give the thread its own globals table that falls back to the frozen shared one
+    luaL_sandboxthread(out.L);
+
+    // Clone so the chunk's environment is this thread's globals; running it creates
+    // fresh upvalues and a fresh returned table, exactly like a separate VM would
+    lua_getref(out.L, def.chunkRef);
+    lua_clonefunction(out.L, -1);
+    lua_remove(out.L, -2);
+
+    return runChunk(out);
+}
+
+bool LuauScripting::runChunk(Instance& out)
+{
     // Run the chunk; convention: it returns a table (script "self" prototype)
     if (lua_pcall(out.L, 0, 1, 0) != 0)
     {
@@ -248,24 +491,469 @@ bool LuauScripting::loadIntoNewState(const ScriptDef& def, Instance& out)
     return true;
 }
 
-void LuauScripting::detectHooks(Instance& inst)
+void LuauScripting::compileNative(lua_State* L, const std::string& path)
+{
+    if (nativeMode == NativeMode::Off) return;
+
+    // Expects the freshly loaded chunk on top of the stack
+    const unsigned flags = nativeMode == NativeMode::Annotated ? unsigned(Luau::CodeGen::CodeGen_OnlyNativeModules) : 0u;
+    Luau::CodeGen::CompilationStats stats;
+    const auto result = Luau::CodeGen::compile(L, -1, flags, &stats);
+
+    using Result = Luau::CodeGen::CodeGenCompilationResult;
+    if (result.result == Result::Success)
+    {
+        std::cout << "[Luau] Native: " << path << " (" << stats.functionsCompiled << "/" << stats.functionsTotal
+                  << " functions, " << stats.nativeCodeSizeBytes << " bytes)\n";
+    }
+    else if (result.result != Result::NotNativeModule && result.result != Result::NothingToCompile)
+    {
+        std::cerr << "[Luau] Native codegen failed for " << path << ": " << Luau::CodeGen::toString(result.result) << "\n";
+    }
+}
+
+void LuauScripting::releaseInstance(Instance& inst)
+{
+    if (!inst.L) return;
+
+    for (int* ref : { &inst.tableRef, &inst.startRef, &inst.updateRef, &inst.updateBatchRef, &inst.destroyRef, &inst.eventRef })
+    {
+        if (*ref != LUA_NOREF) { lua_unref(inst.L, *ref); *ref = LUA_NOREF; }
+    }
+
+    if (inst.threadRef != LUA_NOREF)
+    {
+        // Threads are collected by the root state once unreferenced
+        lua_unref(root, inst.threadRef);
+        inst.threadRef = LUA_NOREF;
+    }
+    else
+    {
+        lua_close(inst.L);
+    }
+    inst.L = nullptr;
+}
+
+void LuauScripting::releaseBatch(ScriptDef& def)
+{
+    if (def.batch.L && def.entityListRef != LUA_NOREF)
+        lua_unref(def.batch.L, def.entityListRef);
+    def.entityListRef = LUA_NOREF;
+    def.entityListSize = 0;
+
+    releaseInstance(def.batch);
+    def.batchLoaded = false;
+
+    // Reloaded code may add or drop the hook; the next Start() looks again
+    def.batchHookKnown = false;
+    def.hasBatchHook = false;
+}
+
+void LuauScripting::callUpdate(ScriptDef& def, Instance& inst, double dt)
+{
+    if (inst.updateRef == LUA_NOREF) return;
+
+    ProfileScope scope(*this, inst.L, def, &def.counters, &inst.counters, CallKind::Update);
+
+    lua_getref(inst.L, inst.updateRef);
+    lua_getref(inst.L, inst.tableRef); // self
+    lua_pushnumber(inst.L, dt);
+    if (lua_pcall(inst.L, 2, 0, 0) != 0)
+    {
+        std::cerr << "[Luau] OnUpdate error: " << lua_tostring(inst.L, -1) << "\n";
+        lua_pop(inst.L, 1); // pop error
+    }
+}
+
+void LuauScripting::reloadScript(ScriptId id, ScriptDef& def)
 {
-    inst.hasStart = inst.hasUpdate = inst.hasDestroy = inst.hasEvent = false;
+    // Load the new bytecode before touching anything, so a half-written or broken file
+    // leaves the running version (chunk and instances) as it was
+    std::vector<char> bc = readFile(def.path);
+    int newChunkRef = LUA_NOREF;
+    if (root)
+    {
+        if (!pushChunk(root, bc, def.path))
+        {
+            std::cerr << "[Luau] Reload of " << def.path << " failed, keeping the running version\n";
+            return;
+        }
+        compileNative(root, def.path);
+        newChunkRef = lua_ref(root, -1);
+        lua_pop(root, 1);
+    }
+    else
+    {
+        // Isolated VMs load per instance; check the bytes load at all in a scratch state
+        lua_State* scratch = newState();
+        const bool loaded = pushChunk(scratch, bc, def.path);
+        lua_close(scratch);
+        if (!loaded)
+        {
+            std::cerr << "[Luau] Reload of " << def.path << " failed, keeping the running version\n";
+            return;
+        }
+    }
+
+    // Rebuild every instance of this script at once so they all run the same code
+    std::vector<Entity> entities;
+    for (const auto& kv : instances)
+    {
+        if ((kv.first >> 32ull) == id.value)
+            entities.push_back(static_cast<Entity>(kv.first & 0xffffffffull));
+    }
+
+    // Snapshot plain self fields first; Stop() runs OnDestroy and frees the old tables
+    std::vector<std::vector<SavedField>> saved(entities.size());
+    for (size_t i = 0; i < entities.size(); ++i)
+        saveFields(instances.at(Key(id, entities[i])), saved[i]);
+
+    for (Entity e : entities)
+        Stop(id, e);
+
+    releaseBatch(def);
+
+    // Swap in the new chunk so Start() runs the new bytecode
+    if (root)
+    {
+        if (def.chunkRef != LUA_NOREF)
+            lua_unref(root, def.chunkRef);
+        def.chunkRef = newChunkRef;
+    }
+    else
+    {
+        def.bytecode = std::move(bc);
+    }
+
+    // OnStart sets up fresh tables/closures, then the old values are laid on top
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        Start(id, entities[i]);
+        auto it = instances.find(Key(id, entities[i]));
+        if (it != instances.end())
+            restoreFields(it->second, saved[i]);
+    }
+
+    std::cout << "[Luau] Reloaded " << def.path << " (" << entities.size() << " instances)\n";
+}
+
+void LuauScripting::saveFields(const Instance& inst, std::vector<SavedField>& out)
+{
+    lua_State* L = inst.L;
+    lua_getref(L, inst.tableRef); // [self]
+
+    lua_pushnil(L);
+    while (lua_next(L, -2) != 0) // [self, key, value]
+    {
+        if (lua_type(L, -2) == LUA_TSTRING)
+        {
+            SavedField field;
+            field.key = lua_tostring(L, -2);
+            field.type = lua_type(L, -1);
+            switch (field.type)
+            {
+            case LUA_TNUMBER:  field.number = lua_tonumber(L, -1); break;
+            case LUA_TBOOLEAN: field.number = lua_toboolean(L, -1); break;
+            case LUA_TSTRING:  field.text = lua_tostring(L, -1); break;
+            case LUA_TVECTOR:
+            {
+                const float* v = lua_tovector(L, -1);
+                std::copy(v, v + 3, field.vec);
+                break;
+            }
+            default: field.type = LUA_TNIL; break; // tables/functions belong to the old code
+            }
+
+            if (field.type != LUA_TNIL && field.key != "entity")
+                out.push_back(std::move(field));
+        }
+        lua_pop(L, 1); // pop value, keep key for lua_next
+    }
+    lua_pop(L, 1); // pop [self]
+}
+
+void LuauScripting::restoreFields(const Instance& inst, const std::vector<SavedField>& fields)
+{
+    if (fields.empty()) return;
+
+    lua_State* L = inst.L;
+    lua_getref(L, inst.tableRef); // [self]
+    for (const auto& field : fields)
+    {
+        switch (field.type)
+        {
+        case LUA_TNUMBER:  lua_pushnumber(L, field.number); break;
+        case LUA_TBOOLEAN: lua_pushboolean(L, field.number != 0.0); break;
+        case LUA_TSTRING:  lua_pushlstring(L, field.text.data(), field.text.size()); break;
+        case LUA_TVECTOR:  lua_pushvector(L, field.vec[0], field.vec[1], field.vec[2]); break;
+        default: continue;
+        }
+        lua_setfield(L, -2, field.key.c_str());
+    }
+    lua_pop(L, 1); // pop [self]
+}
+
+void LuauScripting::BeginFrame()
+{
+    ++profiledFrames;
+
+    // Several writes to one file can queue several requests; reload each script once
+    FrameVector<uint64_t> changed;
+    ScriptFileWatcher::ReloadRequest req;
+    while (watcher.PopReload(req))
+    {
+        if (std::find(changed.begin(), changed.end(), req.script) == changed.end())
+            changed.push_back(req.script);
+    }
+
+    if (!hotReload) return;
+
+    for (uint64_t script : changed)
+    {
+        auto it = scripts.find(script);
+        if (it != scripts.end())
+            reloadScript({script}, it->second);
+    }
+}
+
+void LuauScripting::EnableHotReload(bool enabled)
+{
+    hotReload = enabled;
+    if (enabled) watcher.Start();
+    else         watcher.Stop();
+}
+
+void LuauScripting::reportStats() const
+{
+    if (spawnCount == 0) return;
+
+    // Heap owned by scripts: the shared root state, or the sum of every isolated state
+    size_t heapBytes = 0;
+    if (root)
+    {
+        heapBytes = size_t(lua_gc(root, LUA_GCCOUNT, 0)) * 1024 + size_t(lua_gc(root, LUA_GCCOUNTB, 0));
+    }
+    else
+    {
+        for (const auto& kv : instances)
+            heapBytes += size_t(lua_gc(kv.second.L, LUA_GCCOUNT, 0)) * 1024 + size_t(lua_gc(kv.second.L, LUA_GCCOUNTB, 0));
+    }
+
+    std::cout << "[Luau] " << (sharedVM ? "Shared VM" : "Isolated VMs") << ": "
+              << spawnCount << " spawns, avg " << (spawnSeconds * 1e6 / double(spawnCount)) << " us/spawn, "
+              << instances.size() << " live instances, " << (heapBytes / 1024) << " KB heap";
+    if (!instances.empty())
+        std::cout << " (" << (heapBytes / instances.size()) << " bytes/instance)";
+    std::cout << "\n";
+}
 
+void LuauScripting::detectHooks(Instance& inst)
+{
     lua_getref(inst.L, inst.tableRef); // [self]
 
-    auto has = [&](const char* key)->bool
+    // Hold a ref to each hook so calls skip the by-name table lookup
+    auto resolve = [&](const char* key)->int
     {
         lua_getfield(inst.L, -1, key);
-        bool ok = lua_isfunction(inst.L, -1);
+        if (!lua_isfunction(inst.L, -1))
+        {
+            lua_pop(inst.L, 1);
+            return LUA_NOREF;
+        }
+        int ref = lua_ref(inst.L, -1);
         lua_pop(inst.L, 1);
-        return ok;
+        return ref;
     };
 
-    inst.hasStart   = has(kOnStart);
-    inst.hasUpdate  = has(kOnUpdate);
-    inst.hasDestroy = has(kOnDestroy);
-    inst.hasEvent   = has(kOnEvent);
+    inst.startRef       = resolve(kOnStart);
+    inst.updateRef      = resolve(kOnUpdate);
+    inst.updateBatchRef = resolve(kOnUpdateBatch);
+    inst.destroyRef     = resolve(kOnDestroy);
+    inst.eventRef       = resolve(kOnEvent);
 
     lua_pop(inst.L, 1); // pop [self]
-}
\ No newline at end of file
+}
+
+lua_State* LuauScripting::newState()
+{
+    lua_State* L = lua_newstate(&LuauScripting::allocate, nullptr);
+    if (profiling)
+    {
+        // Also fires around every incremental GC step, and lets the sampler stop at safepoints
+        lua_Callbacks* cb = lua_callbacks(L);
+        cb->userdata = this;
+        cb->interrupt = &LuauScripting::interrupt;
+    }
+    return L;
+}
+
+void* LuauScripting::allocate(void*, void* ptr, size_t osize, size_t nsize)
+{
+    // Luau sub-allocates its small objects from pages, so this mostly sees pages and large blocks
+    if (nsize == 0)
+    {
+        Memory::Free(ptr, osize, MemoryTag::Scripting);
+        return nullptr;
+    }
+    return Memory::Reallocate(ptr, osize, nsize, MemoryTag::Scripting);
+}
+
+int LuauScripting::memoryCategory(ScriptId id)
+{
+    // Category 0 is the engine's (libraries, bindings, loaded chunks); past 255 scripts share
+    return 1 + static_cast<int>((id.value - 1) % (LUA_MEMORY_CATEGORIES - 1));
+}
+
+void LuauScripting::chargeAllocations()
+{
+    if (!current.L) return;
+
+    // The VM's byte count only grows between GC steps, so growth since the mark is what ran allocated
+    const size_t heap = lua_totalbytes(current.L, -1);
+    if (heap > heapMark)
+    {
+        for (Counters* c : { current.script, current.instance })
+            if (c) c->bytesAllocated += heap - heapMark;
+    }
+    heapMark = heap;
+}
+
+void LuauScripting::interrupt(lua_State* L, int gc)
+{
+    auto* self = static_cast<LuauScripting*>(lua_callbacks(L)->userdata);
+
+    if (gc >= 0)
+    {
+        // luaC_step interrupts once before and once after its work. Charge what was allocated up
+        // to the step, then restart the mark after it so freed bytes don't look like allocations.
+        if (self->gcStepBegin < 0.0)
+        {
+            self->chargeAllocations();
+            self->gcStepBegin = nowSeconds();
+            return;
+        }
+
+        const double seconds = nowSeconds() - self->gcStepBegin;
+        self->gcStepBegin = -1.0;
+        for (Counters* c : { self->current.script, self->current.instance })
+        {
+            if (!c) continue;
+            ++c->gcSteps;
+            c->gcSeconds += seconds;
+        }
+        if (self->current.L) self->heapMark = lua_totalbytes(self->current.L, -1);
+        return;
+    }
+
+    if (self->sampleRequested.load(std::memory_order_relaxed) && self->current.def)
+    {
+        self->sampleRequested.store(false, std::memory_order_relaxed);
+        self->sampleStack(L);
+    }
+}
+
+void LuauScripting::sampleStack(lua_State* L)
+{
+    // Folded stack, outermost frame first: "<script>;<function>:<line>;..." with a count per line
+    std::vector<std::string> frames;
+    lua_Debug ar;
+    for (int level = 0; lua_getinfo(L, level, "sn", &ar); ++level)
+    {
+        std::string frame = ar.name ? ar.name : (ar.what && std::string(ar.what) == "main" ? "main" : "anonymous");
+        if (ar.linedefined > 0) frame += ":" + std::to_string(ar.linedefined);
+        frames.push_back(std::move(frame));
+    }
+
+    std::string stack = current.def->path;
+    for (auto it = frames.rbegin(); it != frames.rend(); ++it)
+        stack += ";" + *it;
+    ++samples[stack];
+}
+
+void LuauScripting::writeSamples() const
+{
+    std::ofstream out(sampleFile, std::ios::binary);
+    if (!out)
+    {
+        std::cerr << "[Luau] Can't open " << sampleFile << " for writing\n";
+        return;
+    }
+
+    uint64_t total = 0;
+    for (const auto& kv : samples)
+    {
+        out << kv.first << " " << kv.second << "\n";
+        total += kv.second;
+    }
+
+    std::cout << "[Luau] Wrote " << total << " stack samples (" << samples.size() << " unique stacks) to "
+              << sampleFile << "\n";
+}
+
+void LuauScripting::GetScriptStats(std::vector<ScriptStats>& out) const
+{
+    out.clear();
+    for (const auto& [id, def] : scripts)
+    {
+        ScriptStats s;
+        s.id = { id };
+        s.name = def.path;
+        s.updateCalls = def.counters.updateCalls;
+        s.updateMs = def.counters.updateSeconds * 1000.0;
+        s.eventCalls = def.counters.eventCalls;
+        s.eventMs = def.counters.eventSeconds * 1000.0;
+        s.bytesAllocated = def.counters.bytesAllocated;
+        s.gcSteps = def.counters.gcSteps;
+        s.gcMs = def.counters.gcSeconds * 1000.0;
+
+        for (const auto& kv : instances)
+        {
+            if ((kv.first >> 32ull) != id) continue;
+            ++s.instances;
+            if (!root) s.heapBytes += lua_totalbytes(kv.second.L, def.memcat);
+        }
+        if (!root && def.batch.L) s.heapBytes += lua_totalbytes(def.batch.L, def.memcat);
+        if (root) s.heapBytes = lua_totalbytes(root, def.memcat);
+
+        out.push_back(std::move(s));
+    }
+}
+
+void LuauScripting::GetInstanceStats(ScriptId id, std::vector<ScriptStats>& out) const
+{
+    out.clear();
+    auto defIt = scripts.find(id.value);
+    if (defIt == scripts.end()) return;
+
+    for (const auto& [key, inst] : instances)
+    {
+        if ((key >> 32ull) != id.value) continue;
+
+        ScriptStats s;
+        s.id = id;
+        s.name = defIt->second.path;
+        s.entity = static_cast<Entity>(key & 0xffffffffull);
+        s.updateCalls = inst.counters.updateCalls;
+        s.updateMs = inst.counters.updateSeconds * 1000.0;
+        s.eventCalls = inst.counters.eventCalls;
+        s.eventMs = inst.counters.eventSeconds * 1000.0;
+        s.bytesAllocated = inst.counters.bytesAllocated;
+        s.gcSteps = inst.counters.gcSteps;
+        s.gcMs = inst.counters.gcSeconds * 1000.0;
+        out.push_back(std::move(s));
+    }
+}
+
+void LuauScripting::ResetStats()
+{
+    for (auto& kv : scripts)
+    {
+        kv.second.counters = {};
+        kv.second.batch.counters = {};
+    }
+    for (auto& kv : instances)
+        kv.second.counters = {};
+
+    profiledFrames = 0;
+    samples.clear();
+}
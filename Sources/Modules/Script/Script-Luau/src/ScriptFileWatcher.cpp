@@ -0,0 +1,172 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Script-Luau/ScriptFileWatcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace ZED
+{
+    ScriptFileWatcher::~ScriptFileWatcher()
+    {
+        Stop();
+    }
+
+    void ScriptFileWatcher::Start()
+    {
+        if (m_Running.exchange(true)) return;
+        m_Thread = std::thread([this] { Run(); });
+    }
+
+    void ScriptFileWatcher::Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_WakeMutex);
+            if (!m_Running.exchange(false)) return;
+        }
+        m_WakeCv.notify_all();
+        if (m_Thread.joinable()) m_Thread.join();
+    }
+
+    void ScriptFileWatcher::Watch(const std::string& path, uint64_t script)
+    {
+        std::error_code ec;
+        WatchedFile file;
+        file.path = std::filesystem::absolute(path, ec).lexically_normal();
+        file.script = script;
+        file.lastWrite = std::filesystem::last_write_time(file.path, ec);
+
+        std::lock_guard<std::mutex> lock(m_FilesMutex);
+        m_Files.push_back(std::move(file));
+        ++m_FilesVersion;
+    }
+
+    void ScriptFileWatcher::Run()
+    {
+        if (!NotifyLoop())
+            PollLoop();
+    }
+
+    void ScriptFileWatcher::Publish(uint64_t script)
+    {
+        // Collapse repeated writes of the same file (editors often save in several steps)
+        if (std::find(m_Pending.begin(), m_Pending.end(), script) == m_Pending.end())
+            m_Pending.push_back(script);
+    }
+
+    void ScriptFileWatcher::FlushPending()
+    {
+        // Anything the main thread hasn't drained yet stays pending for the next round
+        size_t sent = 0;
+        while (sent < m_Pending.size() && m_Queue.Push(ReloadRequest{ m_Pending[sent] }))
+            ++sent;
+        m_Pending.erase(m_Pending.begin(), m_Pending.begin() + sent);
+    }
+
+    bool ScriptFileWatcher::WaitFor(int ms)
+    {
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_WakeCv.wait_for(lock, std::chrono::milliseconds(ms), [this] { return !IsRunning(); });
+        return IsRunning();
+    }
+
+    void ScriptFileWatcher::PollLoop()
+    {
+        while (WaitFor(kPollIntervalMs))
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_FilesMutex);
+                for (auto& file : m_Files)
+                {
+                    std::error_code ec;
+                    const auto now = std::filesystem::last_write_time(file.path, ec);
+                    if (ec || now == file.lastWrite) continue;
+
+                    file.lastWrite = now;
+                    Publish(file.script);
+                }
+            }
+            FlushPending();
+        }
+    }
+
+#if defined(__linux__)
+    bool ScriptFileWatcher::NotifyLoop()
+    {
+        const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0)
+        {
+            std::cerr << "[Luau] inotify unavailable, polling scripts for hot reload\n";
+            return false;
+        }
+
+        std::unordered_map<int, std::filesystem::path> dirs; // watch descriptor -> directory
+        uint32_t seenVersion = ~0u;
+
+        alignas(inotify_event) char buffer[4096];
+        while (IsRunning())
+        {
+            // Pick up directories of scripts loaded since the last round
+            {
+                std::lock_guard<std::mutex> lock(m_FilesMutex);
+                if (seenVersion != m_FilesVersion)
+                {
+                    seenVersion = m_FilesVersion;
+                    for (const auto& file : m_Files)
+                    {
+                        const auto dir = file.path.parent_path();
+                        // Only complete files: a write once it's closed, or a rename into place (editors
+                        // commonly save that way). IN_CREATE would fire while the file is still empty.
+                        const int wd = inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+                        if (wd >= 0) dirs[wd] = dir;
+                    }
+                }
+            }
+
+            pollfd pfd{ fd, POLLIN, 0 };
+            if (poll(&pfd, 1, kPollIntervalMs) > 0 && (pfd.revents & POLLIN))
+            {
+                ssize_t len;
+                while ((len = read(fd, buffer, sizeof(buffer))) > 0)
+                {
+                    std::lock_guard<std::mutex> lock(m_FilesMutex);
+                    for (char* p = buffer; p < buffer + len; )
+                    {
+                        const auto* ev = reinterpret_cast<const inotify_event*>(p);
+                        p += sizeof(inotify_event) + ev->len;
+
+                        auto dir = dirs.find(ev->wd);
+                        if (ev->len == 0 || dir == dirs.end()) continue;
+
+                        const auto changed = (dir->second / ev->name).lexically_normal();
+                        for (const auto& file : m_Files)
+                        {
+                            if (file.path == changed)
+                                Publish(file.script);
+                        }
+                    }
+                }
+            }
+            FlushPending();
+        }
+
+        close(fd);
+        return true;
+    }
+#else
+    bool ScriptFileWatcher::NotifyLoop()
+    {
+        return false;
+    }
+#endif
+}
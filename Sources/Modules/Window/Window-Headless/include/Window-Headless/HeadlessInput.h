@@ -0,0 +1,26 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef HEADLESSINPUT_H
+#define HEADLESSINPUT_H
+
+#pragma once
+
+#include "Engine/Interfaces/Input/IInput.h"
+
+namespace ZED
+{
+    // Input with no devices attached: nothing is ever pressed and no events are produced
+    class ZEDENGINE_API HeadlessInput : public IInput
+    {
+    public:
+        bool Init() override;
+        void PollEvents() override;
+        void SetEventCallback(const std::function<void(const InputEvent&)>& callback) override;
+        bool IsKeyDown(Key key) const override;
+        void AttachToNativeWindow(void* native_handle) override;
+    };
+}
+
+#endif
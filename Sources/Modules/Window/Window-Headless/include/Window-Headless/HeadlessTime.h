@@ -0,0 +1,38 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef HEADLESSTIME_H
+#define HEADLESSTIME_H
+
+#pragma once
+
+#include "Engine/ITime.h"
+#include <cstdint>
+
+namespace ZED
+{
+    /**
+     * Deterministic clock: every Update() advances by exactly [Headless]
+     * FixedDeltaTime regardless of how long the frame really took, and
+     * Sleep() returns immediately so the loop runs uncapped.
+     */
+    class ZEDENGINE_API HeadlessTime : public ITime
+    {
+    public:
+        explicit HeadlessTime(double fixedDelta);
+
+        void Sleep(unsigned int milliseconds) override;
+        void Update() override;
+        double GetDeltaTime() const override;
+        double GetElapsedTime() const override;
+
+    private:
+        double m_fixedDelta;
+        uint64_t m_frames = 0;
+        double m_deltaTime = 0.0;
+        double m_elapsedTime = 0.0;
+    };
+}
+
+#endif
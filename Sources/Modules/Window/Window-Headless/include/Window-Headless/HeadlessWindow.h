@@ -0,0 +1,41 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#ifndef HEADLESSWINDOW_H
+#define HEADLESSWINDOW_H
+
+#pragma once
+
+#include "Engine/IWindow.h"
+#include <cstdint>
+
+namespace ZED
+{
+    /**
+     * Window without a window. Keeps the main loop alive until SIGINT/SIGTERM
+     * or until [Headless] MaxFrames frames have been polled, so the engine can
+     * run as a dedicated server or inside CI. GetNativeHandle() is null.
+     */
+    class ZEDENGINE_API HeadlessWindow : public IWindow
+    {
+    public:
+        bool Init(const char* title, int width, int height) override;
+        void PollEvents() override;
+        void Shutdown() override;
+        bool IsRunning() const override;
+        void* GetNativeHandle() const override;
+
+        void SetMouseCapture(bool capture) override;
+        void SetMouseVisible(bool visible) override;
+        bool IsMouseCaptured() const override;
+        bool IsMouseVisible() const override;
+
+    private:
+        uint64_t m_frame = 0;
+        uint64_t m_maxFrames = 0; // 0 = run until stopped
+        bool m_running = false;
+    };
+}
+
+#endif
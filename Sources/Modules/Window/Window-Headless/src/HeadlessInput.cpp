@@ -0,0 +1,30 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Window-Headless/HeadlessInput.h"
+
+namespace ZED
+{
+    bool HeadlessInput::Init()
+    {
+        return true;
+    }
+
+    void HeadlessInput::PollEvents()
+    {
+    }
+
+    void HeadlessInput::SetEventCallback(const std::function<void(const InputEvent&)>&)
+    {
+    }
+
+    bool HeadlessInput::IsKeyDown(Key) const
+    {
+        return false;
+    }
+
+    void HeadlessInput::AttachToNativeWindow(void*)
+    {
+    }
+}
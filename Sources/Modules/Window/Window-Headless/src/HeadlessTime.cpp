@@ -0,0 +1,55 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Window-Headless/HeadlessTime.h"
+#include "Engine/Config/Config.h"
+
+#include <iostream>
+
+namespace ZED
+{
+    HeadlessTime::HeadlessTime(double fixedDelta)
+        : m_fixedDelta(fixedDelta)
+    {
+    }
+
+    void HeadlessTime::Sleep(unsigned int)
+    {
+        // Uncapped: nothing to wait for when nobody is watching
+    }
+
+    void HeadlessTime::Update()
+    {
+        // First frame reports zero delta, same as SDLTime
+        m_deltaTime = m_frames == 0 ? 0.0 : m_fixedDelta;
+
+        // Derive elapsed from the frame count so it never drifts from repeated addition
+        m_elapsedTime = m_frames == 0 ? 0.0 : static_cast<double>(m_frames) * m_fixedDelta;
+        ++m_frames;
+    }
+
+    double HeadlessTime::GetDeltaTime() const
+    {
+        return m_deltaTime;
+    }
+
+    double HeadlessTime::GetElapsedTime() const
+    {
+        return m_elapsedTime;
+    }
+
+    extern "C" ZEDENGINE_API void RegisterTime()
+    {
+        double fixedDelta = Config::Get().GetDoubleValue("Headless", "FixedDeltaTime", 1.0 / 60.0);
+        if (fixedDelta <= 0.0)
+        {
+            std::cerr << "[ZED::HeadlessTime] FixedDeltaTime must be positive, using 1/60\n";
+            fixedDelta = 1.0 / 60.0;
+        }
+
+        static HeadlessTime headlessTime(fixedDelta);
+        std::cout << "[ZED::HeadlessTime] RegisterTime called (fixed step " << fixedDelta << " s)\n";
+        SetTimeImplementation(&headlessTime);
+    }
+}
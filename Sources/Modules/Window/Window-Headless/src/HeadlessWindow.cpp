@@ -0,0 +1,94 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Window-Headless/HeadlessWindow.h"
+#include "Engine/Config/Config.h"
+#include "Engine/Events/EventSystem.h"
+
+#include <csignal>
+#include <iostream>
+
+namespace ZED
+{
+    namespace
+    {
+        volatile std::sig_atomic_t s_stopRequested = 0;
+
+        void OnStopSignal(int)
+        {
+            s_stopRequested = 1;
+        }
+    }
+
+    bool HeadlessWindow::Init(const char* title, int width, int height)
+    {
+        const auto& ini = Config::Get();
+        const long long maxFrames = ini.GetLongValue("Headless", "MaxFrames", 0);
+        m_maxFrames = maxFrames > 0 ? static_cast<uint64_t>(maxFrames) : 0;
+        m_frame = 0;
+        m_running = true;
+
+        // Without a close button, Ctrl+C / a service stop is how a server leaves the main loop cleanly
+        s_stopRequested = 0;
+        std::signal(SIGINT, OnStopSignal);
+        std::signal(SIGTERM, OnStopSignal);
+
+        std::cout << "[ZED::HeadlessWindow] Running headless: " << title << " (" << width << "x" << height << ")";
+        if (m_maxFrames)
+            std::cout << ", stopping after " << m_maxFrames << " frames";
+        std::cout << "\n";
+        return true;
+    }
+
+    void HeadlessWindow::PollEvents()
+    {
+        if (!m_running)
+            return;
+
+        ++m_frame;
+        if (s_stopRequested || (m_maxFrames && m_frame >= m_maxFrames))
+        {
+            m_running = false;
+
+            ZED::Event ev{};
+            ev.type = EventType::WindowClose;
+            EventSystem::Get().Post(ev);
+        }
+    }
+
+    void HeadlessWindow::Shutdown()
+    {
+        m_running = false;
+        std::signal(SIGINT, SIG_DFL);
+        std::signal(SIGTERM, SIG_DFL);
+    }
+
+    bool HeadlessWindow::IsRunning() const
+    {
+        return m_running;
+    }
+
+    void* HeadlessWindow::GetNativeHandle() const
+    {
+        return nullptr;
+    }
+
+    void HeadlessWindow::SetMouseCapture(bool)
+    {
+    }
+
+    void HeadlessWindow::SetMouseVisible(bool)
+    {
+    }
+
+    bool HeadlessWindow::IsMouseCaptured() const
+    {
+        return false;
+    }
+
+    bool HeadlessWindow::IsMouseVisible() const
+    {
+        return false;
+    }
+}
@@ -0,0 +1,20 @@
+/*
+ * © 2025 ZED Interactive. All Rights Reserved.
+ */
+
+#include "Window-Headless/HeadlessWindow.h"
+#include "Window-Headless/HeadlessInput.h"
+#include "Engine/Input/Input.h"
+#include "Engine/IWindow.h"
+
+extern "C" ZEDENGINE_API ZED::IWindow* ZED_CreateWindow()
+{
+    return new ZED::HeadlessWindow();
+}
+
+extern "C" ZEDENGINE_API void RegisterInput()
+{
+    static ZED::HeadlessInput input;
+    input.Init();
+    ZED::Input::SetInputImplementation(&input);
+}
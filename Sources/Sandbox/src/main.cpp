@@ -11,17 +11,29 @@
 typedef ZED::IWindow* (*CreateWindowFunc)();
 typedef ZED::IScripting* (*CreateScriptingFunc)();
 typedef ZED::IRenderer* (*CreateRendererFunc)();
+typedef ZED::IPhysics* (*CreatePhysicsFunc)();
 typedef void (*RegisterTimeFunc)();
 typedef void (*RegisterInputFunc)();
 
 int main(int argc, char* argv[])
 {
-    // Load INI configuration
-    ZED::Config::Load("Configs/zedengine.ini");
+    // Load INI configuration, e.g. "Sandbox Configs/zedengine_headless.ini" for the headless modules
+    const char* configPath = argc > 1 ? argv[1] : "Configs/zedengine.ini";
+    ZED::Config::Load(configPath);
+
+    // Frame arena size and how often to print the per-tag memory report
+    ZED::Memory::InitFromConfig();
 
     // Load all modules listed in the INI under [Modules]
     ZED::Module::ModuleLoader::LoadModulesFromINI();
 
+    // Zones are only recorded during a capture; [Profiler] CaptureFrames > 0 writes one to a trace file
+    ZED::Profiler::InitFromConfig();
+    ZED_PROFILE_THREAD("Main");
+
+    // Spin up worker threads for parallel systems
+    ZED::JobSystem::InitFromConfig();
+
     // Register SDLTime implementation
     auto registerTime = (RegisterTimeFunc)
         ZED::Module::ModuleLoader::GetFunction("Time", "RegisterTime");
@@ -38,6 +50,10 @@ int main(int argc, char* argv[])
         registerInput();
     }
 
+    // Lockstep has to be known before the scripting VM installs math.random
+    ZED::FixedTimestep::InitFromConfig();
+    ZED::Determinism::InitFromConfig();
+
     ZED::IScripting* scripting = nullptr;
     if (auto createScripting = (CreateScriptingFunc)
         ZED::Module::ModuleLoader::GetFunction("Scripting", "CreateScripting"))
@@ -76,18 +92,45 @@ int main(int argc, char* argv[])
         std::cerr << "[ZED::Main] Failed to init renderer\n";
     }
 
+    // Physics is optional; without a [Modules] Physics entry the scene just doesn't simulate
+    ZED::IPhysics* physics = nullptr;
+    if (auto createPhysics = (CreatePhysicsFunc)
+        ZED::Module::ModuleLoader::GetFunction("Physics", "CreatePhysics"))
+    {
+        physics = createPhysics();
+        if (!physics->Init())
+        {
+            std::cerr << "[ZED::Main] Failed to init physics\n";
+            ZED::Physics::SetImplementation(nullptr);
+            delete physics;
+            physics = nullptr;
+        }
+    }
+
+    // Scripts and physics advance in fixed steps (set up above); the frame rate is paced separately
+    ZED::FramePacer::InitFromConfig();
+
     // After RegisterInput(), get the input instance
     auto* input = ZED::Input::GetInput();
 
     // Needed so we can use other modules than sdl for windowing
     // But still be able to use sdl for our input
-    input->AttachToNativeWindow(window->GetNativeHandle());
+    if (input)
+    {
+        input->AttachToNativeWindow(window->GetNativeHandle());
+        ZED::Determinism::AttachInput(input);
+    }
 
     // Setup ECS registry
     auto& reg = ZED::ECS::ECS::Registry();
 
     // hook lifecycle signals once
     ZED::ScriptLifecycleSystem::connect(ZED::ECS::ECS::Registry());
+    ZED::TransformSystem::connect(ZED::ECS::ECS::Registry());
+    ZED::HierarchySystem::connect(ZED::ECS::ECS::Registry());
+    ZED::SpatialIndex::connect(ZED::ECS::ECS::Registry());
+    ZED::PhysicsSystem::connect(ZED::ECS::ECS::Registry());
+    ZED::InterpolationSystem::connect(ZED::ECS::ECS::Registry());
 
     // Setup example scripts
     ZED::ScriptId spinningScriptId{0};
@@ -97,8 +140,6 @@ int main(int argc, char* argv[])
 
     if (scripting)
     {
-        scripting->Init();
-
         // Load example scripts
         spinningScriptId = scripting->LoadBytecodeFile("Assets/Scripts/spinning_cube.luau.bc");
         pulsingScriptId = scripting->LoadBytecodeFile("Assets/Scripts/pulsing_cube.luau.bc");
@@ -108,78 +149,118 @@ int main(int argc, char* argv[])
         std::cout << "[Main] Loaded example scripts\n";
     }
 
-    // Create camera entity with editor mode enabled
+    // [Scene] LoadFile replaces the hand-built test scene below
+    const std::string sceneFile = ZED::Config::Get().GetValue("Scene", "LoadFile", "");
+    if (sceneFile.empty() || !ZED::Scene::Load(reg, sceneFile))
     {
-        auto camEnt = reg.create();
-        ZED::TransformComponent camTr{};
-        camTr.position = ZED::Vec3(0.0f, 0.0f, -6.0f);
-        reg.emplace<ZED::TransformComponent>(camEnt, camTr);
-
-        ZED::CameraComponent camComp{};
-        camComp.primary = true;
-        camComp.editorMode = true;  // Enable editor mode camera control
-        camComp.aspect = static_cast<float>(800) / static_cast<float>(600);
-        reg.emplace<ZED::CameraComponent>(camEnt, camComp);
-
-        // Attach camera_example script to camera entity
-        if (scripting && timeScriptId.value != 0)
+        // Create camera entity with editor mode enabled
         {
-            // Using time_example for camera to show time info
-            reg.emplace<ZED::ScriptComponent>(camEnt, ZED::ScriptComponent{ timeScriptId.value, true });
+            auto camEnt = reg.create();
+            ZED::TransformComponent camTr{};
+            camTr.position = ZED::Vec3(0.0f, 0.0f, -6.0f);
+            reg.emplace<ZED::TransformComponent>(camEnt, camTr);
+
+            ZED::CameraComponent camComp{};
+            camComp.primary = true;
+            camComp.editorMode = true;  // Enable editor mode camera control
+            camComp.aspect = static_cast<float>(800) / static_cast<float>(600);
+            reg.emplace<ZED::CameraComponent>(camEnt, camComp);
+
+            // Attach camera_example script to camera entity
+            if (scripting && timeScriptId.value != 0)
+            {
+                // Using time_example for camera to show time info
+                reg.emplace<ZED::ScriptComponent>(camEnt, ZED::ScriptComponent{ timeScriptId.value, true });
+            }
         }
-    }
 
-    // Transform Test: create entities with different scripts attached
-    {
-        // Entity 1: Spinning cube
-        auto e1 = reg.create();
-        reg.emplace<ZED::TransformComponent>(e1, ZED::TransformComponent{
-            .position = ZED::Vec3(-4.0f, 0.0f, 0.0f),
-            .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
-            .scale    = ZED::Vec3(1.0f, 1.0f, 1.0f)
-        });
-        if (scripting && spinningScriptId.value != 0)
+        // Transform Test: create entities with different scripts attached
         {
-            reg.emplace<ZED::ScriptComponent>(e1, ZED::ScriptComponent{ spinningScriptId.value, true });
-        }
+            // Entity 1: Spinning cube
+            auto e1 = reg.create();
+            reg.emplace<ZED::TransformComponent>(e1, ZED::TransformComponent{
+                .position = ZED::Vec3(-4.0f, 0.0f, 0.0f),
+                .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
+                .scale    = ZED::Vec3(1.0f, 1.0f, 1.0f)
+            });
+            reg.emplace<ZED::PreviousTransformComponent>(e1);
+            if (scripting && spinningScriptId.value != 0)
+            {
+                reg.emplace<ZED::ScriptComponent>(e1, ZED::ScriptComponent{ spinningScriptId.value, true });
+            }
 
-        // Entity 2: Pulsing cube
-        auto e2 = reg.create();
-        reg.emplace<ZED::TransformComponent>(e2, ZED::TransformComponent{
-            .position = ZED::Vec3( 0.0f, 0.0f, 0.0f),
-            .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
-            .scale    = ZED::Vec3(1.0f, 1.0f, 1.0f)
-        });
-        if (scripting && pulsingScriptId.value != 0)
-        {
-            reg.emplace<ZED::ScriptComponent>(e2, ZED::ScriptComponent{ pulsingScriptId.value, true });
-        }
+            // Entity 2: Pulsing cube
+            auto e2 = reg.create();
+            reg.emplace<ZED::TransformComponent>(e2, ZED::TransformComponent{
+                .position = ZED::Vec3( 0.0f, 0.0f, 0.0f),
+                .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
+                .scale    = ZED::Vec3(1.0f, 1.0f, 1.0f)
+            });
+            reg.emplace<ZED::PreviousTransformComponent>(e2);
+            if (scripting && pulsingScriptId.value != 0)
+            {
+                reg.emplace<ZED::ScriptComponent>(e2, ZED::ScriptComponent{ pulsingScriptId.value, true });
+            }
 
-        // Entity 3: Transform example (rotates on all axes)
-        auto e3 = reg.create();
-        reg.emplace<ZED::TransformComponent>(e3, ZED::TransformComponent{
-            .position = ZED::Vec3( 4.0f, 0.0f, 0.0f),
-            .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
-            .scale    = ZED::Vec3(1.0f, 1.0f, 1.0f)
-        });
-        if (scripting && transformScriptId.value != 0)
-        {
-            reg.emplace<ZED::ScriptComponent>(e3, ZED::ScriptComponent{ transformScriptId.value, true });
+            // Entity 3: Transform example (rotates on all axes)
+            auto e3 = reg.create();
+            reg.emplace<ZED::TransformComponent>(e3, ZED::TransformComponent{
+                .position = ZED::Vec3( 4.0f, 0.0f, 0.0f),
+                .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
+                .scale    = ZED::Vec3(1.0f, 1.0f, 1.0f)
+            });
+            reg.emplace<ZED::PreviousTransformComponent>(e3);
+            if (scripting && transformScriptId.value != 0)
+            {
+                reg.emplace<ZED::ScriptComponent>(e3, ZED::ScriptComponent{ transformScriptId.value, true });
+            }
+
+            // Entity 4: Another spinning cube (different speed could be set in script)
+            auto e4 = reg.create();
+            reg.emplace<ZED::TransformComponent>(e4, ZED::TransformComponent{
+                .position = ZED::Vec3( 8.0f, 0.0f, 0.0f),
+                .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
+                .scale    = ZED::Vec3(1.0f, 1.0f, 1.0f)
+            });
+            reg.emplace<ZED::PreviousTransformComponent>(e4);
+            if (scripting && spinningScriptId.value != 0)
+            {
+                reg.emplace<ZED::ScriptComponent>(e4, ZED::ScriptComponent{ spinningScriptId.value, true });
+            }
         }
 
-        // Entity 4: Another spinning cube (different speed could be set in script)
-        auto e4 = reg.create();
-        reg.emplace<ZED::TransformComponent>(e4, ZED::TransformComponent{
-            .position = ZED::Vec3( 8.0f, 0.0f, 0.0f),
-            .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
-            .scale    = ZED::Vec3(1.0f, 1.0f, 1.0f)
-        });
-        if (scripting && spinningScriptId.value != 0)
+        // Physics Test: a few small cubes dropped onto a static floor behind the scripted ones
         {
-            reg.emplace<ZED::ScriptComponent>(e4, ZED::ScriptComponent{ spinningScriptId.value, true });
+            auto floor = reg.create();
+            reg.emplace<ZED::TransformComponent>(floor, ZED::TransformComponent{
+                .position = ZED::Vec3(2.0f, -3.0f, 6.0f),
+                .rotation = ZED::Vec3(0.0f, 0.0f, 0.0f),
+                .scale    = ZED::Vec3(10.0f, 0.25f, 4.0f)
+            });
+            reg.emplace<ZED::ColliderComponent>(floor);
+            reg.emplace<ZED::RigidBodyComponent>(floor, ZED::RigidBodyComponent{ .motion = ZED::BodyMotion::Static });
+
+            for (int i = 0; i < 4; ++i)
+            {
+                auto box = reg.create();
+                reg.emplace<ZED::TransformComponent>(box, ZED::TransformComponent{
+                    .position = ZED::Vec3(0.3f * static_cast<float>(i), 1.0f + 1.5f * static_cast<float>(i), 6.0f),
+                    .rotation = ZED::Vec3(0.2f * static_cast<float>(i), 0.4f, 0.0f),
+                    .scale    = ZED::Vec3(0.5f, 0.5f, 0.5f)
+                });
+                reg.emplace<ZED::ColliderComponent>(box);
+                reg.emplace<ZED::RigidBodyComponent>(box);
+                reg.emplace<ZED::PreviousTransformComponent>(box);
+            }
         }
     }
 
+    const std::string sceneSaveFile = ZED::Config::Get().GetValue("Scene", "SaveFile", "");
+    if (!sceneSaveFile.empty())
+    {
+        ZED::Scene::Save(reg, sceneSaveFile);
+    }
+
     // Initialize camera system
     ZED::CameraSystem::Init();
     ZED::CameraSystem::SetAspect(static_cast<float>(800) / static_cast<float>(600));
@@ -189,23 +270,123 @@ int main(int argc, char* argv[])
     ZED::CameraController::SetMoveSpeed(5.0f);
     ZED::CameraController::SetMouseSensitivity(0.002f);
 
+    // Systems declare what they touch; the scheduler runs the ones that don't conflict side by side
+    ZED::SystemScheduler::InitFromConfig();
+    {
+        using namespace ZED;
+
+        SystemScheduler::Add(SystemPhase::Update, "CameraController", [](Registry& r, double dt)
+        {
+            CameraController::Update(r, dt);
+        }).Reads<CameraComponent>().Writes<TransformComponent, TransformDirty>().WritesResource<CameraController>();
+
+        SystemScheduler::Add(SystemPhase::FixedUpdate, "InterpolationCapture", [](Registry& r, double)
+        {
+            InterpolationSystem::Capture(r);
+        }).Reads<TransformComponent>().Writes<PreviousTransformComponent>();
+
+        // Scripts can create entities and add components, so nothing may run beside them
+        SystemScheduler::Add(SystemPhase::FixedUpdate, "Scripts", [](Registry& r, double dt)
+        {
+            ScriptUpdateSystem::tick(r, dt);
+        }).Exclusive();
+
+        SystemScheduler::Add(SystemPhase::FixedUpdate, "Physics", [](Registry& r, double dt)
+        {
+            PhysicsSystem::FixedUpdate(r, static_cast<float>(dt));
+        }).Reads<ColliderComponent>().Writes<RigidBodyComponent, TransformComponent, TransformDirty>().WritesResource<IPhysics>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "Transforms", [](Registry& r, double)
+        {
+            TransformSystem::UpdateWorldMatrices(r);
+        }).Reads<TransformComponent, HierarchyComponent>().Writes<WorldMatrixComponent, TransformDirty>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "SpatialIndex", [](Registry& r, double)
+        {
+            SpatialIndex::Update(r);
+        }).Reads<WorldMatrixComponent, BoundsComponent, HierarchyComponent>().WritesResource<SpatialIndex>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "Interpolation", [](Registry& r, double)
+        {
+            // Draw interpolated entities between their last two simulated poses
+            InterpolationSystem::Update(r, static_cast<float>(FixedTimestep::GetAlpha()));
+        }).Reads<TransformComponent, WorldMatrixComponent, HierarchyComponent>().Writes<PreviousTransformComponent>();
+
+        SystemScheduler::Add(SystemPhase::PostUpdate, "Camera", [](Registry& r, double)
+        {
+            CameraSystem::Update(r);
+        }).Reads<CameraComponent, TransformComponent, WorldMatrixComponent>().WritesResource<CameraSystem>();
+
+        // Drop everything outside the camera frustum (the camera entity itself is never visible)
+        SystemScheduler::Add(SystemPhase::PostUpdate, "Culling", [](Registry& r, double)
+        {
+            CullingSystem::Update(r, CameraSystem::GetView(), CameraSystem::GetProj());
+        }).Reads<WorldMatrixComponent, BoundsComponent, CameraComponent>().ReadsResource<CameraSystem>().WritesResource<CullingSystem>();
+
+        // Record the visible cubes on the worker threads
+        SystemScheduler::Add(SystemPhase::Render, "RenderRecord", [](Registry& r, double)
+        {
+            const Mat4& view = CameraSystem::GetView();
+            const auto& visible = CullingSystem::GetVisible();
+            const auto& worldMatrices = r.storage<WorldMatrixComponent>();
+            const auto& previousTransforms = r.storage<PreviousTransformComponent>();
+
+            RenderQueue::Begin();
+            JobSystem::ParallelFor(visible.size(), 1024, [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const Mat4& model = previousTransforms.contains(visible[i])
+                        ? previousTransforms.get(visible[i]).renderMatrix
+                        : worldMatrices.get(visible[i]).matrix;
+
+                    // View-space z of the object's origin; LH view looks down +z
+                    const float depth = (view * model[3]).z;
+                    RenderQueue::GetList().DrawCube(RenderKey::Make(RenderPass::Opaque, 0, depth), model);
+                }
+            });
+        }).Reads<WorldMatrixComponent, PreviousTransformComponent>()
+          .ReadsResource<CameraSystem, CullingSystem>().WritesResource<RenderQueue>();
+
+        // Sorted, batched submission
+        SystemScheduler::Add(SystemPhase::Render, "RenderSubmit", [renderer](Registry&, double)
+        {
+            renderer->BeginFrame(0.06f, 0.06f, 0.08f, 1.0f, CameraSystem::GetView(), CameraSystem::GetProj());
+            RenderQueue::Flush(*renderer);
+            renderer->EndFrame();
+        }).MainThread().ReadsResource<CameraSystem>().WritesResource<RenderQueue, IRenderer>();
+    }
+
     // Main loop
     while (window->IsRunning())
     {
+        ZED::Profiler::NewFrame();
+        ZED_PROFILE_SCOPE("Frame");
+
         ZED::Time::Update();
         double time = ZED::Time::GetElapsedTime();
         double deltaTime = ZED::Time::GetDeltaTime();
 
+        // Lockstep: every phase sees the fixed step, never the wall clock
+        if (ZED::Determinism::IsEnabled())
+            deltaTime = ZED::FixedTimestep::GetStep();
+
         time += deltaTime;
 
         // Poll window events
-        window->PollEvents();
+        {
+            ZED_PROFILE_SCOPE("IWindow::PollEvents");
+            window->PollEvents();
+        }
 
         // Poll input events
-        ZED::Input::GetInput()->PollEvents();
+        if (input)
+        {
+            input->PollEvents();
+        }
 
         // Handle mouse capture for editor mode camera
-        bool leftMouseDown = ZED::Input::GetInput()->IsKeyDown(ZED::Key::MouseLeft);
+        bool leftMouseDown = input && input->IsKeyDown(ZED::Key::MouseLeft);
         if (leftMouseDown && !window->IsMouseCaptured())
         {
             window->SetMouseCapture(true);
@@ -221,44 +402,48 @@ int main(int argc, char* argv[])
         ZED::EventSystem::Get().DispatchDeferred();
         ZED::EventSystem::Get().Dispatch();
 
-        // Update camera controller (must be after events are dispatched)
-        ZED::CameraController::Update(ZED::ECS::ECS::Registry(), deltaTime);
-
-        // Camera update
-        ZED::CameraSystem::Update(ZED::ECS::ECS::Registry());
-        const ZED::Mat4& view = ZED::CameraSystem::GetView();
-        const ZED::Mat4& proj = ZED::CameraSystem::GetProj();
-
-        // Render all transforms as cubes
-        renderer->BeginFrame(0.06f, 0.06f, 0.08f, 1.0f, view, proj);
+        // Per-frame systems such as the camera controller (must be after events are dispatched)
+        ZED::SystemScheduler::Run(ZED::SystemPhase::Update, reg, deltaTime);
 
-        auto tview = reg.view<ZED::TransformComponent>();
-        for (auto e : tview)
+        // Fixed-step simulation: zero or more steps, depending on how much time the frame took
+        const uint32_t steps = ZED::FixedTimestep::Advance(deltaTime);
+        const uint64_t firstTick = ZED::FixedTimestep::GetTick() - steps;
+        for (uint32_t i = 0; i < steps; ++i)
         {
-            // Skip camera entity when rendering
-            if (reg.any_of<ZED::CameraComponent>(e))
-            {
-                continue;
-            }
-
-            const auto& tr = tview.get<ZED::TransformComponent>(e);
-            renderer->DrawCube(tr.ToMatrix());
+            ZED::Determinism::BeginTick(firstTick + i);
+            ZED::SystemScheduler::Run(ZED::SystemPhase::FixedUpdate, reg, ZED::FixedTimestep::GetStep());
+            ZED::Determinism::EndTick(reg);
         }
 
-        renderer->EndFrame();
+        // World matrices, spatial index, interpolation, camera and culling for whatever changed
+        ZED::SystemScheduler::Run(ZED::SystemPhase::PostUpdate, reg, deltaTime);
+        ZED::SystemScheduler::Run(ZED::SystemPhase::Render, reg, deltaTime);
 
-        // Tick scripts (per-entity) - scripts handle all transform updates
-        ZED::ScriptUpdateSystem::tick(ZED::ECS::ECS::Registry(), deltaTime);
+        ZED::FramePacer::Wait();
 
-        ZED::Time::Sleep(1);
+        // Frame scratch memory is released here, so nothing above may hold on to it
+        ZED::Memory::EndFrame();
     }
 
+    ZED::Profiler::Shutdown();
+    ZED::Determinism::Shutdown();
+    ZED::SystemScheduler::DumpTimings(std::cout);
+    ZED::Memory::Report(std::cout);
+    ZED::SystemScheduler::Clear();
+    ZED::JobSystem::Shutdown();
+
+    if (physics)
+    {
+        physics->Shutdown();
+    }
     renderer->Shutdown();
     window->Shutdown();
     if (scripting)
     {
+        ZED::Scripting::ReportTopScripts(std::cout);
         scripting->Shutdown();
     }
+    delete physics;
     delete renderer;
     delete window;
     delete scripting;